@@ -0,0 +1,15 @@
+#! /bin/bash
+
+set -euo pipefail
+
+BASE_PATH="$(dirname "$0")/../.."
+cd "$BASE_PATH"
+
+for benchmark in build/*Benchmark; do
+	echo "Running $(basename "$benchmark")..."
+	echo ""
+	"$benchmark"
+	echo ""
+done
+
+echo "All done."
@@ -7,16 +7,23 @@ cd "$BASE_PATH"
 
 GREEN='\033[0;32m'
 RED='\033[0;31m'
+YELLOW='\033[0;33m'
 OFF='\033[0m'
 STATUS=0
 
+# The programs that operate on whole trees (e.g., "c = a + b"), which have no
+# counterpart in any runtime, so they are compiled, but never run.
+RUN_LIMITATIONS=" 09-tree-sum 10-tree-sub "
+
 echo "Compiler should accept..."
 echo ""
 
 for test in $(ls src/test/c/accept/); do
 	cat "src/test/c/accept/$test" | build/Compiler >/dev/null 2>&1
+	PIPED_RESULT="$?"
+	build/Compiler "src/test/c/accept/$test" >/dev/null 2>&1
 	RESULT="$?"
-	if [ "$RESULT" == "0" ]; then
+	if [ "$RESULT" == "0" ] && [ "$PIPED_RESULT" == "0" ]; then
 		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
 	else
 		STATUS=1
@@ -30,8 +37,10 @@ echo ""
 
 for test in $(ls src/test/c/reject/); do
 	cat "src/test/c/reject/$test" | build/Compiler >/dev/null 2>&1
+	PIPED_RESULT="$?"
+	build/Compiler "src/test/c/reject/$test" >/dev/null 2>&1
 	RESULT="$?"
-	if [ "$RESULT" != "0" ]; then
+	if [ "$RESULT" != "0" ] && [ "$PIPED_RESULT" != "0" ]; then
 		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
 	else
 		STATUS=1
@@ -40,5 +49,268 @@ for test in $(ls src/test/c/reject/); do
 done
 echo ""
 
+echo "Compiler should compile every program in batch mode..."
+echo ""
+
+OUTPUT="$(mktemp -d)"
+ls -d src/test/c/accept/* > "$OUTPUT/accept.list"
+ls -d src/test/c/reject/* > "$OUTPUT/reject.list"
+build/Compiler --batch "$OUTPUT/accept.list" --output "$OUTPUT" >/dev/null 2>&1
+ACCEPT_RESULT="$?"
+ACCEPTED=$(build/Compiler --batch "$OUTPUT/reject.list" --output "$OUTPUT" 2>/dev/null | grep -c "^SUCCEED")
+if [ "$ACCEPT_RESULT" == "0" ] && [ "$ACCEPTED" == "0" ]; then
+	echo -e "    accept and reject, ${GREEN}and it does${OFF}"
+else
+	STATUS=1
+	echo -e "    accept and reject, ${RED}but it does not${OFF} (status $ACCEPT_RESULT, $ACCEPTED rejected program(s) accepted)"
+fi
+rm -rf "$OUTPUT"
+echo ""
+
+echo "Compiler should dump the IR of every program..."
+echo ""
+
+OUTPUT="$(mktemp -d)"
+for test in $(ls src/test/c/accept/); do
+	rm -f "$OUTPUT/Main.ir"
+	build/Compiler "src/test/c/accept/$test" --dump-ir --output "$OUTPUT" >/dev/null 2>&1
+	RESULT="$?"
+	if [ "$RESULT" == "0" ] && [ -s "$OUTPUT/Main.ir" ]; then
+		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
+	else
+		STATUS=1
+		echo -e "    $test, ${RED}but it does not${OFF} (status $RESULT)"
+	fi
+done
+rm -rf "$OUTPUT"
+echo ""
+
+echo "Compiler should run every program..."
+echo ""
+
+OUTPUT="$(mktemp -d)"
+for test in $(ls src/test/c/accept/); do
+	if [[ "$RUN_LIMITATIONS" == *" $test "* ]]; then
+		echo -e "    $test, ${YELLOW}but it is skipped${OFF} (it operates on whole trees, which cannot run)"
+		continue
+	fi
+	(cd "$OUTPUT" && "$OLDPWD/build/Compiler" "$OLDPWD/src/test/c/accept/$test" --run >/dev/null 2>&1)
+	RESULT="$?"
+	if [ "$RESULT" == "0" ]; then
+		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
+	else
+		STATUS=1
+		echo -e "    $test, ${RED}but it does not${OFF} (status $RESULT)"
+	fi
+done
+rm -rf "$OUTPUT"
+echo ""
+
+echo "Compiler should run every program as it does without each optimization..."
+echo ""
+
+OUTPUT="$(mktemp -d)"
+for test in $(ls src/test/c/accept/); do
+	if [[ "$RUN_LIMITATIONS" == *" $test "* ]]; then
+		echo -e "    $test, ${YELLOW}but it is skipped${OFF} (it operates on whole trees, which cannot run)"
+		continue
+	fi
+	for optimization in DEAD_CODE_ELIMINATION BULK_INSERTION LOOP_FUSION LOOP_UNROLLING BOUND_HOISTING; do
+		rm -rf "$OUTPUT"/*
+		mkdir "$OUTPUT/optimized" "$OUTPUT/unoptimized"
+		(cd "$OUTPUT/optimized" && "$OLDPWD/build/Compiler" "$OLDPWD/src/test/c/accept/$test" --run >out 2>/dev/null)
+		RESULT="$?"
+		(cd "$OUTPUT/unoptimized" && env "$optimization=false" "$OLDPWD/build/Compiler" "$OLDPWD/src/test/c/accept/$test" --run >out 2>/dev/null)
+		UNOPTIMIZED_RESULT="$?"
+		# Both runs succeed, print the same, and visualize the same trees.
+		if [ "$RESULT" != "0" ] || [ "$UNOPTIMIZED_RESULT" != "$RESULT" ] || ! diff -r "$OUTPUT/optimized" "$OUTPUT/unoptimized" >/dev/null; then
+			RESULT=1
+		fi
+		if [ "$RESULT" == "0" ]; then
+			echo -e "    $test ($optimization), ${GREEN}and it does${OFF} (status $RESULT)"
+		else
+			STATUS=1
+			echo -e "    $test ($optimization), ${RED}but it does not${OFF} (status $RESULT)"
+		fi
+	done
+done
+rm -rf "$OUTPUT"
+echo ""
+
+echo "Compiler should accept every program that throws, whose run throws with and without each optimization..."
+echo ""
+
+OUTPUT="$(mktemp -d)"
+for test in $(ls src/test/c/throw/); do
+	build/Compiler "src/test/c/throw/$test" --output "$OUTPUT" >/dev/null 2>&1
+	RESULT="$?"
+	if [ "$RESULT" == "0" ]; then
+		(cd "$OUTPUT" && "$OLDPWD/build/Compiler" "$OLDPWD/src/test/c/throw/$test" --run >optimized 2>/dev/null)
+		[ "$?" != "0" ] || RESULT=1
+	fi
+	for optimization in DEAD_CODE_ELIMINATION BULK_INSERTION LOOP_FUSION LOOP_UNROLLING BOUND_HOISTING; do
+		[ "$RESULT" == "0" ] || break
+		(cd "$OUTPUT" && env "$optimization=false" "$OLDPWD/build/Compiler" "$OLDPWD/src/test/c/throw/$test" --run >unoptimized 2>/dev/null)
+		if [ "$?" == "0" ] || ! diff "$OUTPUT/optimized" "$OUTPUT/unoptimized" >/dev/null; then
+			RESULT=1
+		fi
+	done
+	if [ "$RESULT" == "0" ]; then
+		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
+	else
+		STATUS=1
+		echo -e "    $test, ${RED}but it does not${OFF} (status $RESULT)"
+	fi
+done
+rm -rf "$OUTPUT"
+echo ""
+
+echo "Compiler should generate C for every program, which prints what its run does..."
+echo ""
+
+OUTPUT="$(mktemp -d)"
+for test in $(ls src/test/c/accept/); do
+	if [[ "$RUN_LIMITATIONS" == *" $test "* ]]; then
+		echo -e "    $test, ${YELLOW}but it is skipped${OFF} (it operates on whole trees, which cannot run)"
+		continue
+	fi
+	rm -rf "$OUTPUT"/*
+	build/Compiler "src/test/c/accept/$test" --target=c --output "$OUTPUT" >/dev/null 2>&1 \
+		&& cc -std=gnu99 "$OUTPUT/Main.c" -I src/main/c/backend/domain-specific -L build -lTlaRuntime -lm -o "$OUTPUT/Main" >/dev/null 2>&1
+	RESULT="$?"
+	if [ "$RESULT" == "0" ]; then
+		EXPECTED="$(cd "$OUTPUT" && "$OLDPWD/build/Compiler" "$OLDPWD/src/test/c/accept/$test" --run 2>/dev/null)"
+		ACTUAL="$(cd "$OUTPUT" && ./Main 2>/dev/null)"
+		[ "$EXPECTED" == "$ACTUAL" ] || RESULT=1
+	fi
+	if [ "$RESULT" == "0" ]; then
+		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
+	else
+		STATUS=1
+		echo -e "    $test, ${RED}but it does not${OFF} (status $RESULT)"
+	fi
+done
+rm -rf "$OUTPUT"
+echo ""
+
+echo "Compiler should emit the class of every program, which the JVM verifies, and which prints what its run does..."
+echo ""
+
+# The runtime is compiled once (against the dependencies that Maven resolves),
+# if there is a JDK and Maven. Otherwise, the classes are not run.
+RUNTIME="$(mktemp -d)"
+JAVA_RUNTIME=""
+if command -v java >/dev/null && command -v javac >/dev/null && command -v mvn >/dev/null; then
+	mvn --quiet --file src/main/c/backend/domain-specific/pom.xml dependency:build-classpath -Dmdep.outputFile="$RUNTIME/classpath" >/dev/null 2>&1 \
+		&& javac -d "$RUNTIME/classes" -cp "$(cat "$RUNTIME/classpath")" $(ls src/main/c/backend/domain-specific/src/main/java/*.java | grep -v "/Main.java$") >/dev/null 2>&1
+	if [ "$?" == "0" ]; then
+		JAVA_RUNTIME="$RUNTIME/classes:$(cat "$RUNTIME/classpath")"
+	else
+		STATUS=1
+		echo -e "    the runtime, ${RED}but it does not compile${OFF}"
+	fi
+else
+	echo -e "    the classes, ${YELLOW}but they are not run${OFF} (there is no JDK, or no Maven)"
+fi
+
+OUTPUT="$(mktemp -d)"
+for test in $(ls src/test/c/accept/); do
+	rm -rf "$OUTPUT"/*
+	build/Compiler "src/test/c/accept/$test" --emit=class --output "$OUTPUT" >/dev/null 2>&1
+	RESULT="$?"
+	MAGIC="$(head -c 4 "$OUTPUT/Main.class" 2>/dev/null | od -An -tx1 | tr -d ' \n')"
+	[ "$MAGIC" == "cafebabe" ] || RESULT=1
+	if [ "$RESULT" == "0" ] && [ -n "$JAVA_RUNTIME" ] && [[ "$RUN_LIMITATIONS" != *" $test "* ]]; then
+		EXPECTED="$(cd "$OUTPUT" && "$OLDPWD/build/Compiler" "$OLDPWD/src/test/c/accept/$test" --run 2>/dev/null; echo "status $?")"
+		ACTUAL="$(cd "$OUTPUT" && java -Xverify:all -cp ".:$JAVA_RUNTIME" Main 2>/dev/null; echo "status $?")"
+		[ "$EXPECTED" == "$ACTUAL" ] || RESULT=1
+	fi
+	if [ "$RESULT" == "0" ]; then
+		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
+	else
+		STATUS=1
+		echo -e "    $test, ${RED}but it does not${OFF} (status $RESULT)"
+	fi
+done
+rm -rf "$OUTPUT"
+echo ""
+
+echo "Compiler should emit pooled trees, which print what the default trees do..."
+echo ""
+
+OUTPUT="$(mktemp -d)"
+for test in 14-bulk-insertion 16-tree-churn; do
+	if [ -z "$JAVA_RUNTIME" ]; then
+		echo -e "    $test, ${YELLOW}but it is skipped${OFF} (there is no JDK, or no Maven)"
+		continue
+	fi
+	rm -rf "$OUTPUT"/*
+	mkdir "$OUTPUT/default" "$OUTPUT/pooled"
+	build/Compiler "src/test/c/accept/$test" --emit=class --output "$OUTPUT/default" >/dev/null 2>&1 \
+		&& env POOLED_TREES=true build/Compiler "src/test/c/accept/$test" --emit=class --output "$OUTPUT/pooled" >/dev/null 2>&1
+	RESULT="$?"
+	if [ "$RESULT" == "0" ]; then
+		EXPECTED="$(cd "$OUTPUT/default" && java -Xverify:all -cp ".:$JAVA_RUNTIME" Main 2>/dev/null; echo "status $?")"
+		ACTUAL="$(cd "$OUTPUT/pooled" && java -Xverify:all -cp ".:$JAVA_RUNTIME" Main 2>/dev/null; echo "status $?")"
+		[ "$EXPECTED" == "$ACTUAL" ] || RESULT=1
+	fi
+	if [ "$RESULT" == "0" ]; then
+		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
+	else
+		STATUS=1
+		echo -e "    $test, ${RED}but it does not${OFF} (status $RESULT)"
+	fi
+done
+rm -rf "$OUTPUT"
+echo ""
+
+echo "Compiler should split a long program in methods, whose shared variables are fields..."
+echo ""
+
+OUTPUT="$(mktemp -d)"
+build/Compiler src/test/c/accept/17-chunked-program --output "$OUTPUT" >/dev/null 2>&1
+RESULT="$?"
+METHODS="$(grep -c "private static void main_" "$OUTPUT/Main.java" 2>/dev/null)"
+FIELDS="$(grep -c -E "private static (int|boolean|IntAVL|IntRBT) [a-z]+;" "$OUTPUT/Main.java" 2>/dev/null)"
+if [ "$RESULT" == "0" ] && [ "$METHODS" -gt 1 ] && [ "$FIELDS" == "4" ]; then
+	echo -e "    17-chunked-program, ${GREEN}and it does${OFF} ($METHODS methods, $FIELDS fields)"
+else
+	STATUS=1
+	echo -e "    17-chunked-program, ${RED}but it does not${OFF} (status $RESULT, $METHODS methods, $FIELDS fields)"
+fi
+rm -rf "$OUTPUT"
+echo ""
+
+echo "Compiler should compile (and run) huge programs with a small stack (1 MiB)..."
+echo ""
+
+OUTPUT="$(mktemp -d)"
+{ echo "AVLTree tree"; yes "tree insert 1" | head -n 1000000; } > "$OUTPUT/statements.tla"
+awk 'BEGIN { printf "Int value = "; for (k = 0; k < 1000000; ++k) printf "("; printf "1"; for (k = 0; k < 1000000; ++k) printf ")"; print "" }' > "$OUTPUT/parentheses.tla"
+awk 'BEGIN { printf "Boolean flag = "; for (k = 0; k < 1000000; ++k) printf "!"; print "true" }' > "$OUTPUT/negations.tla"
+awk 'BEGIN { print "AVLTree tree"; for (k = 0; k < 100000; ++k) print "if (true) {"; print "tree insert 1"; for (k = 0; k < 100000; ++k) print "}" }' > "$OUTPUT/blocks.tla"
+awk 'BEGIN { print "AVLTree tree"; for (k = 0; k < 100000; ++k) { print "for i in (0 to 2) {"; for (j = 0; j < 10; ++j) print "Int v" j " = i"; print "tree insert v9"; print "}" } }' > "$OUTPUT/scopes.tla"
+awk 'BEGIN { print "AVLTree tree"; print "Int base = 1"; printf "Int value = base"; for (k = 0; k < 1000000; ++k) printf " - (base"; for (k = 0; k < 1000000; ++k) printf ")"; print ""; print "tree insert value"; print "tree visualize" }' > "$OUTPUT/expressions.tla"
+awk 'BEGIN { print "AVLTree tree"; for (k = 0; k < 100000; ++k) print "for i" k " in (0 to 2) {"; print "tree insert 1"; for (k = 0; k < 100000; ++k) print "}"; print "tree visualize" }' > "$OUTPUT/loops.tla"
+for test in statements parentheses negations blocks scopes expressions loops; do
+	(ulimit -s 1024 && build/Compiler "$OUTPUT/$test.tla" --output "$OUTPUT" >/dev/null 2>&1)
+	RESULT="$?"
+	# The loops are nested, so running them would take exponential time.
+	if [ "$RESULT" == "0" ] && [ "$test" != "loops" ]; then
+		(cd "$OUTPUT" && ulimit -s 1024 && "$OLDPWD/build/Compiler" "$OUTPUT/$test.tla" --run >/dev/null 2>&1)
+		RESULT="$?"
+	fi
+	if [ "$RESULT" == "0" ]; then
+		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
+	else
+		STATUS=1
+		echo -e "    $test, ${RED}but it does not${OFF} (status $RESULT)"
+	fi
+done
+rm -rf "$OUTPUT"
+echo ""
+
+rm -rf "$RUNTIME"
+
 echo "All done."
 exit $STATUS
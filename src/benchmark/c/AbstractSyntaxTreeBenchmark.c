@@ -0,0 +1,137 @@
+#include "../../main/c/backend/code-generation/Generator.h"
+#include "../../main/c/frontend/lexical-analysis/FlexActions.h"
+#include "../../main/c/frontend/lexical-analysis/LexicalAnalyzerContext.h"
+#include "../../main/c/frontend/lexical-analysis/SourceCode.h"
+#include "../../main/c/frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../main/c/frontend/syntactic-analysis/BisonActions.h"
+#include "../../main/c/frontend/syntactic-analysis/SyntacticAnalyzer.h"
+#include "../../main/c/shared/Arena.h"
+#include "../../main/c/shared/InternTable.h"
+#include "../../main/c/shared/Logger.h"
+#include "Benchmark.h"
+
+/**
+ * Measures the cost of building, walking and releasing the AST, when every
+ * identifier is allocated in heap-memory on its own, and when they are
+ * bump-allocated over the chunks of an arena.
+ */
+
+#define BLOCKS 20000
+#define RUNS 3
+
+/* PRIVATE FUNCTIONS */
+
+static void _synthesizeProgram(SourceBuffer * sourceBuffer);
+static void _benchmark(const char * name, const boolean arenaAllocation, SourceCode * sourceCode, FILE * outputFile);
+
+/**
+ * Synthesizes a semantically valid program with lots of nodes. Variables are
+ * never read in expressions, so the semantic-analysis stays quiet.
+ */
+static void _synthesizeProgram(SourceBuffer * sourceBuffer) {
+	for (unsigned int k = 0; k < BLOCKS; ++k) {
+		appendToSourceBuffer(sourceBuffer, "AVLTree tree%u\n", k);
+		appendToSourceBuffer(sourceBuffer, "for index%u in (0 to 100) { tree%u insert 3 * 7 + 1 }\n", k, k);
+		appendToSourceBuffer(sourceBuffer, "Int value%u = 1 + 2 * (3 - 4) %% 5\n", k);
+		appendToSourceBuffer(sourceBuffer, "Boolean flag%u = 10 >= 1 & true | !false\n", k);
+		appendToSourceBuffer(sourceBuffer, "if (true) { tree%u remove 12 } else { tree%u insert 99 }\n", k, k);
+		appendToSourceBuffer(sourceBuffer, "tree%u iterate in-order\n\n", k);
+	}
+}
+
+/**
+ * Parses, generates and releases the whole program several times, and reports
+ * the elapsed time of each phase, and the memory requested to the allocator.
+ */
+static void _benchmark(const char * name, const boolean arenaAllocation, SourceCode * sourceCode, FILE * outputFile) {
+	setenv("ARENA_ALLOCATION", arenaAllocation ? "true" : "false", 1);
+	initializeArenaModule();
+	initializeInternTableModule();
+	double parsing = 0;
+	double generation = 0;
+	double release = 0;
+	AllocationCounters allocationCounters = { 0, 0 };
+	for (unsigned int run = 0; run < RUNS; ++run) {
+		CompilerState compilerState = {
+			.abstractSyntaxtTree = NULL,
+			.arena = createArena(),
+			.internTable = NULL,
+			.succeed = false,
+			.className = "Main",
+			.outputFile = outputFile,
+			.scanner = NULL,
+			.semanticErrors = 0,
+			.sourceCode = sourceCode,
+			.symbolTable = NULL,
+			.usedSymbols = NULL,
+			.value = 0
+		};
+		const AllocationCounters since = currentAllocationCounters();
+		const double start = currentSeconds();
+		const SyntacticAnalysisStatus syntacticAnalysisStatus = parse(&compilerState);
+		const double parsed = currentSeconds();
+		const AllocationCounters delta = allocationCountersSince(since);
+		if (syntacticAnalysisStatus != ACCEPT) {
+			fprintf(stderr, "The synthesized program was rejected.\n");
+			exit(1);
+		}
+		generate(&compilerState);
+		fflush(outputFile);
+		const double generated = currentSeconds();
+		destroyAbstractSyntaxTree(compilerState.abstractSyntaxtTree);
+		destroyInternTable(compilerState.internTable);
+		destroyArena(compilerState.arena);
+		const double released = currentSeconds();
+		parsing += parsed - start;
+		generation += generated - parsed;
+		release += released - generated;
+		allocationCounters.allocations += delta.allocations;
+		allocationCounters.bytes += delta.bytes;
+	}
+	shutdownInternTableModule();
+	shutdownArenaModule();
+	printf("%-12s %12.2f %14.2f %12.2f %14llu %14llu\n",
+		name,
+		1000 * parsing / RUNS,
+		1000 * generation / RUNS,
+		1000 * release / RUNS,
+		allocationCounters.allocations / RUNS,
+		allocationCounters.bytes / RUNS);
+}
+
+/**
+ * The entry-point of the benchmark.
+ */
+int main(const int count, const char ** arguments) {
+	initializeLexicalAnalyzerContextModule();
+	initializeFlexActionsModule();
+	initializeBisonActionsModule();
+	initializeSyntacticAnalyzerModule();
+	initializeAbstractSyntaxTreeModule();
+	initializeGeneratorModule();
+	SourceBuffer sourceBuffer = { NULL, 0, 0 };
+	_synthesizeProgram(&sourceBuffer);
+	// Flex scans in place, so the content needs two trailing null characters.
+	SourceCode sourceCode = {
+		.content = calloc(sourceBuffer.length + 2, sizeof(char)),
+		.length = sourceBuffer.length,
+		.capacity = sourceBuffer.length + 2,
+		.mapped = false
+	};
+	memcpy(sourceCode.content, sourceBuffer.content, sourceBuffer.length);
+	FILE * outputFile = fopen("/dev/null", "w");
+	printf("Compiling %zu bytes, %d times per mode (the generated code is discarded).\n\n", sourceCode.length, RUNS);
+	printf("%-12s %12s %14s %12s %14s %14s\n", "Mode", "Parse (ms)", "Generate (ms)", "Free (ms)", "Allocs/run", "Bytes/run");
+	_benchmark("heap", false, &sourceCode, outputFile);
+	_benchmark("arena", true, &sourceCode, outputFile);
+	fclose(outputFile);
+	free(sourceCode.content);
+	destroySourceBuffer(&sourceBuffer);
+	shutdownGeneratorModule();
+	shutdownAbstractSyntaxTreeModule();
+	shutdownSyntacticAnalyzerModule();
+	shutdownBisonActionsModule();
+	shutdownFlexActionsModule();
+	shutdownLexicalAnalyzerContextModule();
+	return 0;
+}
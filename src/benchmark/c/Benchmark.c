@@ -0,0 +1,84 @@
+#include "Benchmark.h"
+#include <stdarg.h>
+
+/* MODULE INTERNAL STATE */
+
+static unsigned long long _allocations = 0;
+static unsigned long long _bytes = 0;
+
+/**
+ * The original allocator functions. Every call to "malloc", "calloc" or
+ * "realloc" is redirected to the "__wrap_" versions by the linker.
+ *
+ * @see https://sourceware.org/binutils/docs/ld/Options.html
+ */
+void * __real_malloc(size_t size);
+void * __real_calloc(size_t count, size_t size);
+void * __real_realloc(void * pointer, size_t size);
+
+void * __wrap_malloc(size_t size) {
+	__atomic_fetch_add(&_allocations, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&_bytes, size, __ATOMIC_RELAXED);
+	return __real_malloc(size);
+}
+
+void * __wrap_calloc(size_t count, size_t size) {
+	__atomic_fetch_add(&_allocations, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&_bytes, count * size, __ATOMIC_RELAXED);
+	return __real_calloc(count, size);
+}
+
+void * __wrap_realloc(void * pointer, size_t size) {
+	__atomic_fetch_add(&_allocations, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&_bytes, size, __ATOMIC_RELAXED);
+	return __real_realloc(pointer, size);
+}
+
+/* PUBLIC FUNCTIONS */
+
+AllocationCounters currentAllocationCounters() {
+	AllocationCounters allocationCounters = {
+		.allocations = __atomic_load_n(&_allocations, __ATOMIC_RELAXED),
+		.bytes = __atomic_load_n(&_bytes, __ATOMIC_RELAXED)
+	};
+	return allocationCounters;
+}
+
+AllocationCounters allocationCountersSince(const AllocationCounters since) {
+	AllocationCounters now = currentAllocationCounters();
+	now.allocations -= since.allocations;
+	now.bytes -= since.bytes;
+	return now;
+}
+
+double currentSeconds() {
+	struct timespec timespec;
+	clock_gettime(CLOCK_MONOTONIC, &timespec);
+	return timespec.tv_sec + timespec.tv_nsec / 1e9;
+}
+
+void appendToSourceBuffer(SourceBuffer * sourceBuffer, const char * const format, ...) {
+	va_list arguments;
+	va_start(arguments, format);
+	const int length = vsnprintf(NULL, 0, format, arguments);
+	va_end(arguments);
+	if (sourceBuffer->capacity < sourceBuffer->length + length + 1) {
+		size_t capacity = sourceBuffer->capacity < 4096 ? 4096 : sourceBuffer->capacity;
+		while (capacity < sourceBuffer->length + length + 1) {
+			capacity *= 2;
+		}
+		sourceBuffer->content = realloc(sourceBuffer->content, capacity);
+		sourceBuffer->capacity = capacity;
+	}
+	va_start(arguments, format);
+	vsnprintf(sourceBuffer->content + sourceBuffer->length, length + 1, format, arguments);
+	va_end(arguments);
+	sourceBuffer->length += length;
+}
+
+void destroySourceBuffer(SourceBuffer * sourceBuffer) {
+	free(sourceBuffer->content);
+	sourceBuffer->content = NULL;
+	sourceBuffer->length = 0;
+	sourceBuffer->capacity = 0;
+}
@@ -0,0 +1,53 @@
+#ifndef BENCHMARK_HEADER
+#define BENCHMARK_HEADER
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * The activity of the allocator since the beginning of the process. Only
+ * allocations are counted (i.e., "free" is ignored), so the difference
+ * between two snapshots is the amount of memory requested in between.
+ */
+typedef struct {
+	unsigned long long allocations;
+	unsigned long long bytes;
+} AllocationCounters;
+
+/**
+ * A growable, heap-allocated string used to synthesize input programs.
+ */
+typedef struct {
+	char * content;
+	size_t length;
+	size_t capacity;
+} SourceBuffer;
+
+/**
+ * Takes a snapshot of the allocator counters.
+ */
+AllocationCounters currentAllocationCounters();
+
+/**
+ * Returns the difference between two snapshots of the allocator counters.
+ */
+AllocationCounters allocationCountersSince(const AllocationCounters since);
+
+/**
+ * A monotonic clock, in seconds.
+ */
+double currentSeconds();
+
+/**
+ * Appends a formatted string to the source buffer, growing it if needed.
+ */
+void appendToSourceBuffer(SourceBuffer * sourceBuffer, const char * const format, ...);
+
+/**
+ * Releases the content of a source buffer.
+ */
+void destroySourceBuffer(SourceBuffer * sourceBuffer);
+
+#endif
@@ -0,0 +1,240 @@
+#include "../../main/c/shared/Hash.h"
+#include "Benchmark.h"
+#include <ctype.h>
+
+/**
+ * Compares candidate hash functions for identifiers, on throughput and on how
+ * evenly they spread the identifiers over the buckets of a power-of-2 table
+ * (which keeps the lowest bits of the hash, like the intern table).
+ *
+ * The identifiers are read from the TLA programs given as arguments (e.g.,
+ * "src/test/c/accept/*"), and also synthesized in the style of generated
+ * programs, whose names only differ in a numeric suffix.
+ */
+
+#define SYNTHESIZED_IDENTIFIERS 100000
+#define MINIMUM_HASHED_BYTES 100000000
+#define SEED 0x13572468
+
+typedef uint64_t (*HashFunction)(const char * string, const size_t length);
+
+typedef struct {
+	const char * name;
+	HashFunction function;
+} Candidate;
+
+/**
+ * A set of identifiers, with their lengths precomputed.
+ */
+typedef struct {
+	char ** identifiers;
+	size_t * lengths;
+	size_t count;
+	size_t capacity;
+	size_t bytes;
+} Corpus;
+
+/* PRIVATE FUNCTIONS */
+
+static uint64_t _murmurOneAtATime(const char * string, const size_t length);
+static uint64_t _fnv1a(const char * string, const size_t length);
+static uint64_t _wyhash(const char * string, const size_t length);
+static void _addIdentifier(Corpus * corpus, const char * identifier, const size_t length);
+static int _compareIdentifiers(const void * left, const void * right);
+static void _removeDuplicates(Corpus * corpus);
+static void _loadProgram(Corpus * corpus, const char * path);
+static void _destroyCorpus(Corpus * corpus);
+static void _benchmark(const char * corpusName, const Corpus * corpus, const Candidate * candidate);
+
+/**
+ * The hash of the symbol table before identifiers were interned: one byte at a
+ * time, with the mix of Murmur.
+ *
+ * @see https://github.com/aappleby/smhasher/blob/master/src/Hashes.cpp
+ */
+static uint64_t _murmurOneAtATime(const char * string, const size_t length) {
+	uint64_t hash = SEED;
+	for (size_t k = 0; k < length; ++k) {
+		hash ^= (unsigned char) string[k];
+		hash *= 0x5bd1e995;
+		hash ^= hash >> 15;
+	}
+	return hash;
+}
+
+/**
+ * The 64-bit FNV-1a hash, one byte at a time.
+ *
+ * @see http://www.isthe.com/chongo/tech/comp/fnv/
+ */
+static uint64_t _fnv1a(const char * string, const size_t length) {
+	uint64_t hash = 0xcbf29ce484222325;
+	for (size_t k = 0; k < length; ++k) {
+		hash ^= (unsigned char) string[k];
+		hash *= 0x100000001b3;
+	}
+	return hash;
+}
+
+static uint64_t _wyhash(const char * string, const size_t length) {
+	return hashBytes(string, length, SEED);
+}
+
+static void _addIdentifier(Corpus * corpus, const char * identifier, const size_t length) {
+	if (corpus->count == corpus->capacity) {
+		corpus->capacity = corpus->capacity == 0 ? 1024 : 2 * corpus->capacity;
+		corpus->identifiers = realloc(corpus->identifiers, corpus->capacity * sizeof(char *));
+		corpus->lengths = realloc(corpus->lengths, corpus->capacity * sizeof(size_t));
+	}
+	char * copy = calloc(length + 1, sizeof(char));
+	memcpy(copy, identifier, length);
+	corpus->identifiers[corpus->count] = copy;
+	corpus->lengths[corpus->count++] = length;
+	corpus->bytes += length;
+}
+
+static int _compareIdentifiers(const void * left, const void * right) {
+	return strcmp(*(char **) left, *(char **) right);
+}
+
+/**
+ * Keeps each identifier once, as an intern table would.
+ */
+static void _removeDuplicates(Corpus * corpus) {
+	qsort(corpus->identifiers, corpus->count, sizeof(char *), _compareIdentifiers);
+	size_t count = 0;
+	corpus->bytes = 0;
+	for (size_t k = 0; k < corpus->count; ++k) {
+		if (0 < count && strcmp(corpus->identifiers[count - 1], corpus->identifiers[k]) == 0) {
+			free(corpus->identifiers[k]);
+			continue;
+		}
+		corpus->identifiers[count] = corpus->identifiers[k];
+		corpus->lengths[count] = strlen(corpus->identifiers[k]);
+		corpus->bytes += corpus->lengths[count++];
+	}
+	corpus->count = count;
+}
+
+/**
+ * Adds every word of a program (i.e., identifiers and keywords, which are
+ * hashed by the lexer all the same) to the corpus.
+ */
+static void _loadProgram(Corpus * corpus, const char * path) {
+	FILE * file = fopen(path, "r");
+	if (file == NULL) {
+		fprintf(stderr, "The program cannot be opened: \"%s\".\n", path);
+		return;
+	}
+	char word[256];
+	size_t length = 0;
+	for (int character = fgetc(file); ; character = fgetc(file)) {
+		if (character != EOF && (isalnum(character) || character == '_') && (0 < length || !isdigit(character))) {
+			if (length < sizeof(word)) {
+				word[length++] = (char) character;
+			}
+			continue;
+		}
+		if (0 < length) {
+			_addIdentifier(corpus, word, length);
+			length = 0;
+		}
+		if (character == EOF) {
+			break;
+		}
+	}
+	fclose(file);
+}
+
+static void _destroyCorpus(Corpus * corpus) {
+	for (size_t k = 0; k < corpus->count; ++k) {
+		free(corpus->identifiers[k]);
+	}
+	free(corpus->identifiers);
+	free(corpus->lengths);
+}
+
+/**
+ * Hashes the corpus as many times as needed to measure the throughput, and
+ * then counts the identifiers of each bucket, in a table with twice as many
+ * buckets as identifiers. The chi-squared statistic is normalized, so an ideal
+ * (uniform) hash is close to 1.0, and higher numbers mean more collisions.
+ */
+static void _benchmark(const char * corpusName, const Corpus * corpus, const Candidate * candidate) {
+	const size_t rounds = 1 + MINIMUM_HASHED_BYTES / (corpus->bytes + 1);
+	uint64_t checksum = 0;
+	const double start = currentSeconds();
+	for (size_t round = 0; round < rounds; ++round) {
+		for (size_t k = 0; k < corpus->count; ++k) {
+			checksum ^= candidate->function(corpus->identifiers[k], corpus->lengths[k]);
+		}
+	}
+	const double elapsed = currentSeconds() - start;
+
+	size_t buckets = 1;
+	while (buckets < 2 * corpus->count) {
+		buckets <<= 1;
+	}
+	unsigned int * loads = calloc(buckets, sizeof(unsigned int));
+	for (size_t k = 0; k < corpus->count; ++k) {
+		++loads[candidate->function(corpus->identifiers[k], corpus->lengths[k]) & (buckets - 1)];
+	}
+	const double expected = (double) corpus->count / buckets;
+	double chiSquared = 0;
+	unsigned int maximumLoad = 0;
+	size_t collisions = 0;
+	for (size_t k = 0; k < buckets; ++k) {
+		chiSquared += (loads[k] - expected) * (loads[k] - expected) / expected;
+		maximumLoad = loads[k] < maximumLoad ? maximumLoad : loads[k];
+		collisions += loads[k] < 2 ? 0 : loads[k] - 1;
+	}
+	free(loads);
+
+	printf("%-10s %-14s %10.1f %10.2f %12.3f %10zu %8u   (%016llx)\n",
+		corpusName,
+		candidate->name,
+		rounds * corpus->bytes / elapsed / 1e6,
+		1e9 * elapsed / (rounds * corpus->count),
+		chiSquared / (buckets - 1),
+		collisions,
+		maximumLoad,
+		(unsigned long long) checksum);
+}
+
+/**
+ * The entry-point of the benchmark.
+ */
+int main(const int count, const char ** arguments) {
+	const Candidate candidates[] = {
+		{ "murmur-oaat", _murmurOneAtATime },
+		{ "fnv-1a", _fnv1a },
+		{ "wyhash", _wyhash }
+	};
+	const size_t candidateCount = sizeof(candidates) / sizeof(Candidate);
+
+	Corpus programs = { NULL, NULL, 0, 0, 0 };
+	for (int k = 1; k < count; ++k) {
+		_loadProgram(&programs, arguments[k]);
+	}
+	_removeDuplicates(&programs);
+
+	Corpus generated = { NULL, NULL, 0, 0, 0 };
+	const char * prefixes[] = { "tree", "value", "flag", "index" };
+	char identifier[32];
+	for (unsigned int k = 0; k < SYNTHESIZED_IDENTIFIERS; ++k) {
+		const int length = sprintf(identifier, "%s%u", prefixes[k % 4], k / 4);
+		_addIdentifier(&generated, identifier, length);
+	}
+
+	printf("Hashing %zu distinct identifiers of %d program(s), and %zu generated ones.\n\n", programs.count, count - 1, generated.count);
+	printf("%-10s %-14s %10s %10s %12s %10s %8s\n", "Corpus", "Hash", "MB/s", "ns/id", "Chi2/dof", "Collisions", "Max");
+	for (size_t k = 0; k < candidateCount; ++k) {
+		if (0 < programs.count) {
+			_benchmark("programs", &programs, &candidates[k]);
+		}
+		_benchmark("generated", &generated, &candidates[k]);
+	}
+	_destroyCorpus(&programs);
+	_destroyCorpus(&generated);
+	return 0;
+}
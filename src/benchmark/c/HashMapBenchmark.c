@@ -0,0 +1,201 @@
+#include "../../main/c/backend/semantic-analysis/hashMap.h"
+#include "Benchmark.h"
+#include "LegacyHashMap.h"
+
+/**
+ * Compares the SwissTable-style hash map of the semantic-analysis with the
+ * previous one (linear probing, with an allocation per key and value), on
+ * insertions, successful and unsuccessful lookups, removals, and a mix of
+ * them, and reports the length of the probes of both.
+ */
+
+#define ENTRIES 200000
+#define RUNS 3
+
+/**
+ * The operations of a hash map, so both implementations run the same code.
+ */
+typedef struct {
+	const char * name;
+	void * (*init)(uint64_t keySize, uint64_t valueSize, hashFp prehash, keyEqualsFp keyEquals);
+	void (*insertOrUpdate)(void * hm, tAny key, tAny value);
+	bool (*remove)(void * hm, tAny key);
+	bool (*find)(void * hm, tAny key, tAny value);
+	void (*statistics)(void * hm, hashMapStats * stats);
+	void (*destroy)(void * hm);
+} HashMapOperations;
+
+/**
+ * The accumulated cost of an operation over every run.
+ */
+typedef struct {
+	double seconds;
+	unsigned long long operations;
+	unsigned long long allocations;
+} Measure;
+
+/* PRIVATE FUNCTIONS */
+
+static uint64_t _mix(uint64_t value);
+static uint64_t _keyHash(tAny key);
+static void _measure(Measure * measure, const double start, const AllocationCounters since, const unsigned long long operations);
+static void _printMeasure(const char * operation, const Measure * measure);
+static void _printStatistics(const char * moment, const hashMapStats * stats);
+static void _benchmark(const HashMapOperations * operations);
+
+/**
+ * The finalizer of MurmurHash3, used to generate keys and to hash them.
+ *
+ * @see https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+ */
+static uint64_t _mix(uint64_t value) {
+	value ^= value >> 33;
+	value *= 0xff51afd7ed558ccd;
+	value ^= value >> 33;
+	value *= 0xc4ceb9fe1a85ec53;
+	value ^= value >> 33;
+	return value;
+}
+
+static uint64_t _keyHash(tAny key) {
+	return _mix(*(uint64_t *) key);
+}
+
+/**
+ * Accumulates the time and the allocations of a batch of operations.
+ */
+static void _measure(Measure * measure, const double start, const AllocationCounters since, const unsigned long long operations) {
+	measure->seconds += currentSeconds() - start;
+	measure->allocations += allocationCountersSince(since).allocations;
+	measure->operations += operations;
+}
+
+static void _printMeasure(const char * operation, const Measure * measure) {
+	printf("    %-12s %12.2f %14.3f\n",
+		operation,
+		1e9 * measure->seconds / measure->operations,
+		(double) measure->allocations / measure->operations);
+}
+
+static void _printStatistics(const char * moment, const hashMapStats * stats) {
+	printf("    %-12s %12llu %12llu %12llu %14.3f %10llu\n",
+		moment,
+		(unsigned long long) stats->size,
+		(unsigned long long) stats->capacity,
+		(unsigned long long) stats->tombstones,
+		stats->size == 0 ? 0.0 : (double) stats->totalProbeLength / stats->size,
+		(unsigned long long) stats->maximumProbeLength);
+}
+
+/**
+ * Runs every operation over an implementation. Keys are pseudo-random, and the
+ * missing ones are disjoint with the present ones.
+ */
+static void _benchmark(const HashMapOperations * operations) {
+	Measure insertion = { 0, 0, 0 };
+	Measure hit = { 0, 0, 0 };
+	Measure miss = { 0, 0, 0 };
+	Measure removal = { 0, 0, 0 };
+	Measure mixed = { 0, 0, 0 };
+	hashMapStats filled;
+	hashMapStats churned;
+	uint64_t checksum = 0;
+	for (unsigned int run = 0; run < RUNS; ++run) {
+		void * hm = operations->init(sizeof(uint64_t), sizeof(uint64_t), _keyHash, NULL);
+		AllocationCounters since = currentAllocationCounters();
+		double start = currentSeconds();
+		for (uint64_t k = 0; k < ENTRIES; ++k) {
+			uint64_t key = _mix(2 * k);
+			operations->insertOrUpdate(hm, &key, &k);
+		}
+		_measure(&insertion, start, since, ENTRIES);
+		operations->statistics(hm, &filled);
+
+		since = currentAllocationCounters();
+		start = currentSeconds();
+		for (uint64_t k = 0; k < ENTRIES; ++k) {
+			uint64_t key = _mix(2 * k);
+			uint64_t value;
+			checksum += operations->find(hm, &key, &value) ? value : 0;
+		}
+		_measure(&hit, start, since, ENTRIES);
+
+		since = currentAllocationCounters();
+		start = currentSeconds();
+		for (uint64_t k = 0; k < ENTRIES; ++k) {
+			uint64_t key = _mix(2 * k + 1);
+			checksum += operations->find(hm, &key, NULL);
+		}
+		_measure(&miss, start, since, ENTRIES);
+
+		since = currentAllocationCounters();
+		start = currentSeconds();
+		for (uint64_t k = 0; k < ENTRIES; ++k) {
+			uint64_t key = _mix(2 * k);
+			checksum += operations->remove(hm, &key);
+		}
+		_measure(&removal, start, since, ENTRIES);
+
+		// Half of the operations are lookups, and the rest insert or remove
+		// keys of a space twice as big as the table.
+		since = currentAllocationCounters();
+		start = currentSeconds();
+		for (uint64_t k = 0; k < 4 * ENTRIES; ++k) {
+			const uint64_t random = _mix(k + 0x5eed);
+			uint64_t key = _mix(random % (2 * ENTRIES));
+			switch (random >> 62) {
+				case 0:
+				case 1:
+					checksum += operations->find(hm, &key, NULL);
+					break;
+				case 2:
+					operations->insertOrUpdate(hm, &key, &k);
+					break;
+				default:
+					checksum += operations->remove(hm, &key);
+			}
+		}
+		_measure(&mixed, start, since, 4 * ENTRIES);
+		operations->statistics(hm, &churned);
+		operations->destroy(hm);
+	}
+	printf("%s (checksum %llu)\n\n", operations->name, (unsigned long long) checksum);
+	printf("    %-12s %12s %14s\n", "Operation", "ns/op", "Allocs/op");
+	_printMeasure("insert", &insertion);
+	_printMeasure("find-hit", &hit);
+	_printMeasure("find-miss", &miss);
+	_printMeasure("remove", &removal);
+	_printMeasure("mixed", &mixed);
+	printf("\n    %-12s %12s %12s %12s %14s %10s\n", "Table", "Size", "Capacity", "Tombstones", "Probe (avg)", "Probe (max)");
+	_printStatistics("filled", &filled);
+	_printStatistics("churned", &churned);
+	printf("\n");
+}
+
+/**
+ * The entry-point of the benchmark.
+ */
+int main(const int count, const char ** arguments) {
+	const HashMapOperations swissTable = {
+		.name = "SwissTable (probes in groups of 16 slots)",
+		.init = (void * (*)(uint64_t, uint64_t, hashFp, keyEqualsFp)) hashMapInit,
+		.insertOrUpdate = (void (*)(void *, tAny, tAny)) hashMapInsertOrUpdate,
+		.remove = (bool (*)(void *, tAny)) hashMapRemove,
+		.find = (bool (*)(void *, tAny, tAny)) hashMapFind,
+		.statistics = (void (*)(void *, hashMapStats *)) hashMapStatistics,
+		.destroy = (void (*)(void *)) hashMapDestroy
+	};
+	const HashMapOperations legacy = {
+		.name = "Legacy (probes in slots)",
+		.init = (void * (*)(uint64_t, uint64_t, hashFp, keyEqualsFp)) legacyHashMapInit,
+		.insertOrUpdate = (void (*)(void *, tAny, tAny)) legacyHashMapInsertOrUpdate,
+		.remove = (bool (*)(void *, tAny)) legacyHashMapRemove,
+		.find = (bool (*)(void *, tAny, tAny)) legacyHashMapFind,
+		.statistics = (void (*)(void *, hashMapStats *)) legacyHashMapStatistics,
+		.destroy = (void (*)(void *)) legacyHashMapDestroy
+	};
+	printf("%d entries of 8-byte keys and values, %d times per implementation.\n\n", ENTRIES, RUNS);
+	_benchmark(&swissTable);
+	_benchmark(&legacy);
+	return 0;
+}
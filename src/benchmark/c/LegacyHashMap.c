@@ -0,0 +1,203 @@
+/*
+ * The hash map of the semantic-analysis, as it was before the SwissTable-style
+ * rewrite, kept only to compare both implementations.
+ */
+
+#include "LegacyHashMap.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+typedef struct entry{
+    tAny key;
+    tAny value;
+    uint8_t status;
+} entry;
+
+typedef struct legacyHashMapCDT {
+    uint64_t totalSize;
+    uint64_t usedSize;
+    double threshold;
+    hashFp prehash;
+    keyEqualsFp keyEquals;
+    entry * lookup;
+    uint64_t lookupSize;
+    uint64_t keySize;
+    uint64_t valueSize;
+} legacyHashMapCDT;
+
+#define INITIAL_SIZE 20
+typedef enum {FREE = 0, USED, BRIDGE} status;
+
+legacyHashMapADT legacyHashMapInit(uint64_t keySize, uint64_t valueSize, hashFp prehash, keyEqualsFp keyEquals) {
+    legacyHashMapADT new = malloc(sizeof(legacyHashMapCDT));
+    if(new == NULL || (new->lookup = calloc(INITIAL_SIZE, sizeof(entry))) == NULL) {
+        free(new);
+        return NULL;
+    }
+    new->totalSize = 0;
+    new->usedSize = 0;
+    new->threshold = 0.75;
+    new->prehash = prehash;
+    new->keyEquals = keyEquals;
+    new->lookupSize = INITIAL_SIZE;
+    new->keySize = keySize;
+    new->valueSize = valueSize;
+    return new;
+}
+
+static uint64_t hash(legacyHashMapADT hm, tAny key) {
+    return hm->prehash(key) % hm->lookupSize;
+}
+
+static void resize(legacyHashMapADT hm) {
+    entry * oldTable = hm->lookup;
+    hm->lookup = calloc(hm->lookupSize*2, sizeof(entry));
+    if(hm->lookup == NULL){
+        hm->lookup = oldTable;
+        return;
+    }
+    uint64_t oldSize = hm->lookupSize;
+    hm->lookupSize *= 2;
+    hm->totalSize = 0;
+    hm->usedSize = 0;
+    for(uint64_t i = 0; i < oldSize; i++) {
+        if(oldTable[i].status == USED) {
+            legacyHashMapInsertOrUpdate(hm, oldTable[i].key, oldTable[i].value);
+            free(oldTable[i].key);
+            free(oldTable[i].value);
+        }
+    }
+    free(oldTable);
+}
+
+void legacyHashMapInsertOrUpdate(legacyHashMapADT hm, tAny key, tAny value) {
+    if(hm == NULL || key == NULL || value == NULL) {
+        return;
+    }
+
+    bool updated = legacyHashMapRemove(hm, key);
+
+    // ===== CREATE NEW ENTRY =====
+    entry newEntry;
+
+    newEntry.key = malloc(hm->keySize);
+    memcpy(newEntry.key, key, hm->keySize);
+
+    newEntry.value = malloc(hm->valueSize);
+    memcpy(newEntry.value, value, hm->valueSize);
+
+    newEntry.status = USED;
+    // =====
+
+    uint64_t pos = hash(hm, key);
+    bool found = false;
+    if(hm->lookup[pos].status == USED) {
+        for(uint64_t i = 1; i < hm->lookupSize && !found; i++) {
+            uint64_t index = (pos+i) % hm->lookupSize;
+            if(hm->lookup[index].status != USED) {
+                pos = index;
+                found = true;
+            }
+        }
+    }
+    hm->usedSize++;
+    if(!updated) {
+        hm->totalSize++;
+    }
+    hm->lookup[pos] = newEntry;
+    bool mustResize = ((double)hm->usedSize/hm->lookupSize) > hm->threshold;
+    if(mustResize) {
+        resize(hm);
+    }
+}
+
+static bool keyEquals(legacyHashMapADT hm, tAny key1, tAny key2) {
+    if(hm->keyEquals != NULL) {
+        return hm->keyEquals(key1, key2);
+    }
+    return memcmp(key1, key2, hm->keySize) == 0;
+}
+
+bool legacyHashMapRemove(legacyHashMapADT hm, tAny key) {
+    if(key == NULL) return false;
+
+    uint64_t pos = hash(hm, key);
+    for(uint64_t i = 0; i < hm->lookupSize; i++) {
+        uint64_t index = (pos + i) % hm->lookupSize;
+        entry * aux = &hm->lookup[index];
+        if(aux->status == FREE) {
+            return false;
+        }
+        if(aux->status == USED && keyEquals(hm, aux->key, key)) {
+            if(hm->lookup[(index+1) % hm->lookupSize].status == FREE) {
+                aux->status = FREE;
+                hm->totalSize--;
+            } else {
+                aux->status = BRIDGE;
+            }
+            free(aux->key);
+            free(aux->value);
+            hm->usedSize--;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool legacyHashMapFind(legacyHashMapADT hm, tAny key, tAny value) {
+    if(key == NULL) return false;
+
+    uint64_t pos = hash(hm, key);
+    for(uint64_t i = 0; i < hm->lookupSize; i++) {
+        uint64_t index = (pos + i) % hm->lookupSize;
+        entry * aux = &hm->lookup[index];
+        if(aux->status == FREE) return false;
+        if(aux->status == USED && keyEquals(hm, aux->key, key)) {
+            if(value != NULL) {
+                memcpy(value, aux->value, hm->valueSize);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t legacyHashMapSize(legacyHashMapADT hm) {
+    return hm->usedSize;
+}
+
+void legacyHashMapStatistics(legacyHashMapADT hm, legacyHashMapStats * stats) {
+    stats->size = hm->usedSize;
+    stats->capacity = hm->lookupSize;
+    stats->tombstones = 0;
+    stats->totalProbeLength = 0;
+    stats->maximumProbeLength = 0;
+    for(uint64_t i = 0; i < hm->lookupSize; i++) {
+        entry * aux = &hm->lookup[i];
+        if(aux->status == BRIDGE) {
+            stats->tombstones++;
+        }
+        else if(aux->status == USED) {
+            uint64_t length = 1 + (i + hm->lookupSize - hash(hm, aux->key)) % hm->lookupSize;
+            stats->totalProbeLength += length;
+            if(stats->maximumProbeLength < length) {
+                stats->maximumProbeLength = length;
+            }
+        }
+    }
+}
+
+void legacyHashMapDestroy(legacyHashMapADT hm) {
+    for(uint64_t i = 0; i < hm->lookupSize; i++) {
+        entry * aux = &hm->lookup[i];
+        if(aux->status == USED) {
+            free(aux->key);
+            free(aux->value);
+        }
+    }
+    free(hm->lookup);
+    free(hm);
+}
+
@@ -0,0 +1,29 @@
+#ifndef LEGACY_HASHMAP_H
+#define LEGACY_HASHMAP_H
+
+#include "../../main/c/backend/semantic-analysis/hashMap.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+// The length of a probe is the number of slots visited to find a key.
+typedef hashMapStats legacyHashMapStats;
+
+typedef struct legacyHashMapCDT * legacyHashMapADT;
+
+legacyHashMapADT legacyHashMapInit(uint64_t keySize, uint64_t valueSize, hashFp prehash, keyEqualsFp keyEquals);
+
+void legacyHashMapInsertOrUpdate(legacyHashMapADT hm, tAny key, tAny value);
+
+bool legacyHashMapRemove(legacyHashMapADT hm, tAny key);
+
+bool legacyHashMapFind(legacyHashMapADT hm, tAny key, tAny value);
+
+uint64_t legacyHashMapSize(legacyHashMapADT hm);
+
+void legacyHashMapStatistics(legacyHashMapADT hm, legacyHashMapStats * stats);
+
+void legacyHashMapDestroy(legacyHashMapADT hm);
+
+#endif
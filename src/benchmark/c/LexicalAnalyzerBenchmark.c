@@ -0,0 +1,102 @@
+#include "../../main/c/frontend/lexical-analysis/FlexActions.h"
+#include "../../main/c/frontend/lexical-analysis/LexicalAnalyzerContext.h"
+#include "../../main/c/shared/Logger.h"
+#include "Benchmark.h"
+
+/**
+ * Compares the throughput of the lexical-analyzer when every lexeme is copied
+ * into heap-memory, against the zero-copy slices over the Flex buffer.
+ */
+
+#define BLOCKS 20000
+#define RUNS 3
+
+/** Flex imported functions. */
+
+extern void * flexCreateScanner(LexicalAnalyzerState * lexicalAnalyzerState, char * buffer, const size_t size);
+extern void flexDestroyScanner(void * scanner);
+extern int yylex(union SemanticValue * semanticValue, void * scanner);
+
+/* PRIVATE FUNCTIONS */
+
+static void _generateProgram(SourceBuffer * sourceBuffer);
+static void _benchmark(const char * name, const boolean zeroCopyLexemes, SourceBuffer * sourceBuffer);
+
+/**
+ * Synthesizes a program that exercises every kind of lexeme, including
+ * comments and whitespace.
+ */
+static void _generateProgram(SourceBuffer * sourceBuffer) {
+	for (unsigned int k = 0; k < BLOCKS; ++k) {
+		appendToSourceBuffer(sourceBuffer, "/* Generated block number %u. */\n", k);
+		appendToSourceBuffer(sourceBuffer, "AVLTree tree%u\n", k);
+		appendToSourceBuffer(sourceBuffer, "for index%u in (0 to 100) { tree%u insert index%u * 3 + 7 }\n", k, k, k);
+		appendToSourceBuffer(sourceBuffer, "Int value%u = 1 + 2 * (3 - 4) %% 5\n", k);
+		appendToSourceBuffer(sourceBuffer, "Boolean flag%u = value%u >= 10 & true | !false\n", k, k);
+		appendToSourceBuffer(sourceBuffer, "if (flag%u) { tree%u remove 12 } else { tree%u insert 99 }\n", k, k, k);
+		appendToSourceBuffer(sourceBuffer, "tree%u iterate in-order\n\n", k);
+	}
+}
+
+/**
+ * Lexes the whole program several times, and reports the throughput and the
+ * memory requested to the allocator.
+ */
+static void _benchmark(const char * name, const boolean zeroCopyLexemes, SourceBuffer * sourceBuffer) {
+	setenv("ZERO_COPY_LEXEMES", zeroCopyLexemes ? "true" : "false", 1);
+	initializeLexicalAnalyzerContextModule();
+	unsigned long long tokens = 0;
+	double elapsed = 0;
+	AllocationCounters allocationCounters = { 0, 0 };
+	// Flex scans in place, so the buffer needs two trailing null characters.
+	char * buffer = calloc(sourceBuffer->length + 2, sizeof(char));
+	memcpy(buffer, sourceBuffer->content, sourceBuffer->length);
+	for (unsigned int run = 0; run < RUNS; ++run) {
+		CompilerState compilerState = { .arena = createArena() };
+		compilerState.internTable = createInternTable(compilerState.arena);
+		LexicalAnalyzerState lexicalAnalyzerState = { .compilerState = &compilerState };
+		void * scanner = flexCreateScanner(&lexicalAnalyzerState, buffer, sourceBuffer->length + 2);
+		union SemanticValue semanticValue;
+		const AllocationCounters since = currentAllocationCounters();
+		const double start = currentSeconds();
+		for (Token token = yylex(&semanticValue, scanner); token != 0; token = yylex(&semanticValue, scanner)) {
+			++tokens;
+		}
+		elapsed += currentSeconds() - start;
+		const AllocationCounters delta = allocationCountersSince(since);
+		allocationCounters.allocations += delta.allocations;
+		allocationCounters.bytes += delta.bytes;
+		flexDestroyScanner(scanner);
+		destroyInternTable(compilerState.internTable);
+		destroyArena(compilerState.arena);
+	}
+	free(buffer);
+	printf("%-12s %12llu %14.0f %14llu %14llu %10.2f\n",
+		name,
+		tokens / RUNS,
+		tokens / elapsed,
+		allocationCounters.allocations / RUNS,
+		allocationCounters.bytes / RUNS,
+		(double) allocationCounters.bytes / tokens);
+}
+
+/**
+ * The entry-point of the benchmark.
+ */
+int main(const int count, const char ** arguments) {
+	initializeArenaModule();
+	initializeInternTableModule();
+	initializeFlexActionsModule();
+	SourceBuffer sourceBuffer = { NULL, 0, 0 };
+	_generateProgram(&sourceBuffer);
+	printf("Lexing %zu bytes, %d times per mode (identifiers are interned into an arena).\n\n", sourceBuffer.length, RUNS);
+	printf("%-12s %12s %14s %14s %14s %10s\n", "Mode", "Tokens/run", "Tokens/sec", "Allocs/run", "Bytes/run", "Bytes/tok");
+	_benchmark("heap-copy", false, &sourceBuffer);
+	_benchmark("zero-copy", true, &sourceBuffer);
+	destroySourceBuffer(&sourceBuffer);
+	shutdownLexicalAnalyzerContextModule();
+	shutdownFlexActionsModule();
+	shutdownInternTableModule();
+	shutdownArenaModule();
+	return 0;
+}
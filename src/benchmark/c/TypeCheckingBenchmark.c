@@ -0,0 +1,113 @@
+#include "../../main/c/frontend/lexical-analysis/FlexActions.h"
+#include "../../main/c/frontend/lexical-analysis/LexicalAnalyzerContext.h"
+#include "../../main/c/frontend/lexical-analysis/SourceCode.h"
+#include "../../main/c/frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../main/c/frontend/syntactic-analysis/BisonActions.h"
+#include "../../main/c/frontend/syntactic-analysis/SyntacticAnalyzer.h"
+#include "../../main/c/shared/Arena.h"
+#include "../../main/c/shared/InternTable.h"
+#include "../../main/c/shared/Logger.h"
+#include "Benchmark.h"
+
+/**
+ * Measures the cost of parsing (and type-checking) a single long expression,
+ * with an increasing number of terms. Since the type of every expression is
+ * resolved once, when its node is built, the time per term should stay flat.
+ */
+
+#define MAXIMUM_TERMS 100000
+#define RUNS 3
+
+/* PRIVATE FUNCTIONS */
+
+static void _synthesizeProgram(SourceBuffer * sourceBuffer, const unsigned int terms);
+static void _benchmark(const unsigned int terms);
+
+/**
+ * Synthesizes a program with an integer and a boolean left-deep chain, of
+ * the given number of terms each.
+ */
+static void _synthesizeProgram(SourceBuffer * sourceBuffer, const unsigned int terms) {
+	appendToSourceBuffer(sourceBuffer, "Int value = 1");
+	for (unsigned int k = 1; k < terms; ++k) {
+		appendToSourceBuffer(sourceBuffer, k % 2 == 0 ? " + %u" : " * %u", k % 10);
+	}
+	appendToSourceBuffer(sourceBuffer, "\nBoolean flag = true");
+	for (unsigned int k = 1; k < terms; ++k) {
+		appendToSourceBuffer(sourceBuffer, k % 2 == 0 ? " & %s" : " | %s", k % 3 == 0 ? "true" : "!false");
+	}
+	appendToSourceBuffer(sourceBuffer, "\n");
+}
+
+/**
+ * Parses the program several times, and reports the average elapsed time, in
+ * total and per term.
+ */
+static void _benchmark(const unsigned int terms) {
+	SourceBuffer sourceBuffer = { NULL, 0, 0 };
+	_synthesizeProgram(&sourceBuffer, terms);
+	// Flex scans in place, so the content needs two trailing null characters.
+	SourceCode sourceCode = {
+		.content = calloc(sourceBuffer.length + 2, sizeof(char)),
+		.length = sourceBuffer.length,
+		.capacity = sourceBuffer.length + 2,
+		.mapped = false
+	};
+	memcpy(sourceCode.content, sourceBuffer.content, sourceBuffer.length);
+	double parsing = 0;
+	for (unsigned int run = 0; run < RUNS; ++run) {
+		CompilerState compilerState = {
+			.abstractSyntaxtTree = NULL,
+			.arena = createArena(),
+			.internTable = NULL,
+			.succeed = false,
+			.className = "Main",
+			.outputFile = NULL,
+			.scanner = NULL,
+			.semanticErrors = 0,
+			.sourceCode = &sourceCode,
+			.symbolTable = NULL,
+			.usedSymbols = NULL,
+			.value = 0
+		};
+		const double start = currentSeconds();
+		const SyntacticAnalysisStatus syntacticAnalysisStatus = parse(&compilerState);
+		parsing += currentSeconds() - start;
+		if (syntacticAnalysisStatus != ACCEPT) {
+			fprintf(stderr, "The synthesized program was rejected.\n");
+			exit(1);
+		}
+		destroyAbstractSyntaxTree(compilerState.abstractSyntaxtTree);
+		destroyInternTable(compilerState.internTable);
+		destroyArena(compilerState.arena);
+	}
+	printf("%12u %12.2f %14.2f\n", terms, 1000 * parsing / RUNS, 1e9 * parsing / RUNS / (2.0 * terms));
+	free(sourceCode.content);
+	destroySourceBuffer(&sourceBuffer);
+}
+
+/**
+ * The entry-point of the benchmark.
+ */
+int main(const int count, const char ** arguments) {
+	initializeArenaModule();
+	initializeInternTableModule();
+	initializeLexicalAnalyzerContextModule();
+	initializeFlexActionsModule();
+	initializeBisonActionsModule();
+	initializeSyntacticAnalyzerModule();
+	initializeAbstractSyntaxTreeModule();
+	printf("Parsing 2 expressions per program, %d times per size.\n\n", RUNS);
+	printf("%12s %12s %14s\n", "Terms", "Parse (ms)", "ns/term");
+	for (unsigned int terms = MAXIMUM_TERMS / 8; terms <= MAXIMUM_TERMS; terms *= 2) {
+		_benchmark(terms);
+	}
+	shutdownAbstractSyntaxTreeModule();
+	shutdownSyntacticAnalyzerModule();
+	shutdownBisonActionsModule();
+	shutdownFlexActionsModule();
+	shutdownLexicalAnalyzerContextModule();
+	shutdownInternTableModule();
+	shutdownArenaModule();
+	return 0;
+}
@@ -0,0 +1,111 @@
+#include "../../main/c/frontend/lexical-analysis/FlexActions.h"
+#include "../../main/c/frontend/lexical-analysis/LexicalAnalyzerContext.h"
+#include "../../main/c/frontend/lexical-analysis/SourceCode.h"
+#include "../../main/c/frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../main/c/frontend/syntactic-analysis/BisonActions.h"
+#include "../../main/c/frontend/syntactic-analysis/SyntacticAnalyzer.h"
+#include "../../main/c/shared/Arena.h"
+#include "../../main/c/shared/InternTable.h"
+#include "../../main/c/shared/Logger.h"
+#include "Benchmark.h"
+
+/**
+ * Measures the cost of parsing (and validating) programs with an increasing
+ * number of variables, all of them used in expressions. Since each use is
+ * checked against a hash set of the used symbols, the time per variable
+ * should stay flat.
+ */
+
+#define MAXIMUM_VARIABLES 100000
+#define RUNS 3
+
+/* PRIVATE FUNCTIONS */
+
+static void _synthesizeProgram(SourceBuffer * sourceBuffer, const unsigned int variables);
+static void _benchmark(const unsigned int variables);
+
+/**
+ * Synthesizes a program that declares the given number of variables, and then
+ * reads every one of them (twice) in the initialization of another one.
+ */
+static void _synthesizeProgram(SourceBuffer * sourceBuffer, const unsigned int variables) {
+	for (unsigned int k = 0; k < variables; ++k) {
+		appendToSourceBuffer(sourceBuffer, "Int value%u = %u\n", k, k % 10);
+	}
+	for (unsigned int k = 0; k < variables; ++k) {
+		appendToSourceBuffer(sourceBuffer, "Int sum%u = value%u + value%u\n", k, k, (k + 1) % variables);
+	}
+}
+
+/**
+ * Parses the program several times, and reports the average elapsed time, in
+ * total and per variable.
+ */
+static void _benchmark(const unsigned int variables) {
+	SourceBuffer sourceBuffer = { NULL, 0, 0 };
+	_synthesizeProgram(&sourceBuffer, variables);
+	// Flex scans in place, so the content needs two trailing null characters.
+	SourceCode sourceCode = {
+		.content = calloc(sourceBuffer.length + 2, sizeof(char)),
+		.length = sourceBuffer.length,
+		.capacity = sourceBuffer.length + 2,
+		.mapped = false
+	};
+	memcpy(sourceCode.content, sourceBuffer.content, sourceBuffer.length);
+	double parsing = 0;
+	for (unsigned int run = 0; run < RUNS; ++run) {
+		CompilerState compilerState = {
+			.abstractSyntaxtTree = NULL,
+			.arena = createArena(),
+			.internTable = NULL,
+			.succeed = false,
+			.className = "Main",
+			.outputFile = NULL,
+			.scanner = NULL,
+			.semanticErrors = 0,
+			.sourceCode = &sourceCode,
+			.symbolTable = NULL,
+			.usedSymbols = NULL,
+			.value = 0
+		};
+		const double start = currentSeconds();
+		const SyntacticAnalysisStatus syntacticAnalysisStatus = parse(&compilerState);
+		parsing += currentSeconds() - start;
+		if (syntacticAnalysisStatus != ACCEPT) {
+			fprintf(stderr, "The synthesized program was rejected.\n");
+			exit(1);
+		}
+		destroyAbstractSyntaxTree(compilerState.abstractSyntaxtTree);
+		destroyInternTable(compilerState.internTable);
+		destroyArena(compilerState.arena);
+	}
+	printf("%12u %12.2f %14.2f\n", variables, 1000 * parsing / RUNS, 1e9 * parsing / RUNS / variables);
+	free(sourceCode.content);
+	destroySourceBuffer(&sourceBuffer);
+}
+
+/**
+ * The entry-point of the benchmark.
+ */
+int main(const int count, const char ** arguments) {
+	initializeArenaModule();
+	initializeInternTableModule();
+	initializeLexicalAnalyzerContextModule();
+	initializeFlexActionsModule();
+	initializeBisonActionsModule();
+	initializeSyntacticAnalyzerModule();
+	initializeAbstractSyntaxTreeModule();
+	printf("Parsing 2 declarations per variable, %d times per size.\n\n", RUNS);
+	printf("%12s %12s %14s\n", "Variables", "Parse (ms)", "ns/variable");
+	for (unsigned int variables = MAXIMUM_VARIABLES / 8; variables <= MAXIMUM_VARIABLES; variables *= 2) {
+		_benchmark(variables);
+	}
+	shutdownAbstractSyntaxTreeModule();
+	shutdownSyntacticAnalyzerModule();
+	shutdownBisonActionsModule();
+	shutdownFlexActionsModule();
+	shutdownLexicalAnalyzerContextModule();
+	shutdownInternTableModule();
+	shutdownArenaModule();
+	return 0;
+}
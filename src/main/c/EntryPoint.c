@@ -1,26 +1,65 @@
+#include "backend/code-generation/CGenerator.h"
+#include "backend/code-generation/ClassGenerator.h"
 #include "backend/code-generation/Generator.h"
 #include "backend/domain-specific/Calculator.h"
+#include "backend/domain-specific/NativeTree.h"
+#include "backend/intermediate-representation/IntermediateRepresentation.h"
+#include "backend/intermediate-representation/Lowering.h"
+#include "backend/intermediate-representation/PassManager.h"
+#include "backend/interpretation/Interpreter.h"
+#include "backend/optimization/BulkInsertion.h"
+#include "backend/optimization/LoopOptimization.h"
+#include "backend/optimization/DeadCodeElimination.h"
+#include "driver/BatchCompilation.h"
+#include "driver/Compilation.h"
 #include "frontend/lexical-analysis/FlexActions.h"
+#include "frontend/lexical-analysis/LexicalAnalyzerContext.h"
+#include "frontend/lexical-analysis/SourceCode.h"
 #include "frontend/syntactic-analysis/AbstractSyntaxTree.h"
 #include "frontend/syntactic-analysis/BisonActions.h"
 #include "frontend/syntactic-analysis/SyntacticAnalyzer.h"
+#include "shared/Arena.h"
 #include "shared/CompilerState.h"
+#include "shared/Configuration.h"
 #include "shared/Environment.h"
+#include "shared/InternTable.h"
 #include "shared/Logger.h"
 #include "shared/String.h"
 
 /**
- * The main entry-point of the entire application.
+ * The main entry-point of the entire application. The program is read from
+ * the file specified as the first argument or, if there is none, from the
+ * standard input. With "--batch", every program of a directory (or a list) is
+ * compiled instead. With "--run", the program is run instead of compiled, and
+ * with "--target=c", it's compiled into a C program instead of a Java class
+ * (which "--emit=class" writes as bytecode, instead of as source).
  */
 const int main(const int count, const char ** arguments) {
 	Logger * logger = createLogger("EntryPoint");
+	initializeArenaModule();
+	initializeInternTableModule();
+	initializeOutputBufferModule();
+	initializeConfigurationModule();
+	initializeSourceCodeModule();
+	initializeLexicalAnalyzerContextModule();
 	initializeFlexActionsModule();
 	initializeBisonActionsModule();
 	initializeSyntacticAnalyzerModule();
 	initializeAbstractSyntaxTreeModule();
 	initializeCalculatorModule();
+	initializeDeadCodeEliminationModule();
+	initializeIntermediateRepresentationModule();
+	initializeLoweringModule();
+	initializeLoopOptimizationModule();
+	initializeBulkInsertionModule();
+	initializePassManagerModule();
 	initializeGeneratorModule();
-	symbolTableInit();
+	initializeCGeneratorModule();
+	initializeClassGeneratorModule();
+	initializeNativeTreeModule();
+	initializeInterpreterModule();
+	initializeCompilationModule();
+	initializeBatchCompilationModule();
 
 	// Logs the arguments of the application.
 	for (int k = 0; k < count; ++k) {
@@ -28,52 +67,51 @@ const int main(const int count, const char ** arguments) {
 	}
 
 	// Begin compilation process.
-	CompilerState compilerState = {
-		.abstractSyntaxtTree = NULL,
-		.succeed = false,
-		.value = 0
-	};
-	const SyntacticAnalysisStatus syntacticAnalysisStatus = parse(&compilerState);
-	CompilationStatus compilationStatus = SUCCEED;
-	if (syntacticAnalysisStatus == ACCEPT) {
-		logDebugging(logger, "Computing expression value...");
-		Program * program = compilerState.abstractSyntaxtTree;
-		// ComputationResult computationResult = computeExpression(program->expression);
-		// if (computationResult.succeed) {
-		// 	compilerState.value = computationResult.value;
-			FILE * file = fopen("./src/main/c/backend/domain-specific/src/main/java/Main.java", "w");
-            SetOutputFile(file);
-
-			generate(&compilerState);
-
-            fclose(file);
-
-			// system("mvn -f ./src/main/c/backend/domain-specific/pom.xml clean compile");
-                
-            // // Run the generated file
-            // system("mvn -f ./src/main/c/backend/domain-specific/pom.xml exec:java -Dexec.mainClass=\"Main\"");
-
-		// }
-		// else {
-		// 	logError(logger, "The computation phase rejects the input program.");
-		// 	compilationStatus = FAILED;
-		// }
-		logDebugging(logger, "Releasing AST resources...");
-		releaseProgram(program);
-	}
-	else {
-		logError(logger, "The syntactic-analysis phase rejects the input program.");
-		compilationStatus = FAILED;
+	CompilationStatus compilationStatus = FAILED;
+	Configuration * configuration = createConfiguration(count, arguments);
+	if (configuration != NULL) {
+		if (configuration->batch != NULL) {
+			compilationStatus = compileBatch(configuration);
+		}
+		else {
+			char * outputPath = concatenate(3, configuration->outputDirectory, "/Main", targetExtension(configuration->target));
+			char * irPath = configuration->dumpIntermediateRepresentation
+				? concatenate(2, configuration->outputDirectory, "/Main.ir")
+				: NULL;
+			compilationStatus = configuration->run
+				? run(configuration->input, irPath, stdout)
+				: compile(configuration->input, outputPath, "Main", irPath, configuration->target);
+			free(irPath);
+			free(outputPath);
+		}
+		destroyConfiguration(configuration);
 	}
 
 	logDebugging(logger, "Releasing modules resources...");
-	symbolTableDestroy();
+	shutdownBatchCompilationModule();
+	shutdownCompilationModule();
+	shutdownInterpreterModule();
+	shutdownNativeTreeModule();
+	shutdownClassGeneratorModule();
+	shutdownCGeneratorModule();
 	shutdownGeneratorModule();
+	shutdownPassManagerModule();
+	shutdownBulkInsertionModule();
+	shutdownLoopOptimizationModule();
+	shutdownLoweringModule();
+	shutdownIntermediateRepresentationModule();
+	shutdownDeadCodeEliminationModule();
 	shutdownCalculatorModule();
 	shutdownAbstractSyntaxTreeModule();
 	shutdownSyntacticAnalyzerModule();
 	shutdownBisonActionsModule();
 	shutdownFlexActionsModule();
+	shutdownLexicalAnalyzerContextModule();
+	shutdownSourceCodeModule();
+	shutdownConfigurationModule();
+	shutdownOutputBufferModule();
+	shutdownInternTableModule();
+	shutdownArenaModule();
 	logDebugging(logger, "Compilation is done.");
 	destroyLogger(logger);
 	return compilationStatus;
@@ -0,0 +1,474 @@
+#include "CGenerator.h"
+
+/* MODULE INTERNAL STATE */
+
+static const char _indentationCharacter = ' ';
+static const char _indentationSize = 4;
+static const unsigned int _maximumIndentationLevel = 32;
+static Logger * _logger = NULL;
+
+void initializeCGeneratorModule() {
+	_logger = createLogger("CGenerator");
+}
+
+void shutdownCGeneratorModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * The trees (and lists) declared in the open blocks, which are released when
+ * their block is closed, since C has no garbage collector.
+ */
+typedef struct {
+	IrVariableIndex * variables;
+	uint32_t count;
+	uint32_t * marks;
+	uint32_t depth;
+} Scopes;
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _isCall(const IrOpcode opcode);
+static int _precedence(const IrOpcode opcode);
+static boolean _needsParentheses(IntermediateRepresentation * intermediateRepresentation, const IrInstruction * instruction, const unsigned int operand);
+static const char * _function(const IrOpcode opcode);
+static void _generateAtom(CompilerState * compilerState, const IrOperand * operand);
+static void _generateVariable(CompilerState * compilerState, const IrVariableIndex variable);
+static void _generateOperand(CompilerState * compilerState, const IrOperand * operand);
+static boolean _generateOperandOf(CompilerState * compilerState, NodeStack * nodeStack, const IrInstruction * instruction, const unsigned int operand);
+static void _generateDeclaration(CompilerState * compilerState, const unsigned int indentationLevel, const IrVariableIndex variable);
+static void _generateRelease(CompilerState * compilerState, const unsigned int indentationLevel, Scopes * scopes);
+static void _generateTreeCall(CompilerState * compilerState, const unsigned int indentationLevel, const IrInstruction * instruction);
+static void _generateEpilogue(CompilerState * compilerState);
+static boolean _generateProgram(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation);
+static void _generatePrologue(CompilerState * compilerState);
+static void _output(CompilerState * compilerState, const unsigned int indentationLevel, const char * const string);
+
+/**
+ * Returns true if an operation is generated as a call to the runtime (i.e.,
+ * the arithmetic, which must wrap around, and throw on a division by zero, as
+ * in Java).
+ */
+static boolean _isCall(const IrOpcode opcode) {
+	return _function(opcode) != NULL;
+}
+
+/**
+ * Returns the precedence of an operation in C (higher binds tighter). The
+ * calls to the runtime bind the tightest.
+ */
+static int _precedence(const IrOpcode opcode) {
+	switch (opcode) {
+		case IR_OR: return 1;
+		case IR_AND: return 2;
+		case IR_EQUAL:
+		case IR_NOT_EQUAL: return 3;
+		case IR_LESS:
+		case IR_LESS_EQUAL:
+		case IR_GREATER:
+		case IR_GREATER_EQUAL: return 4;
+		case IR_NOT: return 5;
+		default:
+			return 6;
+	}
+}
+
+/**
+ * Returns true if an operand of an infix operation must be parenthesized,
+ * that is, if it's an operation that binds looser (or as loose, on the right,
+ * since every binary operator is left-associative). The arguments of a call
+ * never are.
+ */
+static boolean _needsParentheses(IntermediateRepresentation * intermediateRepresentation, const IrInstruction * instruction, const unsigned int operand) {
+	if (!isIrOperation(instruction->opcode) || _isCall(instruction->opcode) || instruction->operands[operand].kind != IR_TEMPORARY_OPERAND) {
+		return false;
+	}
+	const int precedence = _precedence(instruction->opcode);
+	const int operandPrecedence = _precedence(intermediateRepresentation->instructions[instruction->operands[operand].temporary].opcode);
+	return operandPrecedence < precedence || (operand == 1 && operandPrecedence == precedence);
+}
+
+/**
+ * Returns the function of the runtime that implements an arithmetic
+ * operation, or a tree (or list) operation. Returns NULL for the other
+ * operations, which are generated as C operators.
+ */
+static const char * _function(const IrOpcode opcode) {
+	switch (opcode) {
+		case IR_ADD: return "tlaAdd";
+		case IR_SUBTRACT: return "tlaSubtract";
+		case IR_MULTIPLY: return "tlaMultiply";
+		case IR_DIVIDE: return "tlaDivide";
+		case IR_MODULO: return "tlaModulo";
+		case IR_INSERT: return "tlaInsert";
+		case IR_INSERT_ALL: return "tlaInsertAll";
+		case IR_REMOVE: return "tlaRemove";
+		case IR_INCLUDES: return "tlaIncludes";
+		case IR_HEIGHT: return "tlaHeight";
+		case IR_DEPTH: return "tlaDepth";
+		case IR_CALCULATE: return "tlaCalculate";
+		case IR_VISUALIZE: return "tlaVisualize";
+		case IR_INORDER: return "tlaInorder";
+		case IR_PREORDER: return "tlaPreorder";
+		case IR_POSTORDER: return "tlaPostorder";
+		case IR_APPEND: return "tlaAppend";
+		default:
+			return NULL;
+	}
+}
+
+/**
+ * Generates an operand that is not a temporary. The smallest integer has no
+ * literal in C (since "2147483648" does not fit an "int").
+ */
+static void _generateAtom(CompilerState * compilerState, const IrOperand * operand) {
+	switch (operand->kind) {
+		case IR_CONSTANT_OPERAND:
+			if (operand->type == IR_BOOLEAN) {
+				_output(compilerState, 0, operand->constant ? "true" : "false");
+			}
+			else if (operand->constant == INT_MIN) {
+				_output(compilerState, 0, "INT_MIN");
+			}
+			else {
+				appendInteger(compilerState->outputBuffer, operand->constant);
+			}
+			break;
+		case IR_STRING_OPERAND:
+			appendCharacter(compilerState->outputBuffer, '"');
+			appendString(compilerState->outputBuffer, operand->string);
+			appendCharacter(compilerState->outputBuffer, '"');
+			break;
+		case IR_VARIABLE_OPERAND:
+			_generateVariable(compilerState, operand->variable);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * Generates the name of a variable. The ones made by the compiler have an
+ * underscore followed by their index, and the ones of the program a trailing
+ * underscore, so none of them clashes with a keyword of C, or with the
+ * runtime.
+ */
+static void _generateVariable(CompilerState * compilerState, const IrVariableIndex variable) {
+	IntermediateRepresentation * intermediateRepresentation = compilerState->intermediateRepresentation;
+	const IrVariable * irVariable = &intermediateRepresentation->variables[variable];
+	appendString(compilerState->outputBuffer, irVariable->name);
+	appendCharacter(compilerState->outputBuffer, '_');
+	if (irVariable->synthetic) {
+		appendUnsigned(compilerState->outputBuffer, variable);
+	}
+}
+
+/**
+ * Generates an operand as a C expression: every temporary is generated where
+ * it's used, from the instruction that defines it. The operations are walked
+ * in-order with an explicit stack, so any depth of nesting is supported.
+ */
+static void _generateOperand(CompilerState * compilerState, const IrOperand * operand) {
+	IntermediateRepresentation * intermediateRepresentation = compilerState->intermediateRepresentation;
+	if (operand->kind != IR_TEMPORARY_OPERAND) {
+		_generateAtom(compilerState, operand);
+		return;
+	}
+	NodeStack nodeStack;
+	initializeNodeStack(&nodeStack);
+	boolean succeed = pushNodeFrame(&nodeStack, operand->temporary, 0);
+	while (succeed && !isNodeStackEmpty(&nodeStack)) {
+		NodeFrame * frame = peekNodeFrame(&nodeStack);
+		const IrInstruction * instruction = &intermediateRepresentation->instructions[frame->index];
+		const uint32_t stage = frame->stage++;
+		const boolean operation = isIrOperation(instruction->opcode);
+		const boolean call = !operation || _isCall(instruction->opcode);
+		if (stage == 0) {
+			if (!operation) {
+				appendString(compilerState->outputBuffer, _function(instruction->opcode));
+				appendCharacter(compilerState->outputBuffer, '(');
+				_generateVariable(compilerState, instruction->variable);
+				_output(compilerState, 0, instruction->operands[0].kind == IR_NO_OPERAND ? "" : ", ");
+			}
+			else if (call) {
+				appendString(compilerState->outputBuffer, _function(instruction->opcode));
+				appendCharacter(compilerState->outputBuffer, '(');
+			}
+			else if (instruction->opcode == IR_NOT) {
+				appendCharacter(compilerState->outputBuffer, '!');
+			}
+			succeed = _generateOperandOf(compilerState, &nodeStack, instruction, 0);
+		}
+		else if (stage == 1) {
+			if (_needsParentheses(intermediateRepresentation, instruction, 0)) {
+				appendCharacter(compilerState->outputBuffer, ')');
+			}
+			if (instruction->operands[1].kind == IR_NO_OPERAND) {
+				_output(compilerState, 0, call ? ")" : "");
+				popNodeFrame(&nodeStack);
+			}
+			else if (call) {
+				_output(compilerState, 0, ", ");
+				succeed = _generateOperandOf(compilerState, &nodeStack, instruction, 1);
+			}
+			else {
+				appendCharacter(compilerState->outputBuffer, ' ');
+				appendString(compilerState->outputBuffer, irOperationSymbol(instruction->opcode));
+				appendCharacter(compilerState->outputBuffer, ' ');
+				succeed = _generateOperandOf(compilerState, &nodeStack, instruction, 1);
+			}
+		}
+		else {
+			if (_needsParentheses(intermediateRepresentation, instruction, 1)) {
+				appendCharacter(compilerState->outputBuffer, ')');
+			}
+			_output(compilerState, 0, call ? ")" : "");
+			popNodeFrame(&nodeStack);
+		}
+	}
+	finalizeNodeStack(&nodeStack);
+}
+
+/**
+ * Generates an operand of an instruction, within "_generateOperand": an atom
+ * is generated at once, and a temporary is pushed to the stack. Returns false
+ * if there is no memory left.
+ */
+static boolean _generateOperandOf(CompilerState * compilerState, NodeStack * nodeStack, const IrInstruction * instruction, const unsigned int operand) {
+	if (_needsParentheses(compilerState->intermediateRepresentation, instruction, operand)) {
+		appendCharacter(compilerState->outputBuffer, '(');
+	}
+	if (instruction->operands[operand].kind == IR_TEMPORARY_OPERAND) {
+		return pushNodeFrame(nodeStack, instruction->operands[operand].temporary, 0);
+	}
+	_generateAtom(compilerState, &instruction->operands[operand]);
+	return true;
+}
+
+/**
+ * Generates the declaration of a tree (or list), which starts empty.
+ */
+static void _generateDeclaration(CompilerState * compilerState, const unsigned int indentationLevel, const IrVariableIndex variable) {
+	IntermediateRepresentation * intermediateRepresentation = compilerState->intermediateRepresentation;
+	const IrType type = intermediateRepresentation->variables[variable].type;
+	_output(compilerState, indentationLevel, type == IR_LIST ? "TlaList * " : "NativeTree * ");
+	_generateVariable(compilerState, variable);
+	switch (type) {
+		case IR_AVL_TREE:
+			_output(compilerState, 0, " = tlaCreateTree(NATIVE_AVL_TREE);\n");
+			break;
+		case IR_BST_TREE:
+			_output(compilerState, 0, " = tlaCreateTree(NATIVE_BST_TREE);\n");
+			break;
+		case IR_RBT_TREE:
+			_output(compilerState, 0, " = tlaCreateTree(NATIVE_RBT_TREE);\n");
+			break;
+		case IR_EXP_TREE:
+			_output(compilerState, 0, " = tlaCreateTree(NATIVE_EXP_TREE);\n");
+			break;
+		case IR_LIST:
+			_output(compilerState, 0, " = tlaCreateList();\n");
+			break;
+		default:
+			logError(_logger, "The variable cannot be declared empty: %u", variable);
+			break;
+	}
+}
+
+/**
+ * Generates the release of every tree (and list) declared in the innermost
+ * open block, which is left empty.
+ */
+static void _generateRelease(CompilerState * compilerState, const unsigned int indentationLevel, Scopes * scopes) {
+	IntermediateRepresentation * intermediateRepresentation = compilerState->intermediateRepresentation;
+	const uint32_t mark = scopes->marks[scopes->depth - 1];
+	while (mark < scopes->count) {
+		const IrVariableIndex variable = scopes->variables[--scopes->count];
+		_output(compilerState, indentationLevel, intermediateRepresentation->variables[variable].type == IR_LIST ? "tlaDestroyList(" : "tlaDestroyTree(");
+		_generateVariable(compilerState, variable);
+		_output(compilerState, 0, ");\n");
+	}
+}
+
+/**
+ * Generates a tree (or list) operation as a statement.
+ */
+static void _generateTreeCall(CompilerState * compilerState, const unsigned int indentationLevel, const IrInstruction * instruction) {
+	if (isIrOperation(instruction->opcode) || _function(instruction->opcode) == NULL) {
+		logError(_logger, "Unknown instruction: %s", irOpcodeName(instruction->opcode));
+		return;
+	}
+	_output(compilerState, indentationLevel, _function(instruction->opcode));
+	appendCharacter(compilerState->outputBuffer, '(');
+	_generateVariable(compilerState, instruction->variable);
+	if (instruction->operands[0].kind != IR_NO_OPERAND) {
+		_output(compilerState, 0, ", ");
+		_generateOperand(compilerState, &instruction->operands[0]);
+	}
+	_output(compilerState, 0, ");\n");
+}
+
+/**
+ * Creates the epilogue of the generated output, that is, the final lines that
+ * completes a valid C program.
+ */
+static void _generateEpilogue(CompilerState * compilerState) {
+	_output(compilerState, 1, "return tlaStop();\n");
+	_output(compilerState, 0, "}\n");
+}
+
+/**
+ * Generates the output of the program, a statement at a time (the operations
+ * are generated within the statements that use them). An "int" (or "boolean")
+ * declaration is held until the next statement, so it takes its initial value
+ * if that statement is the first store. Returns false if there is no memory
+ * left.
+ */
+static boolean _generateProgram(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation) {
+	Scopes scopes = {
+		.variables = malloc((intermediateRepresentation->instructionCount + 1) * sizeof(IrVariableIndex)),
+		.count = 0,
+		.marks = malloc((intermediateRepresentation->instructionCount + 1) * sizeof(uint32_t)),
+		.depth = 1
+	};
+	if (scopes.variables == NULL || scopes.marks == NULL) {
+		logCritical(_logger, "Cannot allocate the blocks of a program of %u instruction(s).", intermediateRepresentation->instructionCount);
+		free(scopes.variables);
+		free(scopes.marks);
+		return false;
+	}
+	scopes.marks[0] = 0;
+	_output(compilerState, 0, "int main() {\n");
+	_output(compilerState, 1, "tlaStart();\n");
+	unsigned int indentationLevel = 1;
+	IrVariableIndex declaration = IR_NO_VARIABLE;
+	for (IrInstructionIndex k = 0; k < intermediateRepresentation->instructionCount; ++k) {
+		const IrInstruction * instruction = &intermediateRepresentation->instructions[k];
+		if (instruction->type != IR_VOID) {
+			continue;
+		}
+		const boolean initialization = instruction->opcode == IR_STORE && instruction->variable == declaration;
+		if (declaration != IR_NO_VARIABLE && !initialization) {
+			_output(compilerState, indentationLevel, intermediateRepresentation->variables[declaration].type == IR_BOOLEAN ? "boolean " : "int ");
+			_generateVariable(compilerState, declaration);
+			_output(compilerState, 0, ";\n");
+			declaration = IR_NO_VARIABLE;
+		}
+		switch (instruction->opcode) {
+			case IR_DECLARE: {
+				const IrType type = intermediateRepresentation->variables[instruction->variable].type;
+				if (type == IR_INTEGER || type == IR_BOOLEAN) {
+					declaration = instruction->variable;
+				}
+				else {
+					_generateDeclaration(compilerState, indentationLevel, instruction->variable);
+					scopes.variables[scopes.count++] = instruction->variable;
+				}
+				break;
+			}
+			case IR_STORE:
+				if (initialization) {
+					_output(compilerState, indentationLevel, intermediateRepresentation->variables[declaration].type == IR_BOOLEAN ? "boolean " : "int ");
+					declaration = IR_NO_VARIABLE;
+				}
+				else {
+					_output(compilerState, indentationLevel, "");
+				}
+				_generateVariable(compilerState, instruction->variable);
+				_output(compilerState, 0, " = ");
+				_generateOperand(compilerState, &instruction->operands[0]);
+				_output(compilerState, 0, ";\n");
+				break;
+			case IR_IF:
+				scopes.marks[scopes.depth++] = scopes.count;
+				_output(compilerState, indentationLevel++, "if (");
+				_generateOperand(compilerState, &instruction->operands[0]);
+				_output(compilerState, 0, ") {\n");
+				break;
+			case IR_ELSE:
+				_generateRelease(compilerState, indentationLevel, &scopes);
+				_output(compilerState, indentationLevel - 1, "} else {\n");
+				break;
+			case IR_FOR:
+				scopes.marks[scopes.depth++] = scopes.count;
+				_output(compilerState, indentationLevel++, "for (int ");
+				_generateVariable(compilerState, instruction->variable);
+				_output(compilerState, 0, " = ");
+				_generateOperand(compilerState, &instruction->operands[0]);
+				_output(compilerState, 0, "; ");
+				_generateVariable(compilerState, instruction->variable);
+				_output(compilerState, 0, " < ");
+				_generateOperand(compilerState, &instruction->operands[1]);
+				_output(compilerState, 0, "; ");
+				_generateVariable(compilerState, instruction->variable);
+				_output(compilerState, 0, "++) {\n");
+				break;
+			case IR_END_IF:
+			case IR_END_FOR:
+				_generateRelease(compilerState, indentationLevel, &scopes);
+				--scopes.depth;
+				_output(compilerState, --indentationLevel, "}\n");
+				break;
+			default:
+				_generateTreeCall(compilerState, indentationLevel, instruction);
+				break;
+		}
+	}
+	if (declaration != IR_NO_VARIABLE) {
+		_output(compilerState, indentationLevel, intermediateRepresentation->variables[declaration].type == IR_BOOLEAN ? "boolean " : "int ");
+		_generateVariable(compilerState, declaration);
+		_output(compilerState, 0, ";\n");
+	}
+	_generateRelease(compilerState, indentationLevel, &scopes);
+	free(scopes.variables);
+	free(scopes.marks);
+	return true;
+}
+
+/**
+ * Generates the prologue of the generated output, starting a valid C program.
+ */
+static void _generatePrologue(CompilerState * compilerState) {
+	_output(compilerState, 0, "#include \"TlaRuntime.h\"\n");
+	_output(compilerState, 0, "\n");
+}
+
+/**
+ * Outputs an indented string to the output buffer of the compilation. Deeper
+ * blocks are not indented any further, so the output stays linear in the
+ * program.
+ */
+static void _output(CompilerState * compilerState, const unsigned int indentationLevel, const char * const string) {
+	appendIndentation(compilerState->outputBuffer, indentationLevel);
+	appendString(compilerState->outputBuffer, string);
+}
+
+/* PUBLIC FUNCTIONS */
+
+boolean generateC(CompilerState * compilerState) {
+	logDebugging(_logger, "Generating final output...");
+	IntermediateRepresentation * intermediateRepresentation = compilerState->intermediateRepresentation;
+	IrVariableIndex variable = IR_NO_VARIABLE;
+	const IrInstructionIndex operation = irTreeOperation(intermediateRepresentation, &variable);
+	if (operation < intermediateRepresentation->instructionCount) {
+		logError(_logger, "The program cannot be compiled into C, since it operates on a whole tree: \"%s\" (%s)",
+			intermediateRepresentation->variables[variable].name, irOpcodeName(intermediateRepresentation->instructions[operation].opcode));
+		return false;
+	}
+	compilerState->outputBuffer = createOutputBuffer(compilerState->outputFile, _indentationCharacter, _indentationSize, _maximumIndentationLevel);
+	if (compilerState->outputBuffer == NULL) {
+		return false;
+	}
+	_generatePrologue(compilerState);
+	boolean succeed = _generateProgram(compilerState, intermediateRepresentation);
+	if (succeed) {
+		_generateEpilogue(compilerState);
+		succeed = flushOutputBuffer(compilerState->outputBuffer);
+	}
+	destroyOutputBuffer(compilerState->outputBuffer);
+	compilerState->outputBuffer = NULL;
+	logDebugging(_logger, "Generation is done.");
+	return succeed;
+}
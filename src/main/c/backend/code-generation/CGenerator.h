@@ -0,0 +1,29 @@
+#ifndef C_GENERATOR_HEADER
+#define C_GENERATOR_HEADER
+
+#include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../shared/CompilerState.h"
+#include "../../shared/Logger.h"
+#include "../../shared/OutputBuffer.h"
+#include "../intermediate-representation/IntermediateRepresentation.h"
+#include <limits.h>
+#include <stdio.h>
+
+/** Initialize module's internal state. */
+void initializeCGeneratorModule();
+
+/** Shutdown module's internal state. */
+void shutdownCGeneratorModule();
+
+/**
+ * Generates the final output from the IR of the current compiler state, as a
+ * standalone C program written into "outputFile", which is linked against the
+ * runtime of the native trees (the static library "TlaRuntime").
+ *
+ * Returns false if the program operates on whole trees (e.g., "c = a + b",
+ * which has no counterpart in the runtime), if there is no memory left, or if
+ * the output cannot be written.
+ */
+boolean generateC(CompilerState * compilerState);
+
+#endif
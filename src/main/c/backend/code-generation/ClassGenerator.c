@@ -0,0 +1,1220 @@
+#include "ClassGenerator.h"
+
+/* MODULE INTERNAL STATE */
+
+/**
+ * The class file format, and the opcodes of the bytecode that the generated
+ * methods use. The classes are of version 49 (i.e., Java 5), whose methods
+ * are verified by type-inference, so they need no "StackMapTable".
+ *
+ * @see https://docs.oracle.com/javase/specs/jvms/se17/html/jvms-4.html
+ * @see https://docs.oracle.com/javase/specs/jvms/se17/html/jvms-6.html
+ */
+static const uint32_t _magic = 0xCAFEBABE;
+static const uint16_t _majorVersion = 49;
+static const uint16_t _minorVersion = 0;
+static const uint16_t _publicAccess = 0x0001;
+static const uint16_t _privateAccess = 0x0002;
+static const uint16_t _staticAccess = 0x0008;
+static const uint16_t _superAccess = 0x0020;
+static const uint32_t _maximumCodeLength = 65535;
+static const uint32_t _maximumIndex = 65535;
+
+// The IR instructions of each method of a long program (see "Generator"), so
+// the methods stay under the 8000 bytes of bytecode that HotSpot compiles.
+static const uint32_t _chunkSize = 600;
+
+typedef enum {
+	CONSTANT_UTF8 = 1,
+	CONSTANT_INTEGER = 3,
+	CONSTANT_CLASS = 7,
+	CONSTANT_STRING = 8,
+	CONSTANT_FIELD_REFERENCE = 9,
+	CONSTANT_METHOD_REFERENCE = 10,
+	CONSTANT_NAME_AND_TYPE = 12
+} ConstantTag;
+
+typedef enum {
+	ICONST_0 = 0x03,
+	BIPUSH = 0x10,
+	SIPUSH = 0x11,
+	LDC = 0x12,
+	LDC_W = 0x13,
+	ILOAD = 0x15,
+	ALOAD = 0x19,
+	ILOAD_0 = 0x1A,
+	ALOAD_0 = 0x2A,
+	ISTORE = 0x36,
+	ASTORE = 0x3A,
+	ISTORE_0 = 0x3B,
+	ASTORE_0 = 0x4B,
+	POP = 0x57,
+	POP2 = 0x58,
+	DUP = 0x59,
+	IADD = 0x60,
+	ISUB = 0x64,
+	IMUL = 0x68,
+	IDIV = 0x6C,
+	IREM = 0x70,
+	IXOR = 0x82,
+	IINC = 0x84,
+	D2I = 0x8E,
+	IFEQ = 0x99,
+	IFNE = 0x9A,
+	IF_ICMPEQ = 0x9F,
+	IF_ICMPNE = 0xA0,
+	IF_ICMPLT = 0xA1,
+	IF_ICMPGE = 0xA2,
+	IF_ICMPGT = 0xA3,
+	IF_ICMPLE = 0xA4,
+	GOTO = 0xA7,
+	RETURN = 0xB1,
+	GETSTATIC = 0xB2,
+	PUTSTATIC = 0xB3,
+	INVOKEVIRTUAL = 0xB6,
+	INVOKESPECIAL = 0xB7,
+	INVOKESTATIC = 0xB8,
+	NEW = 0xBB,
+	WIDE = 0xC4,
+	GOTO_W = 0xC8
+} Opcode;
+
+/**
+ * A method of the runtime (or of the JDK), and the change of the operand
+ * stack of its invocation (the receiver included).
+ */
+typedef struct {
+	const char * owner;
+	const char * name;
+	const char * descriptor;
+	int stackDelta;
+} Method;
+
+static const Method _arrayListAdd = { "java/util/ArrayList", "add", "(Ljava/lang/Object;)Z", -1 };
+static const Method _integerValueOf = { "java/lang/Integer", "valueOf", "(I)Ljava/lang/Integer;", 0 };
+static const Method _objectConstructor = { "java/lang/Object", "<init>", "()V", -1 };
+static const Method _treeMethods[] = {
+	[IR_INSERT] = { "Tree", "insert", "(Ljava/lang/Comparable;)V", -2 },
+	[IR_INSERT_ALL] = { "Tree", "insertAll", "(Ljava/util/List;)V", -2 },
+	[IR_REMOVE] = { "Tree", "remove", "(Ljava/lang/Comparable;)V", -2 },
+	[IR_INCLUDES] = { "Tree", "includes", "(Ljava/lang/Comparable;)Z", -1 },
+	[IR_HEIGHT] = { "Tree", "height", "()I", 0 },
+	[IR_DEPTH] = { "Tree", "depth", "(Ljava/lang/Comparable;)I", -1 },
+	[IR_CALCULATE] = { "EXP", "calculate", "(Ljava/lang/String;)D", 0 },
+	[IR_VISUALIZE] = { "Tree", "visualize", "()V", -1 },
+	[IR_INORDER] = { "Tree", "inorder", "()V", -1 },
+	[IR_PREORDER] = { "Tree", "preorder", "()V", -1 },
+	[IR_POSTORDER] = { "Tree", "postorder", "()V", -1 }
+};
+// The methods of the trees of integers, whose owner is the class of the tree.
+static const Method _intTreeMethods[] = {
+	[IR_INSERT] = { NULL, "insert", "(I)V", -2 },
+	[IR_INSERT_ALL] = { NULL, "insertAll", "(Ljava/util/List;)V", -2 },
+	[IR_REMOVE] = { NULL, "remove", "(I)V", -2 },
+	[IR_INCLUDES] = { NULL, "includes", "(I)Z", -1 },
+	[IR_HEIGHT] = { NULL, "height", "()I", 0 },
+	[IR_DEPTH] = { NULL, "depth", "(I)I", -1 },
+	[IR_VISUALIZE] = { NULL, "visualize", "()V", -1 },
+	[IR_INORDER] = { NULL, "inorder", "()V", -1 },
+	[IR_PREORDER] = { NULL, "preorder", "()V", -1 },
+	[IR_POSTORDER] = { NULL, "postorder", "()V", -1 }
+};
+
+// Whether the AVL and RBT trees keep their nodes in pools of arrays, instead
+// of objects (which is an alternative engine, enabled with "POOLED_TREES").
+static boolean _pooledTrees = false;
+
+static Logger * _logger = NULL;
+
+void initializeClassGeneratorModule() {
+	_pooledTrees = getBooleanOrDefault("POOLED_TREES", _pooledTrees);
+	_logger = createLogger("ClassGenerator");
+}
+
+void shutdownClassGeneratorModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * A growable sequence of bytes (e.g., the constant pool, or the code).
+ */
+typedef struct {
+	uint8_t * bytes;
+	uint32_t length;
+	uint32_t capacity;
+} Bytes;
+
+/**
+ * The key of an entry of the constant pool: its tag, and its content (the
+ * interned string of an UTF-8 entry, or the indexes of the entries it refers
+ * to).
+ */
+typedef struct {
+	uint64_t tag;
+	uint64_t value;
+} ConstantKey;
+
+/**
+ * The state of the generation of a class. The pending values are a stack of
+ * the branches (and the scopes) that are still open, either in a block, or in
+ * the expression being generated.
+ */
+typedef struct {
+	CompilerState * compilerState;
+	IntermediateRepresentation * intermediateRepresentation;
+
+	Bytes pool;
+	uint32_t constantCount;
+	hashMapADT constants;
+
+	Bytes code;
+	int32_t stackDepth;
+	int32_t maximumStackDepth;
+
+	// The local of each variable, and its chunk (or "IR_SHARED_CHUNK", if it's
+	// a field).
+	uint32_t * slots;
+	uint32_t * chunks;
+	uint32_t nextSlot;
+	uint32_t maximumSlots;
+
+	uint32_t * pending;
+	uint32_t pendingCount;
+	uint32_t pendingCapacity;
+
+	// True if some byte could not be allocated.
+	boolean exhausted;
+
+	// True if some index (or branch) exceeds the limits of the class format.
+	boolean overflowed;
+} ClassWriter;
+
+/* PRIVATE FUNCTIONS */
+
+static uint64_t _constantKeyHash(tAny key);
+static bool _constantKeyEquals(tAny left, tAny right);
+static void _append(ClassWriter * classWriter, Bytes * bytes, const void * data, const uint32_t length);
+static void _u1(ClassWriter * classWriter, Bytes * bytes, const uint8_t value);
+static void _u2(ClassWriter * classWriter, Bytes * bytes, const uint16_t value);
+static void _u4(ClassWriter * classWriter, Bytes * bytes, const uint32_t value);
+static void _write(ClassWriter * classWriter, Bytes * bytes, const uint32_t position, const uint32_t value, const unsigned int size);
+static void _push(ClassWriter * classWriter, const uint32_t value);
+static uint32_t _pop(ClassWriter * classWriter);
+static uint16_t _register(ClassWriter * classWriter, const ConstantKey * key);
+static uint16_t _utf8(ClassWriter * classWriter, const char * string);
+static uint16_t _class(ClassWriter * classWriter, const char * name);
+static uint16_t _string(ClassWriter * classWriter, const char * string);
+static uint16_t _integer(ClassWriter * classWriter, const int value);
+static uint16_t _nameAndType(ClassWriter * classWriter, const char * name, const char * descriptor);
+static uint16_t _memberReference(ClassWriter * classWriter, const ConstantTag tag, const char * owner, const char * name, const char * descriptor);
+static uint16_t _methodReference(ClassWriter * classWriter, const Method * method);
+static const char * _fieldName(ClassWriter * classWriter, const IrVariableIndex variable);
+static const char * _descriptor(const IrType type);
+static uint16_t _fieldReference(ClassWriter * classWriter, const IrVariableIndex variable);
+static void _instruction(ClassWriter * classWriter, const uint8_t opcode, const int stackDelta);
+static void _constant(ClassWriter * classWriter, const uint16_t index);
+static void _integerConstant(ClassWriter * classWriter, const int value);
+static void _local(ClassWriter * classWriter, const uint8_t opcode, const uint8_t shortOpcode, const uint32_t slot, const int stackDelta);
+static void _increment(ClassWriter * classWriter, const uint32_t slot);
+static void _load(ClassWriter * classWriter, const IrVariableIndex variable);
+static void _store(ClassWriter * classWriter, const IrVariableIndex variable);
+static void _invoke(ClassWriter * classWriter, const uint8_t opcode, const Method * method);
+static void _new(ClassWriter * classWriter, const char * className);
+static uint32_t _branch(ClassWriter * classWriter, const uint8_t opcode, const int stackDelta);
+static uint32_t _exitBranch(ClassWriter * classWriter, const uint8_t opcode, const int stackDelta);
+static void _patch(ClassWriter * classWriter, const uint32_t branch);
+static void _jump(ClassWriter * classWriter, const uint32_t target);
+static uint8_t _opcode(const IrOpcode opcode);
+static boolean _boxes(const IrOpcode opcode);
+static const char * _intTreeClass(const IrType type);
+static void _invokeTreeMethod(ClassWriter * classWriter, const IrInstruction * instruction);
+static void _generateAtom(ClassWriter * classWriter, const IrOperand * operand);
+static void _generateOperand(ClassWriter * classWriter, const IrOperand * operand);
+static boolean _generateOperandOf(ClassWriter * classWriter, NodeStack * nodeStack, const IrInstruction * instruction, const unsigned int operand);
+static void _generateDeclaration(ClassWriter * classWriter, const IrVariableIndex variable);
+static void _generateTreeCall(ClassWriter * classWriter, const IrInstruction * instruction);
+static void _reset(ClassWriter * classWriter, const uint32_t firstSlot);
+static void _generateCode(ClassWriter * classWriter, const IrInstructionIndex start, const IrInstructionIndex end, const uint32_t firstSlot);
+static void _generateCalls(ClassWriter * classWriter, const uint32_t chunkCount);
+static boolean _fits(ClassWriter * classWriter, const char * name);
+static void _generateMethod(ClassWriter * classWriter, Bytes * bytes, const uint16_t access, const char * name, const char * descriptor, const uint16_t maximumStackDepth, const uint16_t maximumSlots, const Bytes * code);
+static void _generateFields(ClassWriter * classWriter, Bytes * bytes);
+static boolean _generateClass(ClassWriter * classWriter);
+
+/**
+ * Hashes (and compares) the keys of the constant pool.
+ */
+static uint64_t _constantKeyHash(tAny key) {
+	return hashBytes(key, sizeof(ConstantKey), 0);
+}
+
+static bool _constantKeyEquals(tAny left, tAny right) {
+	return memcmp(left, right, sizeof(ConstantKey)) == 0;
+}
+
+/**
+ * Appends bytes, growing the sequence geometrically.
+ */
+static void _append(ClassWriter * classWriter, Bytes * bytes, const void * data, const uint32_t length) {
+	if (bytes->capacity - bytes->length < length) {
+		uint32_t capacity = bytes->capacity == 0 ? 256 : bytes->capacity;
+		while (capacity - bytes->length < length) {
+			capacity *= 2;
+		}
+		uint8_t * grownBytes = realloc(bytes->bytes, capacity);
+		if (grownBytes == NULL) {
+			logCritical(_logger, "Cannot allocate %u byte(s) of the class.", capacity);
+			classWriter->exhausted = true;
+			return;
+		}
+		bytes->bytes = grownBytes;
+		bytes->capacity = capacity;
+	}
+	memcpy(bytes->bytes + bytes->length, data, length);
+	bytes->length += length;
+}
+
+/**
+ * Appends an unsigned integer of 1, 2 or 4 bytes, in big-endian.
+ */
+static void _u1(ClassWriter * classWriter, Bytes * bytes, const uint8_t value) {
+	_append(classWriter, bytes, &value, 1);
+}
+
+static void _u2(ClassWriter * classWriter, Bytes * bytes, const uint16_t value) {
+	const uint8_t data[2] = { value >> 8, value };
+	_append(classWriter, bytes, data, 2);
+}
+
+static void _u4(ClassWriter * classWriter, Bytes * bytes, const uint32_t value) {
+	const uint8_t data[4] = { value >> 24, value >> 16, value >> 8, value };
+	_append(classWriter, bytes, data, 4);
+}
+
+/**
+ * Overwrites an unsigned integer of 2 or 4 bytes, in big-endian.
+ */
+static void _write(ClassWriter * classWriter, Bytes * bytes, const uint32_t position, const uint32_t value, const unsigned int size) {
+	if (classWriter->exhausted) {
+		return;
+	}
+	for (unsigned int k = 0; k < size; ++k) {
+		bytes->bytes[position + k] = value >> (8 * (size - 1 - k));
+	}
+}
+
+/**
+ * Pushes (and pops) a pending value.
+ */
+static void _push(ClassWriter * classWriter, const uint32_t value) {
+	if (classWriter->pendingCount == classWriter->pendingCapacity) {
+		const uint32_t capacity = classWriter->pendingCapacity == 0 ? 64 : 2 * classWriter->pendingCapacity;
+		uint32_t * pending = realloc(classWriter->pending, capacity * sizeof(uint32_t));
+		if (pending == NULL) {
+			logCritical(_logger, "Cannot allocate %u pending branch(es).", capacity);
+			classWriter->exhausted = true;
+			return;
+		}
+		classWriter->pending = pending;
+		classWriter->pendingCapacity = capacity;
+	}
+	classWriter->pending[classWriter->pendingCount++] = value;
+}
+
+static uint32_t _pop(ClassWriter * classWriter) {
+	return classWriter->pendingCount == 0 ? 0 : classWriter->pending[--classWriter->pendingCount];
+}
+
+/**
+ * Registers the entry that was just appended to the constant pool, and
+ * returns its index.
+ */
+static uint16_t _register(ClassWriter * classWriter, const ConstantKey * key) {
+	const uint32_t index = classWriter->constantCount++;
+	if (_maximumIndex < index) {
+		classWriter->overflowed = true;
+		return 0;
+	}
+	uint16_t value = (uint16_t) index;
+	hashMapInsertOrUpdate(classWriter->constants, (tAny) key, &value);
+	return value;
+}
+
+/**
+ * Returns the index of an entry of the constant pool, which is appended if
+ * it's new.
+ */
+static uint16_t _utf8(ClassWriter * classWriter, const char * string) {
+	const char * internedString = internString(classWriter->compilerState->internTable, string, strlen(string));
+	if (internedString == NULL) {
+		classWriter->exhausted = true;
+		return 0;
+	}
+	const ConstantKey key = { CONSTANT_UTF8, (uint64_t) (uintptr_t) internedString };
+	uint16_t index = 0;
+	if (hashMapFind(classWriter->constants, (tAny) &key, &index)) {
+		return index;
+	}
+	const size_t length = internedStringLength(internedString);
+	if (_maximumIndex < length) {
+		classWriter->overflowed = true;
+		return 0;
+	}
+	_u1(classWriter, &classWriter->pool, CONSTANT_UTF8);
+	_u2(classWriter, &classWriter->pool, (uint16_t) length);
+	_append(classWriter, &classWriter->pool, internedString, (uint32_t) length);
+	return _register(classWriter, &key);
+}
+
+static uint16_t _class(ClassWriter * classWriter, const char * name) {
+	const uint16_t nameIndex = _utf8(classWriter, name);
+	const ConstantKey key = { CONSTANT_CLASS, nameIndex };
+	uint16_t index = 0;
+	if (hashMapFind(classWriter->constants, (tAny) &key, &index)) {
+		return index;
+	}
+	_u1(classWriter, &classWriter->pool, CONSTANT_CLASS);
+	_u2(classWriter, &classWriter->pool, nameIndex);
+	return _register(classWriter, &key);
+}
+
+static uint16_t _string(ClassWriter * classWriter, const char * string) {
+	const uint16_t stringIndex = _utf8(classWriter, string);
+	const ConstantKey key = { CONSTANT_STRING, stringIndex };
+	uint16_t index = 0;
+	if (hashMapFind(classWriter->constants, (tAny) &key, &index)) {
+		return index;
+	}
+	_u1(classWriter, &classWriter->pool, CONSTANT_STRING);
+	_u2(classWriter, &classWriter->pool, stringIndex);
+	return _register(classWriter, &key);
+}
+
+static uint16_t _integer(ClassWriter * classWriter, const int value) {
+	const ConstantKey key = { CONSTANT_INTEGER, (uint32_t) value };
+	uint16_t index = 0;
+	if (hashMapFind(classWriter->constants, (tAny) &key, &index)) {
+		return index;
+	}
+	_u1(classWriter, &classWriter->pool, CONSTANT_INTEGER);
+	_u4(classWriter, &classWriter->pool, (uint32_t) value);
+	return _register(classWriter, &key);
+}
+
+static uint16_t _nameAndType(ClassWriter * classWriter, const char * name, const char * descriptor) {
+	const uint16_t nameIndex = _utf8(classWriter, name);
+	const uint16_t descriptorIndex = _utf8(classWriter, descriptor);
+	const ConstantKey key = { CONSTANT_NAME_AND_TYPE, ((uint64_t) nameIndex << 16) | descriptorIndex };
+	uint16_t index = 0;
+	if (hashMapFind(classWriter->constants, (tAny) &key, &index)) {
+		return index;
+	}
+	_u1(classWriter, &classWriter->pool, CONSTANT_NAME_AND_TYPE);
+	_u2(classWriter, &classWriter->pool, nameIndex);
+	_u2(classWriter, &classWriter->pool, descriptorIndex);
+	return _register(classWriter, &key);
+}
+
+/**
+ * Returns the index of a reference to a method (or to a field) of a class.
+ */
+static uint16_t _memberReference(ClassWriter * classWriter, const ConstantTag tag, const char * owner, const char * name, const char * descriptor) {
+	const uint16_t classIndex = _class(classWriter, owner);
+	const uint16_t nameAndTypeIndex = _nameAndType(classWriter, name, descriptor);
+	const ConstantKey key = { tag, ((uint64_t) classIndex << 16) | nameAndTypeIndex };
+	uint16_t index = 0;
+	if (hashMapFind(classWriter->constants, (tAny) &key, &index)) {
+		return index;
+	}
+	_u1(classWriter, &classWriter->pool, tag);
+	_u2(classWriter, &classWriter->pool, classIndex);
+	_u2(classWriter, &classWriter->pool, nameAndTypeIndex);
+	return _register(classWriter, &key);
+}
+
+static uint16_t _methodReference(ClassWriter * classWriter, const Method * method) {
+	return _memberReference(classWriter, CONSTANT_METHOD_REFERENCE, method->owner, method->name, method->descriptor);
+}
+
+/**
+ * Returns the (interned) name of the field of a variable, which is named as
+ * in the Java source. Returns NULL if there is no memory left.
+ */
+static const char * _fieldName(ClassWriter * classWriter, const IrVariableIndex variable) {
+	const IrVariable * irVariable = &classWriter->intermediateRepresentation->variables[variable];
+	const size_t length = strlen(irVariable->name);
+	char * name = malloc(length + 12);
+	if (name == NULL) {
+		classWriter->exhausted = true;
+		return NULL;
+	}
+	const int nameLength = irVariable->synthetic
+		? snprintf(name, length + 12, "%s_%u", irVariable->name, variable)
+		: snprintf(name, length + 12, "%s", irVariable->name);
+	const char * internedName = internString(classWriter->compilerState->internTable, name, (size_t) nameLength);
+	free(name);
+	if (internedName == NULL) {
+		classWriter->exhausted = true;
+	}
+	return internedName;
+}
+
+/**
+ * Returns the descriptor of the field of a variable.
+ */
+static const char * _descriptor(const IrType type) {
+	switch (type) {
+		case IR_BOOLEAN: return "Z";
+		case IR_INTEGER: return "I";
+		case IR_AVL_TREE: return _pooledTrees ? "LPooledAVL;" : "LIntAVL;";
+		case IR_BST_TREE: return "LIntBST;";
+		case IR_RBT_TREE: return _pooledTrees ? "LPooledRBT;" : "LIntRBT;";
+		case IR_EXP_TREE: return "LEXP;";
+		case IR_LIST: return "Ljava/util/ArrayList;";
+		default:
+			return "LTree;";
+	}
+}
+
+static uint16_t _fieldReference(ClassWriter * classWriter, const IrVariableIndex variable) {
+	const char * name = _fieldName(classWriter, variable);
+	if (name == NULL) {
+		return 0;
+	}
+	const IrType type = classWriter->intermediateRepresentation->variables[variable].type;
+	return _memberReference(classWriter, CONSTANT_FIELD_REFERENCE, classWriter->compilerState->className, name, _descriptor(type));
+}
+
+/**
+ * Appends an instruction without operands, and tracks the depth of the
+ * operand stack.
+ */
+static void _instruction(ClassWriter * classWriter, const uint8_t opcode, const int stackDelta) {
+	_u1(classWriter, &classWriter->code, opcode);
+	classWriter->stackDepth += stackDelta;
+	if (classWriter->maximumStackDepth < classWriter->stackDepth) {
+		classWriter->maximumStackDepth = classWriter->stackDepth;
+	}
+}
+
+/**
+ * Pushes an entry of the constant pool.
+ */
+static void _constant(ClassWriter * classWriter, const uint16_t index) {
+	if (index < 256) {
+		_instruction(classWriter, LDC, +1);
+		_u1(classWriter, &classWriter->code, (uint8_t) index);
+	}
+	else {
+		_instruction(classWriter, LDC_W, +1);
+		_u2(classWriter, &classWriter->code, index);
+	}
+}
+
+/**
+ * Pushes an integer, with the shortest instruction.
+ */
+static void _integerConstant(ClassWriter * classWriter, const int value) {
+	if (-1 <= value && value <= 5) {
+		_instruction(classWriter, ICONST_0 + value, +1);
+	}
+	else if (INT8_MIN <= value && value <= INT8_MAX) {
+		_instruction(classWriter, BIPUSH, +1);
+		_u1(classWriter, &classWriter->code, (uint8_t) value);
+	}
+	else if (INT16_MIN <= value && value <= INT16_MAX) {
+		_instruction(classWriter, SIPUSH, +1);
+		_u2(classWriter, &classWriter->code, (uint16_t) value);
+	}
+	else {
+		_constant(classWriter, _integer(classWriter, value));
+	}
+}
+
+/**
+ * Loads (or stores) a local, with the shortest instruction.
+ */
+static void _local(ClassWriter * classWriter, const uint8_t opcode, const uint8_t shortOpcode, const uint32_t slot, const int stackDelta) {
+	if (slot < 4) {
+		_instruction(classWriter, shortOpcode + slot, stackDelta);
+	}
+	else if (slot < 256) {
+		_instruction(classWriter, opcode, stackDelta);
+		_u1(classWriter, &classWriter->code, (uint8_t) slot);
+	}
+	else {
+		_instruction(classWriter, WIDE, 0);
+		_instruction(classWriter, opcode, stackDelta);
+		_u2(classWriter, &classWriter->code, (uint16_t) slot);
+	}
+}
+
+/**
+ * Increments a local (of a loop) by one.
+ */
+static void _increment(ClassWriter * classWriter, const uint32_t slot) {
+	if (slot < 256) {
+		_instruction(classWriter, IINC, 0);
+		_u1(classWriter, &classWriter->code, (uint8_t) slot);
+		_u1(classWriter, &classWriter->code, 1);
+	}
+	else {
+		_instruction(classWriter, WIDE, 0);
+		_instruction(classWriter, IINC, 0);
+		_u2(classWriter, &classWriter->code, (uint16_t) slot);
+		_u2(classWriter, &classWriter->code, 1);
+	}
+}
+
+/**
+ * Pushes (or pops into) a variable, which is either a local or a field.
+ */
+static void _load(ClassWriter * classWriter, const IrVariableIndex variable) {
+	const IrType type = classWriter->intermediateRepresentation->variables[variable].type;
+	if (classWriter->chunks[variable] == IR_SHARED_CHUNK) {
+		const uint16_t index = _fieldReference(classWriter, variable);
+		_instruction(classWriter, GETSTATIC, +1);
+		_u2(classWriter, &classWriter->code, index);
+	}
+	else if (type == IR_INTEGER || type == IR_BOOLEAN) {
+		_local(classWriter, ILOAD, ILOAD_0, classWriter->slots[variable], +1);
+	}
+	else {
+		_local(classWriter, ALOAD, ALOAD_0, classWriter->slots[variable], +1);
+	}
+}
+
+static void _store(ClassWriter * classWriter, const IrVariableIndex variable) {
+	const IrType type = classWriter->intermediateRepresentation->variables[variable].type;
+	if (classWriter->chunks[variable] == IR_SHARED_CHUNK) {
+		const uint16_t index = _fieldReference(classWriter, variable);
+		_instruction(classWriter, PUTSTATIC, -1);
+		_u2(classWriter, &classWriter->code, index);
+	}
+	else if (type == IR_INTEGER || type == IR_BOOLEAN) {
+		_local(classWriter, ISTORE, ISTORE_0, classWriter->slots[variable], -1);
+	}
+	else {
+		_local(classWriter, ASTORE, ASTORE_0, classWriter->slots[variable], -1);
+	}
+}
+
+static void _invoke(ClassWriter * classWriter, const uint8_t opcode, const Method * method) {
+	const uint16_t index = _methodReference(classWriter, method);
+	_instruction(classWriter, opcode, method->stackDelta);
+	_u2(classWriter, &classWriter->code, index);
+}
+
+/**
+ * Pushes a new instance of a class, built with its default constructor.
+ */
+static void _new(ClassWriter * classWriter, const char * className) {
+	const Method constructor = { className, "<init>", "()V", -1 };
+	const uint16_t index = _class(classWriter, className);
+	_instruction(classWriter, NEW, +1);
+	_u2(classWriter, &classWriter->code, index);
+	_instruction(classWriter, DUP, +1);
+	_invoke(classWriter, INVOKESPECIAL, &constructor);
+}
+
+/**
+ * Appends a branch whose target is patched later, and returns its position.
+ */
+static uint32_t _branch(ClassWriter * classWriter, const uint8_t opcode, const int stackDelta) {
+	const uint32_t position = classWriter->code.length;
+	_instruction(classWriter, opcode, stackDelta);
+	if (opcode == GOTO_W) {
+		_u4(classWriter, &classWriter->code, 0);
+	}
+	else {
+		_u2(classWriter, &classWriter->code, 0);
+	}
+	return position;
+}
+
+/**
+ * Appends the exit of a block, which is taken if the condition of the
+ * specified branch does not hold: the branch skips a "goto_w" to the end of
+ * the block (to be patched later), so the block can be as long as a method.
+ * Returns the position of the "goto_w".
+ */
+static uint32_t _exitBranch(ClassWriter * classWriter, const uint8_t opcode, const int stackDelta) {
+	_instruction(classWriter, opcode, stackDelta);
+	_u2(classWriter, &classWriter->code, 8);
+	return _branch(classWriter, GOTO_W, 0);
+}
+
+/**
+ * Patches a branch, so it jumps to the current position.
+ */
+static void _patch(ClassWriter * classWriter, const uint32_t branch) {
+	if (classWriter->exhausted) {
+		return;
+	}
+	const int64_t offset = (int64_t) classWriter->code.length - branch;
+	if (classWriter->code.bytes[branch] == GOTO_W) {
+		_write(classWriter, &classWriter->code, branch + 1, (uint32_t) offset, 4);
+	}
+	else if (offset <= INT16_MAX) {
+		_write(classWriter, &classWriter->code, branch + 1, (uint32_t) offset, 2);
+	}
+	else {
+		classWriter->overflowed = true;
+	}
+}
+
+/**
+ * Jumps back to a previous position.
+ */
+static void _jump(ClassWriter * classWriter, const uint32_t target) {
+	const int32_t offset = (int32_t) target - (int32_t) classWriter->code.length;
+	_instruction(classWriter, GOTO_W, 0);
+	_u4(classWriter, &classWriter->code, (uint32_t) offset);
+}
+
+/**
+ * Returns the instruction of an arithmetic operation (or the branch of a
+ * relational one, which is taken if it holds).
+ */
+static uint8_t _opcode(const IrOpcode opcode) {
+	switch (opcode) {
+		case IR_ADD: return IADD;
+		case IR_SUBTRACT: return ISUB;
+		case IR_MULTIPLY: return IMUL;
+		case IR_DIVIDE: return IDIV;
+		case IR_MODULO: return IREM;
+		case IR_EQUAL: return IF_ICMPEQ;
+		case IR_NOT_EQUAL: return IF_ICMPNE;
+		case IR_LESS: return IF_ICMPLT;
+		case IR_LESS_EQUAL: return IF_ICMPLE;
+		case IR_GREATER: return IF_ICMPGT;
+		case IR_GREATER_EQUAL: return IF_ICMPGE;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Returns true if the operand of a tree operation is an element, which a tree
+ * of the generic runtime (i.e., a "Tree") takes boxed.
+ */
+static boolean _boxes(const IrOpcode opcode) {
+	switch (opcode) {
+		case IR_INSERT:
+		case IR_REMOVE:
+		case IR_INCLUDES:
+		case IR_DEPTH:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/**
+ * Returns the class of a tree of integers (whose elements are never boxed), or
+ * NULL if the type is not one.
+ */
+static const char * _intTreeClass(const IrType type) {
+	switch (type) {
+		case IR_AVL_TREE: return _pooledTrees ? "PooledAVL" : "IntAVL";
+		case IR_BST_TREE: return "IntBST";
+		case IR_RBT_TREE: return _pooledTrees ? "PooledRBT" : "IntRBT";
+		default:
+			return NULL;
+	}
+}
+
+/**
+ * Invokes the method of a tree operation, whose receiver (and operand, if any)
+ * is on the stack. The final class of a tree of integers is invoked directly,
+ * so the JIT binds the call without a type check.
+ */
+static void _invokeTreeMethod(ClassWriter * classWriter, const IrInstruction * instruction) {
+	const char * owner = _intTreeClass(classWriter->intermediateRepresentation->variables[instruction->variable].type);
+	if (owner == NULL) {
+		if (_boxes(instruction->opcode)) {
+			_invoke(classWriter, INVOKESTATIC, &_integerValueOf);
+		}
+		_invoke(classWriter, INVOKEVIRTUAL, &_treeMethods[instruction->opcode]);
+		return;
+	}
+	Method method = _intTreeMethods[instruction->opcode];
+	method.owner = owner;
+	_invoke(classWriter, INVOKEVIRTUAL, &method);
+}
+
+/**
+ * Pushes an operand that is not a temporary. Booleans are integers (0 is
+ * false, and 1 is true), as in the JVM.
+ */
+static void _generateAtom(ClassWriter * classWriter, const IrOperand * operand) {
+	switch (operand->kind) {
+		case IR_CONSTANT_OPERAND:
+			_integerConstant(classWriter, operand->constant);
+			break;
+		case IR_STRING_OPERAND:
+			_constant(classWriter, _string(classWriter, operand->string));
+			break;
+		case IR_VARIABLE_OPERAND:
+			_load(classWriter, operand->variable);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * Pushes an operand: every temporary is generated where it's used, from the
+ * instruction that defines it, as the Java expression would compile. The
+ * operations are walked in post-order with an explicit stack, so any depth
+ * of nesting is supported. A boolean operation branches, and pushes either 0
+ * or 1 (and "&&" and "||" skip their right operand, if it's not needed).
+ */
+static void _generateOperand(ClassWriter * classWriter, const IrOperand * operand) {
+	IntermediateRepresentation * intermediateRepresentation = classWriter->intermediateRepresentation;
+	if (operand->kind != IR_TEMPORARY_OPERAND) {
+		_generateAtom(classWriter, operand);
+		return;
+	}
+	NodeStack nodeStack;
+	initializeNodeStack(&nodeStack);
+	boolean succeed = pushNodeFrame(&nodeStack, operand->temporary, 0);
+	while (succeed && !isNodeStackEmpty(&nodeStack)) {
+		NodeFrame * frame = peekNodeFrame(&nodeStack);
+		const IrInstruction * instruction = &intermediateRepresentation->instructions[frame->index];
+		const uint32_t stage = frame->stage++;
+		if (!isIrOperation(instruction->opcode)) {
+			// A query of a tree.
+			if (stage == 0) {
+				_load(classWriter, instruction->variable);
+				succeed = _generateOperandOf(classWriter, &nodeStack, instruction, 0);
+			}
+			else {
+				_invokeTreeMethod(classWriter, instruction);
+				if (instruction->opcode == IR_CALCULATE) {
+					_instruction(classWriter, D2I, -1);
+				}
+				popNodeFrame(&nodeStack);
+			}
+		}
+		else if (instruction->opcode == IR_AND || instruction->opcode == IR_OR) {
+			if (stage == 0) {
+				succeed = _generateOperandOf(classWriter, &nodeStack, instruction, 0);
+			}
+			else if (stage == 1) {
+				_push(classWriter, _branch(classWriter, instruction->opcode == IR_AND ? IFEQ : IFNE, -1));
+				succeed = _generateOperandOf(classWriter, &nodeStack, instruction, 1);
+			}
+			else {
+				// The value of the skipped operand is pushed on another path.
+				_instruction(classWriter, GOTO, 0);
+				_u2(classWriter, &classWriter->code, 4);
+				_patch(classWriter, _pop(classWriter));
+				_instruction(classWriter, instruction->opcode == IR_AND ? ICONST_0 : ICONST_0 + 1, 0);
+				popNodeFrame(&nodeStack);
+			}
+		}
+		else if (instruction->opcode == IR_NOT) {
+			if (stage == 0) {
+				succeed = _generateOperandOf(classWriter, &nodeStack, instruction, 0);
+			}
+			else {
+				_instruction(classWriter, ICONST_0 + 1, +1);
+				_instruction(classWriter, IXOR, -1);
+				popNodeFrame(&nodeStack);
+			}
+		}
+		else if (stage < 2) {
+			succeed = _generateOperandOf(classWriter, &nodeStack, instruction, stage);
+		}
+		else {
+			const uint8_t opcode = _opcode(instruction->opcode);
+			if (IF_ICMPEQ <= opcode && opcode <= IF_ICMPLE) {
+				// Pushes 1 if the branch is taken, and 0 otherwise.
+				_instruction(classWriter, opcode, -2);
+				_u2(classWriter, &classWriter->code, 7);
+				_instruction(classWriter, ICONST_0, +1);
+				_instruction(classWriter, GOTO, 0);
+				_u2(classWriter, &classWriter->code, 4);
+				_instruction(classWriter, ICONST_0 + 1, 0);
+			}
+			else {
+				_instruction(classWriter, opcode, -1);
+			}
+			popNodeFrame(&nodeStack);
+		}
+	}
+	if (!succeed) {
+		classWriter->exhausted = true;
+	}
+	finalizeNodeStack(&nodeStack);
+}
+
+/**
+ * Pushes an operand of an instruction, within "_generateOperand": an atom is
+ * pushed at once, and a temporary is pushed to the stack. Returns false if
+ * there is no memory left.
+ */
+static boolean _generateOperandOf(ClassWriter * classWriter, NodeStack * nodeStack, const IrInstruction * instruction, const unsigned int operand) {
+	if (instruction->operands[operand].kind == IR_TEMPORARY_OPERAND) {
+		return pushNodeFrame(nodeStack, instruction->operands[operand].temporary, 0);
+	}
+	_generateAtom(classWriter, &instruction->operands[operand]);
+	return true;
+}
+
+/**
+ * Assigns a local to a variable (unless it's a field). A tree (or list)
+ * starts empty, and a value is left unassigned until its first store.
+ */
+static void _generateDeclaration(ClassWriter * classWriter, const IrVariableIndex variable) {
+	if (classWriter->chunks[variable] != IR_SHARED_CHUNK) {
+		classWriter->slots[variable] = classWriter->nextSlot++;
+		if (classWriter->maximumSlots < classWriter->nextSlot) {
+			classWriter->maximumSlots = classWriter->nextSlot;
+		}
+	}
+	switch (classWriter->intermediateRepresentation->variables[variable].type) {
+		case IR_AVL_TREE:
+		case IR_BST_TREE:
+		case IR_RBT_TREE:
+			_new(classWriter, _intTreeClass(classWriter->intermediateRepresentation->variables[variable].type));
+			break;
+		case IR_EXP_TREE:
+			_new(classWriter, "EXP");
+			break;
+		case IR_LIST:
+			_new(classWriter, "java/util/ArrayList");
+			break;
+		default:
+			return;
+	}
+	_store(classWriter, variable);
+}
+
+/**
+ * Generates a tree (or list) operation as a statement, whose result (if any)
+ * is discarded.
+ */
+static void _generateTreeCall(ClassWriter * classWriter, const IrInstruction * instruction) {
+	if (isIrOperation(instruction->opcode) || IR_APPEND < instruction->opcode) {
+		logError(_logger, "Unknown instruction: %s", irOpcodeName(instruction->opcode));
+		return;
+	}
+	_load(classWriter, instruction->variable);
+	if (instruction->operands[0].kind != IR_NO_OPERAND) {
+		_generateOperand(classWriter, &instruction->operands[0]);
+	}
+	if (instruction->opcode == IR_APPEND) {
+		_invoke(classWriter, INVOKESTATIC, &_integerValueOf);
+		_invoke(classWriter, INVOKEVIRTUAL, &_arrayListAdd);
+		_instruction(classWriter, POP, -1);
+		return;
+	}
+	_invokeTreeMethod(classWriter, instruction);
+	if (instruction->opcode == IR_CALCULATE) {
+		_instruction(classWriter, POP2, -2);
+	}
+	else if (instruction->opcode == IR_INCLUDES || instruction->opcode == IR_HEIGHT || instruction->opcode == IR_DEPTH) {
+		_instruction(classWriter, POP, -1);
+	}
+}
+
+/**
+ * Starts the code of a new method, whose locals start at "firstSlot" (i.e.,
+ * after its arguments).
+ */
+static void _reset(ClassWriter * classWriter, const uint32_t firstSlot) {
+	classWriter->code.length = 0;
+	classWriter->stackDepth = 0;
+	classWriter->maximumStackDepth = 0;
+	classWriter->nextSlot = firstSlot;
+	classWriter->maximumSlots = firstSlot;
+	classWriter->pendingCount = 0;
+}
+
+/**
+ * Generates the code of a method from the statements [start, end), a
+ * statement at a time (the operations are generated within the statements
+ * that use them), whose locals start at "firstSlot". The locals of a block
+ * are reused once it's closed, as javac does.
+ */
+static void _generateCode(ClassWriter * classWriter, const IrInstructionIndex start, const IrInstructionIndex end, const uint32_t firstSlot) {
+	IntermediateRepresentation * intermediateRepresentation = classWriter->intermediateRepresentation;
+	_reset(classWriter, firstSlot);
+	for (IrInstructionIndex k = start; k < end && !classWriter->exhausted; ++k) {
+		const IrInstruction * instruction = &intermediateRepresentation->instructions[k];
+		if (instruction->type != IR_VOID) {
+			continue;
+		}
+		switch (instruction->opcode) {
+			case IR_DECLARE:
+				_generateDeclaration(classWriter, instruction->variable);
+				break;
+			case IR_STORE:
+				_generateOperand(classWriter, &instruction->operands[0]);
+				_store(classWriter, instruction->variable);
+				break;
+			case IR_IF:
+				_push(classWriter, classWriter->nextSlot);
+				_generateOperand(classWriter, &instruction->operands[0]);
+				_push(classWriter, _exitBranch(classWriter, IFNE, -1));
+				break;
+			case IR_ELSE: {
+				const uint32_t exit = _pop(classWriter);
+				const uint32_t end = _branch(classWriter, GOTO_W, 0);
+				_patch(classWriter, exit);
+				classWriter->nextSlot = _pop(classWriter);
+				_push(classWriter, classWriter->nextSlot);
+				_push(classWriter, end);
+				break;
+			}
+			case IR_END_IF:
+				_patch(classWriter, _pop(classWriter));
+				classWriter->nextSlot = _pop(classWriter);
+				break;
+			case IR_FOR: {
+				_push(classWriter, classWriter->nextSlot);
+				_generateOperand(classWriter, &instruction->operands[0]);
+				_generateDeclaration(classWriter, instruction->variable);
+				const uint32_t slot = classWriter->slots[instruction->variable];
+				_local(classWriter, ISTORE, ISTORE_0, slot, -1);
+				const uint32_t start = classWriter->code.length;
+				_local(classWriter, ILOAD, ILOAD_0, slot, +1);
+				_generateOperand(classWriter, &instruction->operands[1]);
+				_push(classWriter, slot);
+				_push(classWriter, start);
+				_push(classWriter, _exitBranch(classWriter, IF_ICMPLT, -2));
+				break;
+			}
+			case IR_END_FOR: {
+				const uint32_t exit = _pop(classWriter);
+				const uint32_t start = _pop(classWriter);
+				_increment(classWriter, _pop(classWriter));
+				_jump(classWriter, start);
+				_patch(classWriter, exit);
+				classWriter->nextSlot = _pop(classWriter);
+				break;
+			}
+			default:
+				_generateTreeCall(classWriter, instruction);
+				break;
+		}
+	}
+	_instruction(classWriter, RETURN, 0);
+}
+
+/**
+ * Generates the code of "main" for a long program, which calls the method of
+ * each chunk, in order.
+ */
+static void _generateCalls(ClassWriter * classWriter, const uint32_t chunkCount) {
+	_reset(classWriter, 1);
+	for (uint32_t chunk = 0; chunk < chunkCount && !classWriter->exhausted; ++chunk) {
+		char name[16];
+		snprintf(name, sizeof(name), "main_%u", chunk);
+		const Method method = { classWriter->compilerState->className, name, "()V", 0 };
+		_invoke(classWriter, INVOKESTATIC, &method);
+	}
+	_instruction(classWriter, RETURN, 0);
+}
+
+/**
+ * Returns true if the code just generated fits in a method (and the class so
+ * far, in the limits of its format). Otherwise, logs its size.
+ */
+static boolean _fits(ClassWriter * classWriter, const char * name) {
+	if (!classWriter->exhausted && (classWriter->overflowed || _maximumCodeLength < classWriter->code.length
+			|| _maximumIndex < (uint32_t) classWriter->maximumStackDepth || _maximumIndex < classWriter->maximumSlots)) {
+		logError(_logger, "The program is too large for a class (its \"%s\" has %u byte(s) of bytecode, %u local(s), and %u constant(s)).",
+			name, classWriter->code.length, classWriter->maximumSlots, classWriter->constantCount - 1);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Appends a method, with its "Code" attribute (without exception handlers).
+ */
+static void _generateMethod(ClassWriter * classWriter, Bytes * bytes, const uint16_t access, const char * name, const char * descriptor, const uint16_t maximumStackDepth, const uint16_t maximumSlots, const Bytes * code) {
+	_u2(classWriter, bytes, access);
+	_u2(classWriter, bytes, _utf8(classWriter, name));
+	_u2(classWriter, bytes, _utf8(classWriter, descriptor));
+	_u2(classWriter, bytes, 1);
+	_u2(classWriter, bytes, _utf8(classWriter, "Code"));
+	_u4(classWriter, bytes, 12 + code->length);
+	_u2(classWriter, bytes, maximumStackDepth);
+	_u2(classWriter, bytes, maximumSlots);
+	_u4(classWriter, bytes, code->length);
+	_append(classWriter, bytes, code->bytes, code->length);
+	_u2(classWriter, bytes, 0);
+	_u2(classWriter, bytes, 0);
+}
+
+/**
+ * Appends the fields of the variables shared by the methods of a long
+ * program, preceded by their count.
+ */
+static void _generateFields(ClassWriter * classWriter, Bytes * bytes) {
+	IntermediateRepresentation * intermediateRepresentation = classWriter->intermediateRepresentation;
+	uint32_t fieldCount = 0;
+	for (IrVariableIndex v = 0; v < intermediateRepresentation->variableCount; ++v) {
+		if (classWriter->chunks[v] == IR_SHARED_CHUNK) {
+			++fieldCount;
+		}
+	}
+	if (_maximumIndex < fieldCount) {
+		classWriter->overflowed = true;
+	}
+	_u2(classWriter, bytes, (uint16_t) fieldCount);
+	for (IrVariableIndex v = 0; v < intermediateRepresentation->variableCount; ++v) {
+		if (classWriter->chunks[v] == IR_SHARED_CHUNK) {
+			const char * name = _fieldName(classWriter, v);
+			_u2(classWriter, bytes, _privateAccess | _staticAccess);
+			_u2(classWriter, bytes, name == NULL ? 0 : _utf8(classWriter, name));
+			_u2(classWriter, bytes, _utf8(classWriter, _descriptor(intermediateRepresentation->variables[v].type)));
+			_u2(classWriter, bytes, 0);
+		}
+	}
+}
+
+/**
+ * Generates the class: a public default constructor, and "main". A long
+ * program is split in chunks of top-level statements, each one in its own
+ * private method (called by "main" in order), and the variables shared by
+ * the chunks become fields, as in the Java source. Since the constant pool
+ * precedes the members, they are generated first, and the pool is written
+ * right before them.
+ */
+static boolean _generateClass(ClassWriter * classWriter) {
+	IntermediateRepresentation * intermediateRepresentation = classWriter->intermediateRepresentation;
+	const uint32_t count = intermediateRepresentation->instructionCount;
+	const uint32_t chunkCount = irChunkVariables(intermediateRepresentation, _chunkSize, classWriter->chunks);
+	Bytes constructor = { .bytes = NULL, .length = 0, .capacity = 0 };
+	const uint16_t objectConstructor = _methodReference(classWriter, &_objectConstructor);
+	_u1(classWriter, &constructor, ALOAD_0);
+	_u1(classWriter, &constructor, INVOKESPECIAL);
+	_u2(classWriter, &constructor, objectConstructor);
+	_u1(classWriter, &constructor, RETURN);
+
+	Bytes methods = { .bytes = NULL, .length = 0, .capacity = 0 };
+	_generateMethod(classWriter, &methods, _publicAccess, "<init>", "()V", 1, 1, &constructor);
+	uint32_t methodCount = 2;
+	uint32_t bytecodeLength = 0;
+	boolean fits = true;
+	if (chunkCount <= 1) {
+		_generateCode(classWriter, 0, count, 1);
+	}
+	else {
+		IrInstructionIndex start = 0;
+		for (uint32_t chunk = 0; chunk < chunkCount && fits; ++chunk) {
+			char name[16];
+			snprintf(name, sizeof(name), "main_%u", chunk);
+			const IrInstructionIndex end = irChunkEnd(intermediateRepresentation->instructions, count, start, _chunkSize);
+			_generateCode(classWriter, start, end, 0);
+			fits = _fits(classWriter, name);
+			_generateMethod(classWriter, &methods, _privateAccess | _staticAccess, name, "()V",
+				(uint16_t) classWriter->maximumStackDepth, (uint16_t) classWriter->maximumSlots, &classWriter->code);
+			bytecodeLength += classWriter->code.length;
+			start = end;
+		}
+		methodCount += chunkCount;
+		_generateCalls(classWriter, chunkCount);
+	}
+	fits = fits && _fits(classWriter, "main");
+	_generateMethod(classWriter, &methods, _publicAccess | _staticAccess, "main", "([Ljava/lang/String;)V",
+		(uint16_t) classWriter->maximumStackDepth, (uint16_t) classWriter->maximumSlots, &classWriter->code);
+	bytecodeLength += classWriter->code.length;
+
+	Bytes members = { .bytes = NULL, .length = 0, .capacity = 0 };
+	_u2(classWriter, &members, _publicAccess | _superAccess);
+	_u2(classWriter, &members, _class(classWriter, classWriter->compilerState->className));
+	_u2(classWriter, &members, _class(classWriter, _objectConstructor.owner));
+	_u2(classWriter, &members, 0);
+	_generateFields(classWriter, &members);
+	_u2(classWriter, &members, (uint16_t) methodCount);
+	_append(classWriter, &members, methods.bytes, methods.length);
+	_u2(classWriter, &members, 0);
+
+	boolean succeed = false;
+	if (classWriter->exhausted) {
+		logCritical(_logger, "Cannot allocate the class.");
+	}
+	else if (fits && classWriter->overflowed) {
+		logError(_logger, "The program is too large for a class (it has %u constant(s)).", classWriter->constantCount - 1);
+	}
+	else if (fits) {
+		Bytes header = { .bytes = NULL, .length = 0, .capacity = 0 };
+		_u4(classWriter, &header, _magic);
+		_u2(classWriter, &header, _minorVersion);
+		_u2(classWriter, &header, _majorVersion);
+		_u2(classWriter, &header, (uint16_t) classWriter->constantCount);
+		FILE * file = classWriter->compilerState->outputFile;
+		succeed = !classWriter->exhausted
+			&& fwrite(header.bytes, 1, header.length, file) == header.length
+			&& fwrite(classWriter->pool.bytes, 1, classWriter->pool.length, file) == classWriter->pool.length
+			&& fwrite(members.bytes, 1, members.length, file) == members.length;
+		if (!succeed) {
+			logError(_logger, "The class cannot be written.");
+		}
+		free(header.bytes);
+	}
+	free(members.bytes);
+	free(methods.bytes);
+	free(constructor.bytes);
+	logDebugging(_logger, "The class has %u instruction(s) of IR, and %u byte(s) of bytecode in %u method(s).",
+		count, bytecodeLength, methodCount);
+	return succeed;
+}
+
+/* PUBLIC FUNCTIONS */
+
+boolean generateClass(CompilerState * compilerState) {
+	logDebugging(_logger, "Generating final output...");
+	IntermediateRepresentation * intermediateRepresentation = compilerState->intermediateRepresentation;
+	IrVariableIndex variable = IR_NO_VARIABLE;
+	const IrInstructionIndex operation = irTreeOperation(intermediateRepresentation, &variable);
+	if (operation < intermediateRepresentation->instructionCount) {
+		logError(_logger, "The program cannot be compiled into a class, since it operates on a whole tree: \"%s\" (%s)",
+			intermediateRepresentation->variables[variable].name, irOpcodeName(intermediateRepresentation->instructions[operation].opcode));
+		return false;
+	}
+	ClassWriter classWriter = {
+		.compilerState = compilerState,
+		.intermediateRepresentation = intermediateRepresentation,
+		.pool = { .bytes = NULL, .length = 0, .capacity = 0 },
+		.constantCount = 1,
+		.constants = hashMapInit(sizeof(ConstantKey), sizeof(uint16_t), _constantKeyHash, _constantKeyEquals),
+		.code = { .bytes = NULL, .length = 0, .capacity = 0 },
+		.stackDepth = 0,
+		.maximumStackDepth = 0,
+		.slots = calloc(intermediateRepresentation->variableCount + 1, sizeof(uint32_t)),
+		.chunks = calloc(intermediateRepresentation->variableCount + 1, sizeof(uint32_t)),
+		.nextSlot = 1,
+		.maximumSlots = 1,
+		.pending = NULL,
+		.pendingCount = 0,
+		.pendingCapacity = 0,
+		.exhausted = false,
+		.overflowed = false
+	};
+	boolean succeed = false;
+	if (classWriter.constants == NULL || classWriter.slots == NULL || classWriter.chunks == NULL) {
+		logCritical(_logger, "Cannot allocate the locals of %u variable(s).", intermediateRepresentation->variableCount);
+	}
+	else {
+		succeed = _generateClass(&classWriter);
+	}
+	if (classWriter.constants != NULL) {
+		hashMapDestroy(classWriter.constants);
+	}
+	free(classWriter.slots);
+	free(classWriter.chunks);
+	free(classWriter.pending);
+	free(classWriter.code.bytes);
+	free(classWriter.pool.bytes);
+	logDebugging(_logger, "Generation is done.");
+	return succeed;
+}
@@ -0,0 +1,39 @@
+#ifndef CLASS_GENERATOR_HEADER
+#define CLASS_GENERATOR_HEADER
+
+#include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../shared/CompilerState.h"
+#include "../../shared/Environment.h"
+#include "../../shared/Hash.h"
+#include "../../shared/InternTable.h"
+#include "../../shared/Logger.h"
+#include "../intermediate-representation/IntermediateRepresentation.h"
+#include "../semantic-analysis/hashMap.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeClassGeneratorModule();
+
+/** Shutdown module's internal state. */
+void shutdownClassGeneratorModule();
+
+/**
+ * Generates the final output from the IR of the current compiler state, as the
+ * bytecode of a Java class named "className" (i.e., a ".class" file), written
+ * into "outputFile", which must be opened in binary mode. The class has the
+ * same methods (and fields) that the Java source would compile into, and
+ * calls the prebuilt classes of the runtime ("IntAVL", "IntBST" and "IntRBT",
+ * for the trees of integers, and "Tree" and "EXP"). The AVL and RBT trees are
+ * "PooledAVL" and "PooledRBT" instead if "POOLED_TREES=true".
+ *
+ * Returns false if the program operates on whole trees (e.g., "c = a + b",
+ * which has no counterpart in the runtime), if a top-level statement exceeds
+ * the limits of a method (e.g., 64 KiB of bytecode), or if there is no memory
+ * left.
+ */
+boolean generateClass(CompilerState * compilerState);
+
+#endif
@@ -1,24 +1,27 @@
 #include "Generator.h"
 #include "../../shared/Logger.h"
-#include "../../shared/String.h"
+#include "../../shared/OutputBuffer.h"
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdarg.h>
-#include <stdarg.h>
-
-static FILE *outputFile;
-
-void SetOutputFile(FILE *file) {
-    outputFile = file;
-}
-
 
 /* MODULE INTERNAL STATE */
 const char _indentationCharacter = ' ';
 const char _indentationSize = 4;
+const unsigned int _maximumIndentationLevel = 32;
+
+// The IR instructions of each method of a long program: an instruction takes
+// about 5 bytes of bytecode (and rarely more than 12), so every method stays
+// under the 8000 bytes that HotSpot compiles (and far from the 64 KiB limit).
+static const uint32_t _chunkSize = 600;
+
+// Whether the AVL and RBT trees keep their nodes in pools of arrays, instead
+// of objects (which is an alternative engine, enabled with "POOLED_TREES").
+static boolean _pooledTrees = false;
+
 static Logger * _logger = NULL;
 
 void initializeGeneratorModule() {
+    _pooledTrees = getBooleanOrDefault("POOLED_TREES", _pooledTrees);
     _logger = createLogger("Generator");
 }
 
@@ -30,399 +33,461 @@ void shutdownGeneratorModule() {
 
 /** PRIVATE FUNCTIONS */
 
-static const char _expressionTypeToCharacter(const ExpressionType type);
-static void _generateConstant(const unsigned int indentationLevel, Constant * constant);
-static void _generateEpilogue(void);
-static void _generateExpression(const unsigned int indentationLevel, Expression * expression);
-static void _generateFactor(const unsigned int indentationLevel, Factor * factor);
-static void _generateProgram(Program * program);
-static void _generatePrologue(void);
-static void _generateStatementList(StatementList statementList);
-static void _generateStatement(const unsigned int indentationLevel, Statement * statement);
-static void _generateBlock(const unsigned int indentationLevel, Block * block);
-static void _generateIfStatement(const unsigned int indentationLevel, IfStatement * ifStatement);
-static void _generateForStatement(const unsigned int indentationLevel, ForStatement * forStatement);
-static void _generateIterate(const unsigned int indentationLevel, IterateStatement * iterateStatement);
-static void _generateFunctionCall(const unsigned int indentationLevel, FunctionCall * functionCall);
-static void _generateDeclaration(const unsigned int indentationLevel, Declaration * declaration);
-static void _generateAssignment(const unsigned int indentationLevel, Assignment * assignment);
-static char * _indentation(const unsigned int indentationLevel);
-static void _output(const unsigned int indentationLevel, const char * const format, ...);
+static int _precedence(const IrOpcode opcode);
+static boolean _needsParentheses(IntermediateRepresentation * intermediateRepresentation, const IrInstruction * instruction, const unsigned int operand);
+static const char * _treeMethod(const IrOpcode opcode);
+static void _generateAtom(CompilerState * compilerState, const IrOperand * operand);
+static void _generateVariable(CompilerState * compilerState, const IrVariableIndex variable);
+static void _generateOperand(CompilerState * compilerState, const IrOperand * operand);
+static boolean _generateOperandOf(CompilerState * compilerState, NodeStack * nodeStack, const IrInstruction * instruction, const unsigned int operand);
+static const char * _typeName(const IrType type);
+static const char * _constructor(const IrType type);
+static void _generateDeclaration(CompilerState * compilerState, const unsigned int indentationLevel, const IrVariableIndex variable, const boolean field);
+static void _generateTreeCall(CompilerState * compilerState, const unsigned int indentationLevel, const IrInstruction * instruction);
+static void _generateEpilogue(CompilerState * compilerState);
+static void _generateFields(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation, const uint32_t * chunks);
+static void _generateStatements(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation, const uint32_t * chunks, const IrInstructionIndex start, const IrInstructionIndex end);
+static boolean _generateProgram(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation);
+static void _generatePrologue(CompilerState * compilerState);
+static void _output(CompilerState * compilerState, const unsigned int indentationLevel, const char * const string);
 
 /**
- * Converts an expression type to the proper character of the operation
- * involved, or returns '\0' if that's not possible.
+ * Returns the precedence of an operation in Java (higher binds tighter). The
+ * tree queries are method calls, so they bind the tightest.
  */
-static const char _expressionTypeToCharacter(const ExpressionType type) {
-    switch (type) {
-        case ADDITION_EXP: return '+';
-        case DIVISION_EXP: return '/';
-        case MULTIPLICATION_EXP: return '*';
-        case SUBTRACTION_EXP: return '-';
-        case MODULE_EXP: return '%';
+static int _precedence(const IrOpcode opcode) {
+    switch (opcode) {
+        case IR_OR: return 1;
+        case IR_AND: return 2;
+        case IR_EQUAL:
+        case IR_NOT_EQUAL: return 3;
+        case IR_LESS:
+        case IR_LESS_EQUAL:
+        case IR_GREATER:
+        case IR_GREATER_EQUAL: return 4;
+        case IR_ADD:
+        case IR_SUBTRACT: return 5;
+        case IR_MULTIPLY:
+        case IR_DIVIDE:
+        case IR_MODULO: return 6;
+        case IR_NOT: return 7;
         default:
-            logError(_logger, "The specified expression type cannot be converted into character: %d", type);
-            return '\0';
+            return 8;
     }
 }
 
 /**
- * Generates the output of a constant.
+ * Returns true if an operand of an operation must be parenthesized, that is,
+ * if it's an operation that binds looser (or as loose, on the right, since
+ * every binary operator is left-associative).
  */
-static void _generateConstant(const unsigned int indentationLevel, Constant * constant) {
-    if (constant->type == INT_CONSTANT){
-        _output(indentationLevel, "%d", constant->intValue);
-    }
-    else {
-        _output(indentationLevel, "%s", constant->boolValue ? "true" : "false");
+static boolean _needsParentheses(IntermediateRepresentation * intermediateRepresentation, const IrInstruction * instruction, const unsigned int operand) {
+    if (!isIrOperation(instruction->opcode) || instruction->operands[operand].kind != IR_TEMPORARY_OPERAND) {
+        return false;
     }
+    const int precedence = _precedence(instruction->opcode);
+    const int operandPrecedence = _precedence(intermediateRepresentation->instructions[instruction->operands[operand].temporary].opcode);
+    return operandPrecedence < precedence || (operand == 1 && operandPrecedence == precedence);
 }
 
 /**
- * Creates the epilogue of the generated output, that is, the final lines that
- * completes a valid Java program.
+ * Returns the method of the runtime that implements a tree (or list)
+ * operation.
  */
-static void _generateEpilogue(void) {
-    _output(1, "}\n");
-    _output(0, "}\n");
-}
-
-/**
- * Generates the output of an expression.
- */
-static void _generateExpression(const unsigned int indentationLevel, Expression * expression) {
-    switch (expression->type) {
-        case ADDITION_EXP:
-        case DIVISION_EXP:
-        case MULTIPLICATION_EXP:
-        case SUBTRACTION_EXP:
-            _generateExpression(indentationLevel, expression->leftExpression);
-            _output(indentationLevel, " %c ", _expressionTypeToCharacter(expression->type));
-            _generateExpression(indentationLevel, expression->rightExpression);
-            break;
-        case AND_EXP:
-            _generateExpression(indentationLevel, expression->leftExpression);
-            _output(indentationLevel, " && ");
-            _generateExpression(indentationLevel, expression->rightExpression);
-            break;
-        case NOT_EXP: 
-            _output(indentationLevel, "!");
-            _generateExpression(indentationLevel, expression->leftExpression);
-            break;
-        case OR_EXP:
-            _generateExpression(indentationLevel, expression->leftExpression);
-            _output(indentationLevel, " || ");
-            _generateExpression(indentationLevel, expression->rightExpression);
-            break;
-        case EQUAL_EXP:
-            _generateExpression(indentationLevel, expression->leftExpression);
-            _output(indentationLevel, " == ");
-            _generateExpression(indentationLevel, expression->rightExpression);
-            break;
-        case NOT_EQUAL_EXP:
-            _generateExpression(indentationLevel, expression->leftExpression);
-            _output(indentationLevel, " != ");
-            _generateExpression(indentationLevel, expression->rightExpression);
-            break;
-        case LESS_EXP: 
-            _generateExpression(indentationLevel, expression->leftExpression);
-            _output(indentationLevel, " < ");
-            _generateExpression(indentationLevel, expression->rightExpression);
-            break;
-        case LESS_EQUAL_EXP: 
-            _generateExpression(indentationLevel, expression->leftExpression);
-            _output(indentationLevel, " <= ");
-            _generateExpression(indentationLevel, expression->rightExpression);
-            break;
-        case GREATER_EXP:
-            _generateExpression(indentationLevel, expression->leftExpression);
-            _output(indentationLevel, " > ");
-            _generateExpression(indentationLevel, expression->rightExpression);
-            break;
-        case GREATER_EQUAL_EXP:
-            _generateExpression(indentationLevel, expression->leftExpression);
-            _output(indentationLevel, " >= ");
-            _generateExpression(indentationLevel, expression->rightExpression);
-            break;
-        case FACTOR_EXP:
-            _generateFactor(indentationLevel, expression->factor);
-            break;
+static const char * _treeMethod(const IrOpcode opcode) {
+    switch (opcode) {
+        case IR_INSERT: return "insert";
+        case IR_INSERT_ALL: return "insertAll";
+        case IR_REMOVE: return "remove";
+        case IR_INCLUDES: return "includes";
+        case IR_HEIGHT: return "height";
+        case IR_DEPTH: return "depth";
+        case IR_CALCULATE: return "calculate";
+        case IR_VISUALIZE: return "visualize";
+        case IR_INORDER: return "inorder";
+        case IR_PREORDER: return "preorder";
+        case IR_POSTORDER: return "postorder";
+        case IR_APPEND: return "add";
         default:
-            logError(_logger, "The specified expression type is unknown: %d", expression->type);
-            break;
+            return NULL;
     }
 }
 
 /**
- * Generates the output of a factor.
+ * Generates an operand that is not a temporary.
  */
-static void _generateFactor(const unsigned int indentationLevel, Factor * factor) {
-    switch (factor->type) {
-        case CONSTANT_FACTOR:
-            _generateConstant(indentationLevel, factor->constant);
-            break;
-        case EXPRESSION_FACTOR:
-            _output(indentationLevel, "(");
-            _generateExpression(indentationLevel, factor->expression);
-            _output(indentationLevel, ")");
-            break;
-        case DECLARATION_FACTOR: 
-            _output(indentationLevel, "%s", factor->varName);
+static void _generateAtom(CompilerState * compilerState, const IrOperand * operand) {
+    switch (operand->kind) {
+        case IR_CONSTANT_OPERAND:
+            if (operand->type == IR_BOOLEAN) {
+                _output(compilerState, 0, operand->constant ? "true" : "false");
+            }
+            else {
+                appendInteger(compilerState->outputBuffer, operand->constant);
+            }
+            break;
+        case IR_STRING_OPERAND:
+            appendCharacter(compilerState->outputBuffer, '"');
+            appendString(compilerState->outputBuffer, operand->string);
+            appendCharacter(compilerState->outputBuffer, '"');
+            break;
+        case IR_VARIABLE_OPERAND:
+            _generateVariable(compilerState, operand->variable);
             break;
         default:
-            logError(_logger, "The specified factor type is unknown: %d", factor->type);
             break;
     }
 }
 
 /**
- * Generates the output of the program.
- */
-static void _generateProgram(Program * program) {
-    _output(0, "import java.io.IOException;\n");
-    _output(0, "public class Main {\n");
-    _output(1, "public static void main(String[] args) throws IOException{\n");
-    _generateStatementList(program->statements);
-}
-
-/** 
- * Generates the output of a statementlist.  
+ * Generates the name of a variable. The ones made by the compiler have an
+ * underscore, which no identifier of the program can have.
  */
-static void _generateStatementList(StatementList statementList){
-    StatementList current = statementList;
-    while (current != NULL) {
-        _generateStatement(2, current->statement);
-        current = current->next;
+static void _generateVariable(CompilerState * compilerState, const IrVariableIndex variable) {
+    IntermediateRepresentation * intermediateRepresentation = compilerState->intermediateRepresentation;
+    const IrVariable * irVariable = &intermediateRepresentation->variables[variable];
+    appendString(compilerState->outputBuffer, irVariable->name);
+    if (irVariable->synthetic) {
+        appendCharacter(compilerState->outputBuffer, '_');
+        appendUnsigned(compilerState->outputBuffer, variable);
     }
 }
 
-/** 
- * Generates the output of a declaration. 
+/**
+ * Generates an operand as a Java expression: every temporary is generated
+ * where it's used, from the instruction that defines it. The operations are
+ * walked in-order with an explicit stack, so any depth of nesting is
+ * supported.
  */
-static void _generateDeclaration(const unsigned int indentationLevel, Declaration * declaration){
-    switch (declaration->type){
-    case RBT_DECLARATION:
-        _output(indentationLevel, "Tree<Integer> %s = new RBT<> ();\n", declaration->varName);
-        break;
-    case AVL_DECLARATION:
-        _output(indentationLevel, "Tree<Integer> %s = new AVL<>(); \n", declaration->varName);
-        break;
-    case BST_DECLARATION:
-        _output(indentationLevel, "Tree<Integer> %s = new BST<>();\n", declaration->varName);
-        break;
-    case EXP_DECLARATION:
-        _output(indentationLevel, "EXP<String> %s = new EXP<>(); \n", declaration->varName);
-        break;
-    case INT_DECLARATION:
-        _output(indentationLevel, "int ");
-        if (declaration->assignment != NULL){
-            _generateAssignment(0, declaration->assignment);
-            _output(0, ";\n");
-        }
-        else {
-            _output(0, "%s;\n", declaration->varName);
+static void _generateOperand(CompilerState * compilerState, const IrOperand * operand) {
+    IntermediateRepresentation * intermediateRepresentation = compilerState->intermediateRepresentation;
+    if (operand->kind != IR_TEMPORARY_OPERAND) {
+        _generateAtom(compilerState, operand);
+        return;
+    }
+    NodeStack nodeStack;
+    initializeNodeStack(&nodeStack);
+    boolean succeed = pushNodeFrame(&nodeStack, operand->temporary, 0);
+    while (succeed && !isNodeStackEmpty(&nodeStack)) {
+        NodeFrame * frame = peekNodeFrame(&nodeStack);
+        const IrInstruction * instruction = &intermediateRepresentation->instructions[frame->index];
+        const uint32_t stage = frame->stage++;
+        const boolean operation = isIrOperation(instruction->opcode);
+        if (stage == 0) {
+            if (!operation) {
+                _generateVariable(compilerState, instruction->variable);
+                appendCharacter(compilerState->outputBuffer, '.');
+                appendString(compilerState->outputBuffer, _treeMethod(instruction->opcode));
+                appendCharacter(compilerState->outputBuffer, '(');
+            }
+            else if (instruction->opcode == IR_NOT) {
+                appendCharacter(compilerState->outputBuffer, '!');
+            }
+            succeed = _generateOperandOf(compilerState, &nodeStack, instruction, 0);
         }
-        break;
-    case BOOL_DECLARATION:
-        _output(indentationLevel, "boolean ");
-        if(declaration->assignment != NULL){
-            _generateAssignment(indentationLevel, declaration->assignment);
-            _output(0, ";\n");
+        else if (stage == 1) {
+            if (_needsParentheses(intermediateRepresentation, instruction, 0)) {
+                appendCharacter(compilerState->outputBuffer, ')');
+            }
+            if (instruction->operands[1].kind == IR_NO_OPERAND) {
+                if (!operation) {
+                    appendCharacter(compilerState->outputBuffer, ')');
+                }
+                popNodeFrame(&nodeStack);
+            }
+            else {
+                appendCharacter(compilerState->outputBuffer, ' ');
+                appendString(compilerState->outputBuffer, irOperationSymbol(instruction->opcode));
+                appendCharacter(compilerState->outputBuffer, ' ');
+                succeed = _generateOperandOf(compilerState, &nodeStack, instruction, 1);
+            }
         }
         else {
-            _output(0, "%s;\n", declaration->varName);
+            if (_needsParentheses(intermediateRepresentation, instruction, 1)) {
+                appendCharacter(compilerState->outputBuffer, ')');
+            }
+            popNodeFrame(&nodeStack);
         }
-        break;
-    default:
-        break;
     }
+    finalizeNodeStack(&nodeStack);
 }
 
-/** 
- * Generates the output of an assignment. 
+/**
+ * Generates an operand of an instruction, within "_generateOperand": an atom
+ * is generated at once, and a temporary is pushed to the stack. Returns false
+ * if there is no memory left.
  */
-static void _generateAssignment(const unsigned int indentationLevel, Assignment * assignment){
-    _output(indentationLevel, "%s = ", assignment->varName);
-    if(assignment->expression != NULL){
-        _generateExpression(0, assignment->expression);
+static boolean _generateOperandOf(CompilerState * compilerState, NodeStack * nodeStack, const IrInstruction * instruction, const unsigned int operand) {
+    if (_needsParentheses(compilerState->intermediateRepresentation, instruction, operand)) {
+        appendCharacter(compilerState->outputBuffer, '(');
     }
-    if(assignment->functionCall != NULL){
-        _generateFunctionCall(0, assignment->functionCall);
+    if (instruction->operands[operand].kind == IR_TEMPORARY_OPERAND) {
+        return pushNodeFrame(nodeStack, instruction->operands[operand].temporary, 0);
     }
+    _generateAtom(compilerState, &instruction->operands[operand]);
+    return true;
 }
 
 /**
- * Generates the prologue of the generated output, starting a valid Java program.
+ * Returns the type of a variable in Java (or NULL, if it has none). A tree of
+ * integers takes the final class of its kind, so its calls are bound
+ * statically, and its keys are never boxed.
  */
-static void _generatePrologue(void) {
-    _output(0, "import java.util.*;\n");
+static const char * _typeName(const IrType type) {
+    switch (type) {
+        case IR_BOOLEAN: return "boolean";
+        case IR_INTEGER: return "int";
+        case IR_AVL_TREE: return _pooledTrees ? "PooledAVL" : "IntAVL";
+        case IR_BST_TREE: return "IntBST";
+        case IR_RBT_TREE: return _pooledTrees ? "PooledRBT" : "IntRBT";
+        case IR_EXP_TREE: return "EXP<String>";
+        case IR_LIST: return "List<Integer>";
+        default:
+            return NULL;
+    }
 }
 
 /**
- * Generates an indentation string for the specified level.
+ * Returns the expression that builds an empty tree (or list).
  */
-static char * _indentation(const unsigned int level) {
-    return indentation(_indentationCharacter, level, _indentationSize);
+static const char * _constructor(const IrType type) {
+    switch (type) {
+        case IR_AVL_TREE: return _pooledTrees ? "new PooledAVL()" : "new IntAVL()";
+        case IR_BST_TREE: return "new IntBST()";
+        case IR_RBT_TREE: return _pooledTrees ? "new PooledRBT()" : "new IntRBT()";
+        case IR_EXP_TREE: return "new EXP<>()";
+        case IR_LIST: return "new ArrayList<>()";
+        default:
+            return NULL;
+    }
 }
 
 /**
- * Outputs a formatted string to standard output.
+ * Generates the declaration of a tree (or list), which starts empty. If the
+ * variable is a field, it's only assigned.
  */
-static void _output(const unsigned int indentationLevel, const char * const format, ...) {
-    va_list arguments;
-    va_start(arguments, format);
-    char * indentation = _indentation(indentationLevel);
-    char * effectiveFormat = concatenate(2, indentation, format);
-    vfprintf(outputFile, effectiveFormat, arguments);
-    free(effectiveFormat);
-    free(indentation);
-    va_end(arguments);
+static void _generateDeclaration(CompilerState * compilerState, const unsigned int indentationLevel, const IrVariableIndex variable, const boolean field) {
+    IntermediateRepresentation * intermediateRepresentation = compilerState->intermediateRepresentation;
+    const IrType type = intermediateRepresentation->variables[variable].type;
+    const char * constructor = _constructor(type);
+    if (constructor == NULL) {
+        logError(_logger, "The variable cannot be declared empty: %u", variable);
+        return;
+    }
+    appendIndentation(compilerState->outputBuffer, indentationLevel);
+    if (!field) {
+        appendString(compilerState->outputBuffer, _typeName(type));
+        appendCharacter(compilerState->outputBuffer, ' ');
+    }
+    _generateVariable(compilerState, variable);
+    _output(compilerState, 0, " = ");
+    appendString(compilerState->outputBuffer, constructor);
+    _output(compilerState, 0, ";\n");
 }
 
 /**
- * Generates a statement.
+ * Generates a tree (or list) operation as a statement.
  */
-static void _generateStatement(const unsigned int indentationLevel, Statement * statement) {
-    switch (statement->type) {
-        case IF_STATEMENT:
-            _generateIfStatement(indentationLevel, statement->ifStatement);
-            break;
-        case FOR_STATEMENT:
-            _generateForStatement(indentationLevel, statement->forStatement);
-            break;
-        case FUNCTION_CALL_STATEMENT:
-            _generateFunctionCall(indentationLevel, statement->functionCall);
-            break;
-        case DECLARATION_STATEMENT:
-            _generateDeclaration(indentationLevel, statement->declaration);
-            break;
-        case ASSIGNMENT_STATEMENT:
-            _generateAssignment(indentationLevel, statement->assignment);
-            _output(0, ";\n");
-            break;
-        case ITERATE_STATEMENT:
-            _generateIterate(indentationLevel, statement->iterateStatement);
-            break;
-        default:
-            logError(_logger, "Unknown statement type: %d", statement->type);
-            break;
+static void _generateTreeCall(CompilerState * compilerState, const unsigned int indentationLevel, const IrInstruction * instruction) {
+    const char * method = _treeMethod(instruction->opcode);
+    if (method == NULL) {
+        logError(_logger, "Unknown instruction: %s", irOpcodeName(instruction->opcode));
+        return;
     }
+    appendIndentation(compilerState->outputBuffer, indentationLevel);
+    _generateVariable(compilerState, instruction->variable);
+    appendCharacter(compilerState->outputBuffer, '.');
+    appendString(compilerState->outputBuffer, method);
+    appendCharacter(compilerState->outputBuffer, '(');
+    _generateOperand(compilerState, &instruction->operands[0]);
+    _output(compilerState, 0, ");\n");
 }
 
-static void _generateIterate(const unsigned int indentationLevel, IterateStatement * iterateStatement){
-    _output(indentationLevel, "%s", iterateStatement->varName);
-    switch (iterateStatement->type){
-    case INORDER:
-        _output(0, ".inorder()");
-        break;
-    case POSTORDER:
-        _output(0, ".postorder()");
-        break;
-    case PREORDER:
-        _output(0, ".preorder()");
-        break;
-    default:
-        logError(_logger, "Unkwnon iterator type: %d", iterateStatement->type);
-        break;
-    }
-    _output(0, ";\n");
+/**
+ * Creates the epilogue of the generated output, that is, the final lines that
+ * completes a valid Java program.
+ */
+static void _generateEpilogue(CompilerState * compilerState) {
+    _output(compilerState, 1, "}\n");
+    _output(compilerState, 0, "}\n");
 }
 
 /**
- * Generates an if statement.
+ * Generates the variables shared by the methods of a long program, as fields.
  */
-static void _generateIfStatement(const unsigned int indentationLevel, IfStatement * ifStatement) {
-    _output(indentationLevel, "if (");
-    _generateExpression(0, ifStatement->condition);
-    _output(0, ") ");
-    _generateBlock(0, ifStatement->blockIf);
-
-    if (ifStatement->type == IF_ELSE_TYPE) {
-        _output(2, " else ");
-        _generateBlock(0, ifStatement->blockElse);
+static void _generateFields(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation, const uint32_t * chunks) {
+    for (IrVariableIndex v = 0; v < intermediateRepresentation->variableCount; ++v) {
+        if (chunks[v] == IR_SHARED_CHUNK) {
+            _output(compilerState, 1, "private static ");
+            appendString(compilerState->outputBuffer, _typeName(intermediateRepresentation->variables[v].type));
+            appendCharacter(compilerState->outputBuffer, ' ');
+            _generateVariable(compilerState, v);
+            _output(compilerState, 0, ";\n");
+        }
     }
 }
 
 /**
- * Generates a for statement.
+ * Generates the statements [start, end) of the program, a statement at a time
+ * (the operations are generated within the statements that use them). An
+ * "int" (or "boolean") declaration is held until the next statement, so it
+ * takes its initial value if that statement is the first store. A field is
+ * never declared, but only assigned.
  */
-static void _generateForStatement(const unsigned int indentationLevel, ForStatement * forStatement) {
-    _output(indentationLevel, "for (int %s = ", forStatement->varName);
-    _generateExpression(0, forStatement->range->expressionLeft);
-    _output(0, "; %s < ", forStatement->varName);
-    _generateExpression(0, forStatement->range->expressionRight);
-    _output(0, "; %s++) ", forStatement->varName);
-    _generateBlock(0, forStatement->block);
+static void _generateStatements(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation, const uint32_t * chunks, const IrInstructionIndex start, const IrInstructionIndex end) {
+    unsigned int indentationLevel = 2;
+    IrVariableIndex declaration = IR_NO_VARIABLE;
+    for (IrInstructionIndex k = start; k < end; ++k) {
+        const IrInstruction * instruction = &intermediateRepresentation->instructions[k];
+        if (instruction->type != IR_VOID) {
+            continue;
+        }
+        const boolean initialization = instruction->opcode == IR_STORE && instruction->variable == declaration;
+        if (declaration != IR_NO_VARIABLE && !initialization) {
+            _output(compilerState, indentationLevel, intermediateRepresentation->variables[declaration].type == IR_BOOLEAN ? "boolean " : "int ");
+            _generateVariable(compilerState, declaration);
+            _output(compilerState, 0, ";\n");
+            declaration = IR_NO_VARIABLE;
+        }
+        switch (instruction->opcode) {
+            case IR_DECLARE: {
+                const IrType type = intermediateRepresentation->variables[instruction->variable].type;
+                const boolean field = chunks[instruction->variable] == IR_SHARED_CHUNK;
+                if (type != IR_INTEGER && type != IR_BOOLEAN) {
+                    _generateDeclaration(compilerState, indentationLevel, instruction->variable, field);
+                }
+                else if (!field) {
+                    declaration = instruction->variable;
+                }
+                break;
+            }
+            case IR_STORE:
+                if (initialization) {
+                    _output(compilerState, indentationLevel, intermediateRepresentation->variables[declaration].type == IR_BOOLEAN ? "boolean " : "int ");
+                    declaration = IR_NO_VARIABLE;
+                }
+                else {
+                    appendIndentation(compilerState->outputBuffer, indentationLevel);
+                }
+                _generateVariable(compilerState, instruction->variable);
+                _output(compilerState, 0, " = ");
+                _generateOperand(compilerState, &instruction->operands[0]);
+                _output(compilerState, 0, ";\n");
+                break;
+            case IR_IF:
+                _output(compilerState, indentationLevel++, "if (");
+                _generateOperand(compilerState, &instruction->operands[0]);
+                _output(compilerState, 0, ") {\n");
+                break;
+            case IR_ELSE:
+                _output(compilerState, indentationLevel - 1, "} else {\n");
+                break;
+            case IR_FOR:
+                _output(compilerState, indentationLevel++, "for (int ");
+                _generateVariable(compilerState, instruction->variable);
+                _output(compilerState, 0, " = ");
+                _generateOperand(compilerState, &instruction->operands[0]);
+                _output(compilerState, 0, "; ");
+                _generateVariable(compilerState, instruction->variable);
+                _output(compilerState, 0, " < ");
+                _generateOperand(compilerState, &instruction->operands[1]);
+                _output(compilerState, 0, "; ");
+                _generateVariable(compilerState, instruction->variable);
+                _output(compilerState, 0, "++) {\n");
+                break;
+            case IR_END_IF:
+            case IR_END_FOR:
+                _output(compilerState, --indentationLevel, "}\n");
+                break;
+            default:
+                _generateTreeCall(compilerState, indentationLevel, instruction);
+                break;
+        }
+    }
+    if (declaration != IR_NO_VARIABLE) {
+        _output(compilerState, indentationLevel, intermediateRepresentation->variables[declaration].type == IR_BOOLEAN ? "boolean " : "int ");
+        _generateVariable(compilerState, declaration);
+        _output(compilerState, 0, ";\n");
+    }
 }
 
-static void _generateBlock(const unsigned int indentationLevel, Block * block){
-    _output(indentationLevel, "{\n");
-    _generateStatementList(block->statements);
-    _output(0, "\n");
-    _output(2, "}\n");
+/**
+ * Generates the output of the program. A long program is split in chunks of
+ * top-level statements, each one in its own method (called by "main" in
+ * order), so none of them is too large to be compiled by the JIT. Then, the
+ * variables shared by the chunks become fields. Returns false if there is no
+ * memory left.
+ */
+static boolean _generateProgram(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation) {
+    uint32_t * chunks = calloc(intermediateRepresentation->variableCount + 1, sizeof(uint32_t));
+    if (chunks == NULL) {
+        logCritical(_logger, "Cannot allocate the chunks of %u variable(s).", intermediateRepresentation->variableCount);
+        return false;
+    }
+    const uint32_t count = intermediateRepresentation->instructionCount;
+    const uint32_t chunkCount = irChunkVariables(intermediateRepresentation, _chunkSize, chunks);
+    _output(compilerState, 0, "import java.io.IOException;\n");
+    _output(compilerState, 0, "public class ");
+    appendString(compilerState->outputBuffer, compilerState->className);
+    _output(compilerState, 0, " {\n");
+    if (chunkCount <= 1) {
+        _output(compilerState, 1, "public static void main(String[] args) throws IOException{\n");
+        _generateStatements(compilerState, intermediateRepresentation, chunks, 0, count);
+    }
+    else {
+        _generateFields(compilerState, intermediateRepresentation, chunks);
+        _output(compilerState, 1, "public static void main(String[] args) throws IOException{\n");
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+            _output(compilerState, 2, "main_");
+            appendUnsigned(compilerState->outputBuffer, chunk);
+            _output(compilerState, 0, "();\n");
+        }
+        IrInstructionIndex start = 0;
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+            const IrInstructionIndex end = irChunkEnd(intermediateRepresentation->instructions, count, start, _chunkSize);
+            _output(compilerState, 1, "}\n");
+            _output(compilerState, 1, "private static void main_");
+            appendUnsigned(compilerState->outputBuffer, chunk);
+            _output(compilerState, 0, "() throws IOException {\n");
+            _generateStatements(compilerState, intermediateRepresentation, chunks, start, end);
+            start = end;
+        }
+    }
+    free(chunks);
+    return true;
 }
 
 /**
- * Generates a function call.
+ * Generates the prologue of the generated output, starting a valid Java program.
  */
-static void _generateFunctionCall(const unsigned int indentationLevel, FunctionCall * functionCall) {
-    _output(indentationLevel, "%s.", functionCall->varName);
+static void _generatePrologue(CompilerState * compilerState) {
+    _output(compilerState, 0, "import java.util.*;\n");
+}
 
-    switch (functionCall->type) {
-        case INSERT_CALL:
-            _output(0, "insert(");
-            _generateExpression(0, functionCall->expression);
-            _output(0, ")");
-            break;
-        case REMOVE_CALL:
-            _output(0, "remove(");
-            _generateExpression(0, functionCall->expression);
-            _output(0, ")");
-            break;
-        case INCLUDES_CALL:
-            _output(0, "includes(");
-            _generateExpression(0, functionCall->expression);
-            _output(0, ")");
-            break;
-        case HEIGHT_CALL:
-            _output(0, "height()");
-            break;
-        case DEPTH_CALL:
-            _output(0, "depth(");
-            _generateExpression(0, functionCall->expression);
-            _output(0, ")");
-            break;
-        case CALCULATE_CALL:
-            _output(0, "calculate(\"");
-            _generateExpression(1, functionCall->expression);
-            _output(0, "\")");
-            break;
-        case VISUALIZE_CALL:
-            _output(0, "visualize()");
-            break;
-        case ADD_CALL:
-            _output(indentationLevel, "add(");
-            _generateExpression(indentationLevel, functionCall->expression);
-            _output(indentationLevel, ")");
-           break;
-		 case SUB_CALL:
-            _output(indentationLevel, "sub(");
-            _generateExpression(indentationLevel, functionCall->expression);
-            _output(indentationLevel, ")");
-            break;
-        default:
-            logError(_logger, "Unknown function call type: %d", functionCall->type);
-            break;
-	}
-    _output(0, ";\n");
+/**
+ * Outputs an indented string to the output buffer of the compilation. Deeper
+ * blocks are not indented any further, so the output stays linear in the
+ * program.
+ */
+static void _output(CompilerState * compilerState, const unsigned int indentationLevel, const char * const string) {
+    appendIndentation(compilerState->outputBuffer, indentationLevel);
+    appendString(compilerState->outputBuffer, string);
 }
 
 // /** PUBLIC FUNCTIONS */
 
-void generate(CompilerState * compilerState) {
+boolean generate(CompilerState * compilerState) {
 	logDebugging(_logger, "Generating final output...");
-	_generatePrologue();
-	_generateProgram(compilerState->abstractSyntaxtTree);
-	_generateEpilogue();
+	compilerState->outputBuffer = createOutputBuffer(compilerState->outputFile, _indentationCharacter, _indentationSize, _maximumIndentationLevel);
+	if (compilerState->outputBuffer == NULL) {
+		return false;
+	}
+	_generatePrologue(compilerState);
+	boolean succeed = _generateProgram(compilerState, compilerState->intermediateRepresentation);
+	_generateEpilogue(compilerState);
+	succeed = flushOutputBuffer(compilerState->outputBuffer) && succeed;
+	destroyOutputBuffer(compilerState->outputBuffer);
+	compilerState->outputBuffer = NULL;
 	logDebugging(_logger, "Generation is done.");
-} 
+	return succeed;
+}
@@ -3,9 +3,10 @@
 
 #include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
 #include "../../shared/CompilerState.h"
+#include "../../shared/Environment.h"
 #include "../../shared/Logger.h"
-#include "../../shared/String.h"
-#include <stdarg.h>
+#include "../../shared/OutputBuffer.h"
+#include "../intermediate-representation/IntermediateRepresentation.h"
 #include <stdio.h>
 
 /** Initialize module's internal state. */
@@ -15,30 +16,35 @@ void initializeGeneratorModule();
 void shutdownGeneratorModule();
 
 /**
- * Generates the final output using the current compiler state.
+ * Generates the final output from the IR of the current compiler state, as a
+ * Java class named "className", written into "outputFile" through a buffer. A
+ * long program is split in several methods, so each one can be compiled by
+ * the JIT. The nodes of the AVL and RBT trees are objects (i.e., "IntAVL" and
+ * "IntRBT"), unless "POOLED_TREES=true", which keeps them in pools of arrays
+ * (i.e., "PooledAVL" and "PooledRBT").
+ *
+ * Returns false if there is no memory left, or if the output cannot be
+ * written.
  */
-void generate(CompilerState * compilerState);
-
-void SetOutputFile(FILE *file);
+boolean generate(CompilerState * compilerState);
 
 /** PRIVATE FUNCTIONS */
-static const char _expressionTypeToCharacter(const ExpressionType type);
-static void _generateConstant(const unsigned int indentationLevel, Constant * constant);
-static void _generateEpilogue(void);
-static void _generateExpression(const unsigned int indentationLevel, Expression * expression);
-static void _generateFactor(const unsigned int indentationLevel, Factor * factor);
-static void _generateProgram(Program * program);
-static void _generatePrologue(void);
-static void _generateIterate(const unsigned int indentationLevel, IterateStatement * iterateStatement);
-static void _generateStatementList(StatementList statementList);
-static void _generateStatement(const unsigned int indentationLevel, Statement * statement);
-static void _generateBlock(const unsigned int indentationLevel, Block * block);
-static void _generateIfStatement(const unsigned int indentationLevel, IfStatement * ifStatement);
-static void _generateForStatement(const unsigned int indentationLevel, ForStatement * forStatement);
-static void _generateFunctionCall(const unsigned int indentationLevel, FunctionCall * functionCall);
-static void _generateDeclaration(const unsigned int indentationLevel, Declaration * declaration);
-static void _generateAssignment(const unsigned int indentationLevel, Assignment * assignment);
-static char * _indentation(const unsigned int indentationLevel);
-static void _output(const unsigned int indentationLevel, const char * const format, ...);
+static int _precedence(const IrOpcode opcode);
+static boolean _needsParentheses(IntermediateRepresentation * intermediateRepresentation, const IrInstruction * instruction, const unsigned int operand);
+static const char * _treeMethod(const IrOpcode opcode);
+static void _generateAtom(CompilerState * compilerState, const IrOperand * operand);
+static void _generateVariable(CompilerState * compilerState, const IrVariableIndex variable);
+static void _generateOperand(CompilerState * compilerState, const IrOperand * operand);
+static boolean _generateOperandOf(CompilerState * compilerState, NodeStack * nodeStack, const IrInstruction * instruction, const unsigned int operand);
+static const char * _typeName(const IrType type);
+static const char * _constructor(const IrType type);
+static void _generateDeclaration(CompilerState * compilerState, const unsigned int indentationLevel, const IrVariableIndex variable, const boolean field);
+static void _generateTreeCall(CompilerState * compilerState, const unsigned int indentationLevel, const IrInstruction * instruction);
+static void _generateEpilogue(CompilerState * compilerState);
+static void _generateFields(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation, const uint32_t * chunks);
+static void _generateStatements(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation, const uint32_t * chunks, const IrInstructionIndex start, const IrInstructionIndex end);
+static boolean _generateProgram(CompilerState * compilerState, IntermediateRepresentation * intermediateRepresentation);
+static void _generatePrologue(CompilerState * compilerState);
+static void _output(CompilerState * compilerState, const unsigned int indentationLevel, const char * const string);
 
 #endif
@@ -19,6 +19,11 @@ void shutdownCalculatorModule() {
 static BinaryOperator _expressionTypeToBinaryOperator(const ExpressionType type);
 static ComputationResult _invalidBinaryOperator(const int x, const int y);
 static ComputationResult _invalidComputation();
+static ComputationResult _validComputation(const int value);
+static boolean _isConstant(const Expression * expression, const ConstantType type, const int value);
+static boolean _isFoldable(const Expression * expression, const Expression * left, const Expression * right);
+static boolean _pinCalculations(AbstractSyntaxTree * abstractSyntaxTree, boolean * pinned);
+static unsigned int _foldOperation(AbstractSyntaxTree * abstractSyntaxTree, Expression * expression);
 
 /**
  * Converts and expression type to the proper binary operator. If that's not
@@ -29,6 +34,7 @@ static BinaryOperator _expressionTypeToBinaryOperator(const ExpressionType type)
 	switch (type) {
 		case ADDITION_EXP: return add;
 		case DIVISION_EXP: return divide;
+		case MODULE_EXP: return modulo;
 		case MULTIPLICATION_EXP: return multiply;
 		case SUBTRACTION_EXP: return subtract;
 		default:
@@ -55,12 +61,165 @@ static ComputationResult _invalidComputation() {
 	return computationResult;
 }
 
+/**
+ * A computation that always returns the specified value.
+ */
+static ComputationResult _validComputation(const int value) {
+	ComputationResult computationResult = {
+		.succeed = true,
+		.value = value
+	};
+	return computationResult;
+}
+
+/**
+ * Returns true if the expression is the specified constant.
+ */
+static boolean _isConstant(const Expression * expression, const ConstantType type, const int value) {
+	if (expression->type != CONSTANT_EXP || expression->constant.type != type) {
+		return false;
+	}
+	const int constant = type == INT_CONSTANT ? expression->constant.intValue : expression->constant.boolValue;
+	return constant == value ? true : false;
+}
+
+/**
+ * Returns true if the operands of a well-typed operation are constants, of
+ * the types the operation expects.
+ */
+static boolean _isFoldable(const Expression * expression, const Expression * left, const Expression * right) {
+	if (left->type != CONSTANT_EXP || right->type != CONSTANT_EXP || expression->varType == INVALID_VAR) {
+		return false;
+	}
+	switch (expression->type) {
+		case AND_EXP:
+		case OR_EXP:
+		case NOT_EXP:
+			return left->constant.type == BOOL_CONSTANT && right->constant.type == BOOL_CONSTANT;
+		case EQUAL_EXP:
+		case NOT_EQUAL_EXP:
+			return left->constant.type == right->constant.type;
+		default:
+			return left->constant.type == INT_CONSTANT && right->constant.type == INT_CONSTANT;
+	}
+}
+
+/**
+ * Marks every expression that is the argument of a "calculate" call (or part
+ * of one), walking each of them with an explicit stack.
+ */
+static boolean _pinCalculations(AbstractSyntaxTree * abstractSyntaxTree, boolean * pinned) {
+	NodeStack nodeStack;
+	initializeNodeStack(&nodeStack);
+	boolean succeed = true;
+	for (FunctionCallIndex index = 1; succeed && index < abstractSyntaxTree->functionCallCount; ++index) {
+		const FunctionCall * functionCall = &abstractSyntaxTree->functionCalls[index];
+		if (functionCall->type != CALCULATE_CALL) {
+			continue;
+		}
+		succeed = pushNodeFrame(&nodeStack, functionCall->expression, 0);
+		while (succeed && !isNodeStackEmpty(&nodeStack)) {
+			const ExpressionIndex expressionIndex = popNodeFrame(&nodeStack).index;
+			const Expression * expression = &abstractSyntaxTree->expressions[expressionIndex];
+			pinned[expressionIndex] = true;
+			switch (expression->type) {
+				case CONSTANT_EXP:
+				case VARIABLE_EXP:
+					break;
+				case PARENTHESIZED_EXP:
+					succeed = pushNodeFrame(&nodeStack, expression->expression, 0);
+					break;
+				case NOT_EXP:
+					succeed = pushNodeFrame(&nodeStack, expression->leftExpression, 0);
+					break;
+				default:
+					succeed = pushNodeFrame(&nodeStack, expression->leftExpression, 0)
+						&& pushNodeFrame(&nodeStack, expression->rightExpression, 0);
+					break;
+			}
+		}
+	}
+	finalizeNodeStack(&nodeStack);
+	return succeed;
+}
+
+/**
+ * Folds an operation whose operands were already folded, replacing the node
+ * with a constant or with one of its operands. Since an operand never has a
+ * lower precedence than its operation (or it would be parenthesized), the
+ * replacement is generated exactly as if it had been written that way.
+ * Returns 1 if the operation divides by a constant zero, or 0 otherwise.
+ */
+static unsigned int _foldOperation(AbstractSyntaxTree * abstractSyntaxTree, Expression * expression) {
+	const Expression * left = &abstractSyntaxTree->expressions[expression->leftExpression];
+	const Expression * right = expression->type == NOT_EXP ? left : &abstractSyntaxTree->expressions[expression->rightExpression];
+	const boolean isInteger = expression->varType == INT_VAR ? true : false;
+	const boolean isBoolean = expression->varType == BOOL_VAR ? true : false;
+	if ((expression->type == DIVISION_EXP || expression->type == MODULE_EXP) && isInteger && _isConstant(right, INT_CONSTANT, 0)) {
+		logError(_logger, "The divisor cannot be zero (the operation is a %s).", expression->type == DIVISION_EXP ? "division" : "modulo");
+		return 1;
+	}
+	if (_isFoldable(expression, left, right)) {
+		const int leftOperand = left->constant.type == INT_CONSTANT ? left->constant.intValue : left->constant.boolValue;
+		const int rightOperand = right->constant.type == INT_CONSTANT ? right->constant.intValue : right->constant.boolValue;
+		const ComputationResult result = computeOperation(expression->type, leftOperand, rightOperand);
+		if (result.succeed) {
+			const Expression constant = {
+				.type = CONSTANT_EXP,
+				.varType = expression->varType,
+				.constant = isBoolean
+					? (Constant) { .type = BOOL_CONSTANT, .boolValue = result.value != 0 }
+					: (Constant) { .type = INT_CONSTANT, .intValue = result.value }
+			};
+			*expression = constant;
+		}
+		return 0;
+	}
+	const Expression * replacement = NULL;
+	switch (expression->type) {
+		case ADDITION_EXP:
+			if (isInteger && _isConstant(right, INT_CONSTANT, 0)) replacement = left;
+			else if (isInteger && _isConstant(left, INT_CONSTANT, 0)) replacement = right;
+			break;
+		case SUBTRACTION_EXP:
+			if (isInteger && _isConstant(right, INT_CONSTANT, 0)) replacement = left;
+			break;
+		case MULTIPLICATION_EXP:
+			if (isInteger && _isConstant(right, INT_CONSTANT, 1)) replacement = left;
+			else if (isInteger && _isConstant(left, INT_CONSTANT, 1)) replacement = right;
+			break;
+		case DIVISION_EXP:
+			if (isInteger && _isConstant(right, INT_CONSTANT, 1)) replacement = left;
+			break;
+		case AND_EXP:
+			// "false && b" never evaluates "b", but "b && false" does.
+			if (isBoolean && _isConstant(left, BOOL_CONSTANT, false)) replacement = left;
+			else if (isBoolean && _isConstant(left, BOOL_CONSTANT, true)) replacement = right;
+			else if (isBoolean && _isConstant(right, BOOL_CONSTANT, true)) replacement = left;
+			break;
+		case OR_EXP:
+			if (isBoolean && _isConstant(left, BOOL_CONSTANT, true)) replacement = left;
+			else if (isBoolean && _isConstant(left, BOOL_CONSTANT, false)) replacement = right;
+			else if (isBoolean && _isConstant(right, BOOL_CONSTANT, false)) replacement = left;
+			break;
+		case NOT_EXP:
+			if (isBoolean && left->type == NOT_EXP) replacement = &abstractSyntaxTree->expressions[left->leftExpression];
+			break;
+		default:
+			break;
+	}
+	if (replacement != NULL) {
+		*expression = *replacement;
+	}
+	return 0;
+}
+
 /** PUBLIC FUNCTIONS */
 
 ComputationResult add(const int leftAddend, const int rightAddend) {
 	ComputationResult computationResult = {
 		.succeed = true,
-		.value = leftAddend + rightAddend
+		.value = (int) ((unsigned int) leftAddend + (unsigned int) rightAddend)
 	};
 	return computationResult;
 }
@@ -73,64 +232,151 @@ ComputationResult divide(const int dividend, const int divisor) {
 	}
 	ComputationResult computationResult = {
 		.succeed = divisionByZero ? false : true,
-		.value = divisionByZero ? (sign * INT_MAX) : (dividend / divisor)
+		// The only overflow (INT_MIN / -1) wraps around to INT_MIN.
+		.value = divisionByZero ? (sign * INT_MAX) : (divisor == -1 ? (int) (0u - (unsigned int) dividend) : (dividend / divisor))
 	};
 	return computationResult;
 }
 
-ComputationResult multiply(const int multiplicand, const int multiplier) {
+ComputationResult modulo(const int dividend, const int divisor) {
+	const boolean divisionByZero = divisor == 0 ? true : false;
+	if (divisionByZero) {
+		logError(_logger, "The divisor cannot be zero (the computation was %d%%%d).", dividend, divisor);
+	}
 	ComputationResult computationResult = {
-		.succeed = true,
-		.value = multiplicand * multiplier
+		.succeed = divisionByZero ? false : true,
+		// As in Java, the remainder has the sign of the dividend.
+		.value = (divisionByZero || divisor == -1) ? 0 : (dividend % divisor)
 	};
 	return computationResult;
 }
 
-ComputationResult subtract(const int minuend, const int subtract) {
+ComputationResult multiply(const int multiplicand, const int multiplier) {
 	ComputationResult computationResult = {
 		.succeed = true,
-		.value = minuend - subtract
+		.value = (int) ((unsigned int) multiplicand * (unsigned int) multiplier)
 	};
 	return computationResult;
 }
 
-ComputationResult computeConstant(Constant * constant) {
+ComputationResult subtract(const int minuend, const int subtract) {
 	ComputationResult computationResult = {
 		.succeed = true,
-		.value = constant->intValue
+		.value = (int) ((unsigned int) minuend - (unsigned int) subtract)
 	};
 	return computationResult;
 }
 
-ComputationResult computeExpression(Expression * expression) {
-	switch (expression->type) {
+ComputationResult computeOperation(const ExpressionType type, const int leftOperand, const int rightOperand) {
+	switch (type) {
 		case ADDITION_EXP:
 		case DIVISION_EXP:
+		case MODULE_EXP:
 		case MULTIPLICATION_EXP:
 		case SUBTRACTION_EXP:
-			ComputationResult leftResult = computeExpression(expression->leftExpression);
-			ComputationResult rightResult = computeExpression(expression->rightExpression);
-			if (leftResult.succeed && rightResult.succeed) {
-				BinaryOperator binaryOperator = _expressionTypeToBinaryOperator(expression->type);
-				return binaryOperator(leftResult.value, rightResult.value);
-			}
-			else {
-				return _invalidComputation();
-			}
-		case FACTOR_EXP:
-			return computeFactor(expression->factor);
+			return _expressionTypeToBinaryOperator(type)(leftOperand, rightOperand);
+		case EQUAL_EXP: return _validComputation(leftOperand == rightOperand);
+		case NOT_EQUAL_EXP: return _validComputation(leftOperand != rightOperand);
+		case GREATER_EXP: return _validComputation(leftOperand > rightOperand);
+		case GREATER_EQUAL_EXP: return _validComputation(leftOperand >= rightOperand);
+		case LESS_EXP: return _validComputation(leftOperand < rightOperand);
+		case LESS_EQUAL_EXP: return _validComputation(leftOperand <= rightOperand);
+		case AND_EXP: return _validComputation(leftOperand && rightOperand);
+		case OR_EXP: return _validComputation(leftOperand || rightOperand);
+		case NOT_EXP: return _validComputation(!leftOperand);
 		default:
 			return _invalidComputation();
 	}
 }
 
-ComputationResult computeFactor(Factor * factor) {
-	switch (factor->type) {
-		case CONSTANT_FACTOR:
-			return computeConstant(factor->constant);
-		case EXPRESSION_FACTOR:
-			return computeExpression(factor->expression);
-		default:
-			return _invalidComputation();
+ComputationResult computeConstant(Constant * constant) {
+	ComputationResult computationResult = {
+		.succeed = true,
+		.value = constant->type == INT_CONSTANT ? constant->intValue : constant->boolValue
+	};
+	return computationResult;
+}
+
+ComputationResult computeExpression(AbstractSyntaxTree * abstractSyntaxTree, const ExpressionIndex index) {
+	// The expression is walked in post-order with an explicit stack, and the
+	// values of the operands wait in another one (as "NodeFrame" indices).
+	NodeStack nodeStack;
+	NodeStack valueStack;
+	initializeNodeStack(&nodeStack);
+	initializeNodeStack(&valueStack);
+	boolean succeed = pushNodeFrame(&nodeStack, index, 0);
+	while (succeed && !isNodeStackEmpty(&nodeStack)) {
+		NodeFrame * frame = peekNodeFrame(&nodeStack);
+		Expression * expression = &abstractSyntaxTree->expressions[frame->index];
+		const uint32_t stage = frame->stage++;
+		const uint32_t operands = expression->type == NOT_EXP ? 1 : 2;
+		switch (expression->type) {
+			case CONSTANT_EXP:
+				popNodeFrame(&nodeStack);
+				succeed = pushNodeFrame(&valueStack, (uint32_t) computeConstant(&expression->constant).value, 0);
+				break;
+			case PARENTHESIZED_EXP:
+				if (stage == 0) {
+					succeed = pushNodeFrame(&nodeStack, expression->expression, 0);
+				}
+				else {
+					popNodeFrame(&nodeStack);
+				}
+				break;
+			case VARIABLE_EXP:
+				succeed = false;
+				break;
+			default:
+				if (stage < operands) {
+					succeed = pushNodeFrame(&nodeStack, stage == 0 ? expression->leftExpression : expression->rightExpression, 0);
+				}
+				else {
+					popNodeFrame(&nodeStack);
+					const int rightOperand = operands == 2 ? (int) popNodeFrame(&valueStack).index : 0;
+					const int leftOperand = (int) popNodeFrame(&valueStack).index;
+					const ComputationResult result = computeOperation(expression->type, leftOperand, rightOperand);
+					succeed = result.succeed && pushNodeFrame(&valueStack, (uint32_t) result.value, 0);
+				}
+				break;
+		}
+	}
+	const ComputationResult computationResult = succeed
+		? _validComputation((int) popNodeFrame(&valueStack).index)
+		: _invalidComputation();
+	finalizeNodeStack(&valueStack);
+	finalizeNodeStack(&nodeStack);
+	return computationResult;
+}
+
+unsigned int foldConstants(AbstractSyntaxTree * abstractSyntaxTree) {
+	boolean * pinned = calloc(abstractSyntaxTree->expressionCount, sizeof(boolean));
+	if (pinned == NULL || !_pinCalculations(abstractSyntaxTree, pinned)) {
+		logCritical(_logger, "Cannot allocate the state of the constant folding.");
+		free(pinned);
+		return 0;
+	}
+	// The operands of an expression always have lower indices, so a single
+	// forward pass folds them before the expression itself.
+	unsigned int divisionsByZero = 0;
+	for (ExpressionIndex index = 1; index < abstractSyntaxTree->expressionCount; ++index) {
+		Expression * expression = &abstractSyntaxTree->expressions[index];
+		if (pinned[index]) {
+			continue;
+		}
+		switch (expression->type) {
+			case CONSTANT_EXP:
+			case VARIABLE_EXP:
+				break;
+			case PARENTHESIZED_EXP:
+				if (abstractSyntaxTree->expressions[expression->expression].type == CONSTANT_EXP) {
+					*expression = abstractSyntaxTree->expressions[expression->expression];
+				}
+				break;
+			default:
+				divisionsByZero += _foldOperation(abstractSyntaxTree, expression);
+				break;
+		}
 	}
+	free(pinned);
+	return divisionsByZero;
 }
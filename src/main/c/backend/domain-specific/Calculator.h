@@ -19,7 +19,7 @@ void shutdownCalculatorModule();
 
 /**
  * The result of a computation. It's considered valid only if "succeed" is
- * true.
+ * true. Booleans are computed as integers (0 is false, and 1 is true).
  */
 typedef struct {
 	boolean succeed;
@@ -28,26 +28,42 @@ typedef struct {
 
 typedef ComputationResult (*BinaryOperator)(const int, const int);
 
-/** Arithmetic operations. */
+/**
+ * Arithmetic operations. They wrap around on overflow, as the generated Java
+ * code does.
+ */
 
 ComputationResult add(const int leftAddend, const int rightAddend);
 ComputationResult divide(const int dividend, const int divisor);
+ComputationResult modulo(const int dividend, const int divisor);
 ComputationResult multiply(const int multiplicand, const int multiplier);
 ComputationResult subtract(const int minuend, const int subtract);
 
+/**
+ * Computes an operation of the AST over its operands (the right one is
+ * ignored by "NOT_EXP").
+ */
+ComputationResult computeOperation(const ExpressionType type, const int leftOperand, const int rightOperand);
+
 /**
  * Computes the final value of a mathematical constant.
  */
 ComputationResult computeConstant(Constant * constant);
 
 /**
- * Computes the final value of a mathematical expression.
+ * Computes the final value of a mathematical expression of the AST.
  */
-ComputationResult computeExpression(Expression * expression);
+ComputationResult computeExpression(AbstractSyntaxTree * abstractSyntaxTree, const ExpressionIndex index);
 
 /**
- * Computes the final value of a mathematical factor.
+ * Folds every constant subexpression of the AST into a single constant, and
+ * simplifies the identities "x * 1", "x / 1", "x + 0", "x - 0", "!!b", and
+ * those of "&&" and "||" with a constant operand. The expressions of
+ * "calculate" are kept verbatim, since they are the content of a tree.
+ *
+ * Every division (or modulo) by a constant zero is reported, and the number of
+ * them is returned.
  */
-ComputationResult computeFactor(Factor * factor);
+unsigned int foldConstants(AbstractSyntaxTree * abstractSyntaxTree);
 
 #endif
@@ -0,0 +1,1091 @@
+#include "NativeTree.h"
+
+/* MODULE INTERNAL STATE */
+
+static const char * _nullPointerException = "java.lang.NullPointerException";
+static const char * _outOfMemoryError = "java.lang.OutOfMemoryError";
+static Logger * _logger = NULL;
+
+void initializeNativeTreeModule() {
+	_logger = createLogger("NativeTree");
+}
+
+void shutdownNativeTreeModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+typedef enum {
+	NATIVE_BLACK,
+	NATIVE_RED
+} NativeColor;
+
+typedef struct NativeNode NativeNode;
+
+struct NativeNode {
+	NativeNode * left;
+	NativeNode * right;
+	// Only kept by an RBT.
+	NativeNode * parent;
+	int data;
+	// Only kept by an AVL (a leaf has a height of 0).
+	int h;
+	// The border color, which is only red in an RBT.
+	NativeColor color;
+};
+
+struct NativeTree {
+	NativeTreeType type;
+	NativeNode * root;
+
+	// The sentinel of an RBT (the "TNULL" of the runtime, whose data is null),
+	// which is every missing child. It's NULL in the other trees.
+	NativeNode * nil;
+	NativeNode sentinel;
+
+	// A stack of nodes (or of links to nodes), for the iterative operations.
+	void ** stack;
+	uint32_t stackCount;
+	uint32_t stackCapacity;
+};
+
+/**
+ * The operators of a calculation, in the order of the precedence matrix of
+ * the runtime. An entry is true if the operator on top of the stack must be
+ * popped before the current one is pushed.
+ */
+static const char * _operators = "+-*/^()";
+static const boolean _precedences[6][7] = {
+	{ true, true, false, false, false, false, true },
+	{ true, true, false, false, false, false, true },
+	{ true, true, true, true, false, false, true },
+	{ true, true, true, true, false, false, true },
+	{ true, true, true, true, false, false, true },
+	{ false, false, false, false, false, false, false }
+};
+
+/**
+ * A token of a calculation: an operator, or a number.
+ */
+typedef struct {
+	char operator;
+	double number;
+} CalculationToken;
+
+/* PRIVATE FUNCTIONS */
+
+static NativeTreeResult _exception(const char * exception);
+static NativeTreeResult _result(const int value);
+static NativeNode * _createNode(NativeTree * tree, const int data);
+static boolean _isEmpty(const NativeTree * tree, const NativeNode * node);
+static boolean _push(NativeTree * tree, void * item);
+static int _height(const NativeNode * node);
+static int _compareIntegers(const void * left, const void * right);
+static int * _sortedElements(const int * elements, const uint32_t count, const boolean keepDuplicates, uint32_t * sortedCount);
+static NativeTreeResult _insertIntoBst(NativeTree * tree, const int element);
+static void _removeFromBst(NativeTree * tree, const int element);
+static int _avlBalance(const NativeNode * node);
+static NativeNode * _rotateAvlLeft(NativeNode * x);
+static NativeNode * _rotateAvlRight(NativeNode * y);
+static NativeNode * _rebalanceAvlInsertion(NativeNode * node, const int element);
+static NativeNode * _rebalanceAvlDeletion(NativeNode * node);
+static NativeTreeResult _insertIntoAvl(NativeTree * tree, const int element);
+static NativeTreeResult _removeFromAvl(NativeTree * tree, const int element);
+static NativeNode * _buildAvl(NativeTree * tree, const int * sorted, const uint32_t from, const uint32_t to, boolean * exhausted);
+static void _rotateRbtLeft(NativeTree * tree, NativeNode * x);
+static void _rotateRbtRight(NativeTree * tree, NativeNode * x);
+static NativeTreeResult _fixRbtInsertion(NativeTree * tree, NativeNode * k);
+static NativeTreeResult _insertIntoRbt(NativeTree * tree, const int element);
+static void _transplantRbt(NativeTree * tree, NativeNode * u, NativeNode * v);
+static NativeTreeResult _fixRbtDeletion(NativeTree * tree, NativeNode * x);
+static NativeTreeResult _removeFromRbt(NativeTree * tree, const int element, FILE * output);
+static NativeNode * _buildRbt(NativeTree * tree, const int * sorted, const uint32_t from, const uint32_t to, NativeNode * parent, const int depth, const int redDepth, boolean * exhausted);
+static void _visualizeNode(NativeTree * tree, const NativeNode * node, FILE * file, unsigned int * nils);
+static void _visualizeLink(NativeTree * tree, const NativeNode * node, const NativeNode * child, FILE * file, unsigned int * nils);
+static boolean _isNumber(const char * token, const size_t length);
+static int _castToInteger(const double value);
+
+/**
+ * Returns the result of an operation that throws the specified exception.
+ */
+static NativeTreeResult _exception(const char * exception) {
+	NativeTreeResult result = {
+		.exception = exception,
+		.value = 0
+	};
+	return result;
+}
+
+/**
+ * Returns the result of an operation that succeeds with the specified value.
+ */
+static NativeTreeResult _result(const int value) {
+	NativeTreeResult result = {
+		.exception = NULL,
+		.value = value
+	};
+	return result;
+}
+
+/**
+ * Creates a black node, with no children (nor parent). Returns NULL if there
+ * is no memory left.
+ */
+static NativeNode * _createNode(NativeTree * tree, const int data) {
+	NativeNode * node = malloc(sizeof(NativeNode));
+	if (node == NULL) {
+		logCritical(_logger, "Cannot allocate a node of the tree.");
+		return NULL;
+	}
+	node->left = tree->nil;
+	node->right = tree->nil;
+	node->parent = tree->nil;
+	node->data = data;
+	node->h = 0;
+	node->color = NATIVE_BLACK;
+	return node;
+}
+
+/**
+ * Returns true if the node is missing, that is, if it's NULL or the sentinel
+ * of an RBT.
+ */
+static boolean _isEmpty(const NativeTree * tree, const NativeNode * node) {
+	return node == NULL || node == tree->nil;
+}
+
+/**
+ * Pushes an item to the stack of the tree. Returns false if there is no
+ * memory left.
+ */
+static boolean _push(NativeTree * tree, void * item) {
+	if (tree->stackCount == tree->stackCapacity) {
+		const uint32_t capacity = tree->stackCapacity == 0 ? 64 : 2 * tree->stackCapacity;
+		void ** stack = realloc(tree->stack, capacity * sizeof(void *));
+		if (stack == NULL) {
+			logCritical(_logger, "Cannot allocate a stack of %u item(s).", capacity);
+			return false;
+		}
+		tree->stack = stack;
+		tree->stackCapacity = capacity;
+	}
+	tree->stack[tree->stackCount++] = item;
+	return true;
+}
+
+/**
+ * Returns the height of a node, which is 0 if it's missing (as "heightFromNode"
+ * does).
+ */
+static int _height(const NativeNode * node) {
+	return node == NULL ? 0 : node->h;
+}
+
+static int _compareIntegers(const void * left, const void * right) {
+	const int leftInteger = *(const int *) left;
+	const int rightInteger = *(const int *) right;
+	return (leftInteger > rightInteger) - (leftInteger < rightInteger);
+}
+
+/**
+ * Returns a sorted copy of the elements (without duplicates, unless they must
+ * be kept), as "sortedElements" does. Returns NULL if there is no memory left.
+ */
+static int * _sortedElements(const int * elements, const uint32_t count, const boolean keepDuplicates, uint32_t * sortedCount) {
+	int * sorted = malloc((count == 0 ? 1 : count) * sizeof(int));
+	if (sorted == NULL) {
+		logCritical(_logger, "Cannot allocate a list of %u element(s).", count);
+		return NULL;
+	}
+	boolean ascending = true;
+	for (uint32_t k = 0; k < count; ++k) {
+		sorted[k] = elements[k];
+		ascending = ascending && (k == 0 || elements[k - 1] <= elements[k]);
+	}
+	if (!ascending) {
+		qsort(sorted, count, sizeof(int), _compareIntegers);
+	}
+	*sortedCount = count;
+	if (!keepDuplicates) {
+		uint32_t distinct = 0;
+		for (uint32_t k = 0; k < count; ++k) {
+			if (distinct == 0 || sorted[distinct - 1] != sorted[k]) {
+				sorted[distinct++] = sorted[k];
+			}
+		}
+		*sortedCount = distinct;
+	}
+	return sorted;
+}
+
+/**
+ * Inserts an element into a BST, unless it's already there.
+ */
+static NativeTreeResult _insertIntoBst(NativeTree * tree, const int element) {
+	NativeNode ** link = &tree->root;
+	while (*link != NULL) {
+		if (element == (*link)->data) {
+			return _result(0);
+		}
+		link = element < (*link)->data ? &(*link)->left : &(*link)->right;
+	}
+	*link = _createNode(tree, element);
+	return *link == NULL ? _exception(_outOfMemoryError) : _result(0);
+}
+
+/**
+ * Removes an element from a BST. A node with two children takes the minimum
+ * of its right subtree, but the runtime keeps removing the original element
+ * from there (so the minimum is only removed if it's a duplicate of it).
+ */
+static void _removeFromBst(NativeTree * tree, const int element) {
+	NativeNode ** link = &tree->root;
+	while (*link != NULL) {
+		NativeNode * node = *link;
+		if (element < node->data) {
+			link = &node->left;
+		}
+		else if (element > node->data) {
+			link = &node->right;
+		}
+		else if (node->left == NULL || node->right == NULL) {
+			*link = node->left == NULL ? node->right : node->left;
+			free(node);
+			return;
+		}
+		else {
+			NativeNode * minimum = node->right;
+			while (minimum->left != NULL) {
+				minimum = minimum->left;
+			}
+			node->data = minimum->data;
+			link = &node->right;
+		}
+	}
+}
+
+static int _avlBalance(const NativeNode * node) {
+	return node == NULL ? 0 : _height(node->left) - _height(node->right);
+}
+
+static NativeNode * _rotateAvlLeft(NativeNode * x) {
+	NativeNode * y = x->right;
+	x->right = y->left;
+	y->left = x;
+	x->h = (_height(x->left) > _height(x->right) ? _height(x->left) : _height(x->right)) + 1;
+	y->h = (_height(y->left) > _height(y->right) ? _height(y->left) : _height(y->right)) + 1;
+	return y;
+}
+
+static NativeNode * _rotateAvlRight(NativeNode * y) {
+	NativeNode * x = y->left;
+	y->left = x->right;
+	x->right = y;
+	y->h = (_height(y->left) > _height(y->right) ? _height(y->left) : _height(y->right)) + 1;
+	x->h = (_height(x->left) > _height(x->right) ? _height(x->left) : _height(x->right)) + 1;
+	return x;
+}
+
+/**
+ * Updates the height of an ancestor of an inserted element, and rotates it if
+ * it's unbalanced. Returns the new root of its subtree.
+ */
+static NativeNode * _rebalanceAvlInsertion(NativeNode * node, const int element) {
+	node->h = 1 + (_height(node->left) > _height(node->right) ? _height(node->left) : _height(node->right));
+	const int balance = _avlBalance(node);
+	if (balance > 1 && element < node->left->data) {
+		return _rotateAvlRight(node);
+	}
+	if (balance < -1 && element > node->right->data) {
+		return _rotateAvlLeft(node);
+	}
+	if (balance > 1 && element > node->left->data) {
+		node->left = _rotateAvlLeft(node->left);
+		return _rotateAvlRight(node);
+	}
+	if (balance < -1 && element < node->right->data) {
+		node->right = _rotateAvlRight(node->right);
+		return _rotateAvlLeft(node);
+	}
+	return node;
+}
+
+/**
+ * Updates the height of an ancestor of a removed element (as the runtime does,
+ * with "max(hl, hr + 1)"), and rotates it if it's unbalanced. Returns the new
+ * root of its subtree.
+ */
+static NativeNode * _rebalanceAvlDeletion(NativeNode * node) {
+	node->h = _height(node->left) > _height(node->right) + 1 ? _height(node->left) : _height(node->right) + 1;
+	const int balance = _avlBalance(node);
+	if (balance > 1 && _avlBalance(node->left) >= 0) {
+		return _rotateAvlRight(node);
+	}
+	if (balance > 1 && _avlBalance(node->left) < 0) {
+		node->left = _rotateAvlLeft(node->left);
+		return _rotateAvlRight(node);
+	}
+	if (balance < -1 && _avlBalance(node->right) <= 0) {
+		return _rotateAvlLeft(node);
+	}
+	if (balance < -1 && _avlBalance(node->right) > 0) {
+		node->right = _rotateAvlRight(node->right);
+		return _rotateAvlLeft(node);
+	}
+	return node;
+}
+
+/**
+ * Inserts an element into an AVL, unless it's already there. The links to the
+ * ancestors are stacked on the way down, and rebalanced on the way up, as the
+ * recursion of the runtime does.
+ */
+static NativeTreeResult _insertIntoAvl(NativeTree * tree, const int element) {
+	tree->stackCount = 0;
+	NativeNode ** link = &tree->root;
+	while (*link != NULL && (*link)->data != element) {
+		if (!_push(tree, link)) {
+			return _exception(_outOfMemoryError);
+		}
+		link = element < (*link)->data ? &(*link)->left : &(*link)->right;
+	}
+	if (*link == NULL) {
+		*link = _createNode(tree, element);
+		if (*link == NULL) {
+			return _exception(_outOfMemoryError);
+		}
+	}
+	while (0 < tree->stackCount) {
+		NativeNode ** ancestor = tree->stack[--tree->stackCount];
+		*ancestor = _rebalanceAvlInsertion(*ancestor, element);
+	}
+	return _result(0);
+}
+
+/**
+ * Removes an element from an AVL. A node with two children takes the data of
+ * its successor, which is then removed from its right subtree.
+ */
+static NativeTreeResult _removeFromAvl(NativeTree * tree, const int element) {
+	tree->stackCount = 0;
+	NativeNode ** link = &tree->root;
+	int key = element;
+	while (*link != NULL) {
+		NativeNode * node = *link;
+		if (key == node->data && (node->left == NULL || node->right == NULL)) {
+			*link = node->left == NULL ? node->right : node->left;
+			free(node);
+			if (*link != NULL) {
+				*link = _rebalanceAvlDeletion(*link);
+			}
+			break;
+		}
+		if (!_push(tree, link)) {
+			return _exception(_outOfMemoryError);
+		}
+		if (key < node->data) {
+			link = &node->left;
+		}
+		else if (key > node->data) {
+			link = &node->right;
+		}
+		else {
+			NativeNode * successor = node->right;
+			while (successor->left != NULL) {
+				successor = successor->left;
+			}
+			node->data = successor->data;
+			key = successor->data;
+			link = &node->right;
+		}
+	}
+	while (0 < tree->stackCount) {
+		NativeNode ** ancestor = tree->stack[--tree->stackCount];
+		*ancestor = _rebalanceAvlDeletion(*ancestor);
+	}
+	return _result(0);
+}
+
+/**
+ * Builds a balanced AVL with the sorted elements in [from, to). The recursion
+ * is as deep as the tree, that is, logarithmic.
+ */
+static NativeNode * _buildAvl(NativeTree * tree, const int * sorted, const uint32_t from, const uint32_t to, boolean * exhausted) {
+	if (from == to || *exhausted) {
+		return NULL;
+	}
+	const uint32_t middle = (from + to) >> 1;
+	NativeNode * node = _createNode(tree, sorted[middle]);
+	if (node == NULL) {
+		*exhausted = true;
+		return NULL;
+	}
+	node->left = _buildAvl(tree, sorted, from, middle, exhausted);
+	node->right = _buildAvl(tree, sorted, middle + 1, to, exhausted);
+	if (node->left != NULL || node->right != NULL) {
+		node->h = 1 + (_height(node->left) > _height(node->right) ? _height(node->left) : _height(node->right));
+	}
+	return node;
+}
+
+static void _rotateRbtLeft(NativeTree * tree, NativeNode * x) {
+	NativeNode * y = x->right;
+	x->right = y->left;
+	if (y->left != tree->nil) {
+		y->left->parent = x;
+	}
+	y->parent = x->parent;
+	if (x->parent == tree->nil) {
+		tree->root = y;
+	}
+	else if (x == x->parent->left) {
+		x->parent->left = y;
+	}
+	else {
+		x->parent->right = y;
+	}
+	y->left = x;
+	x->parent = y;
+}
+
+static void _rotateRbtRight(NativeTree * tree, NativeNode * x) {
+	NativeNode * y = x->left;
+	x->left = y->right;
+	if (y->right != tree->nil) {
+		y->right->parent = x;
+	}
+	y->parent = x->parent;
+	if (x->parent == tree->nil) {
+		tree->root = y;
+	}
+	else if (x == x->parent->right) {
+		x->parent->right = y;
+	}
+	else {
+		x->parent->left = y;
+	}
+	y->right = x;
+	x->parent = y;
+}
+
+/**
+ * Restores the colors of an RBT after an insertion. The uncle is missing (so
+ * the runtime throws) only if the grandparent is the sentinel.
+ */
+static NativeTreeResult _fixRbtInsertion(NativeTree * tree, NativeNode * k) {
+	while (k->parent->color == NATIVE_RED) {
+		NativeNode * grandparent = k->parent->parent;
+		const boolean right = k->parent == grandparent->right;
+		NativeNode * uncle = right ? grandparent->left : grandparent->right;
+		if (uncle == NULL) {
+			return _exception(_nullPointerException);
+		}
+		if (uncle->color == NATIVE_RED) {
+			uncle->color = NATIVE_BLACK;
+			k->parent->color = NATIVE_BLACK;
+			grandparent->color = NATIVE_RED;
+			k = grandparent;
+		}
+		else if (right) {
+			if (k == k->parent->left) {
+				k = k->parent;
+				_rotateRbtRight(tree, k);
+			}
+			k->parent->color = NATIVE_BLACK;
+			k->parent->parent->color = NATIVE_RED;
+			_rotateRbtLeft(tree, k->parent->parent);
+		}
+		else {
+			if (k == k->parent->right) {
+				k = k->parent;
+				_rotateRbtLeft(tree, k);
+			}
+			k->parent->color = NATIVE_BLACK;
+			k->parent->parent->color = NATIVE_RED;
+			_rotateRbtRight(tree, k->parent->parent);
+		}
+		if (k == tree->root) {
+			break;
+		}
+	}
+	tree->root->color = NATIVE_BLACK;
+	return _result(0);
+}
+
+/**
+ * Inserts a red element into an RBT (a duplicate goes to the right), and
+ * fixes the colors, unless its parent is the root.
+ */
+static NativeTreeResult _insertIntoRbt(NativeTree * tree, const int element) {
+	NativeNode * node = _createNode(tree, element);
+	if (node == NULL) {
+		return _exception(_outOfMemoryError);
+	}
+	node->color = NATIVE_RED;
+	NativeNode * y = tree->nil;
+	NativeNode * x = tree->root;
+	while (x != tree->nil) {
+		y = x;
+		x = element < x->data ? x->left : x->right;
+	}
+	node->parent = y;
+	if (y == tree->nil) {
+		tree->root = node;
+	}
+	else if (element < y->data) {
+		y->left = node;
+	}
+	else {
+		y->right = node;
+	}
+	if (node->parent == tree->nil) {
+		node->color = NATIVE_BLACK;
+		return _result(0);
+	}
+	if (node->parent->parent == tree->nil) {
+		return _result(0);
+	}
+	return _fixRbtInsertion(tree, node);
+}
+
+static void _transplantRbt(NativeTree * tree, NativeNode * u, NativeNode * v) {
+	if (u->parent == tree->nil) {
+		tree->root = v;
+	}
+	else if (u == u->parent->left) {
+		u->parent->left = v;
+	}
+	else {
+		u->parent->right = v;
+	}
+	v->parent = u->parent;
+}
+
+/**
+ * Restores the colors of an RBT after a deletion. As in the runtime, the
+ * mirrored case 3.2 only checks the right child of the sibling. A missing
+ * sibling (i.e., the sentinel, without children) makes the runtime throw.
+ */
+static NativeTreeResult _fixRbtDeletion(NativeTree * tree, NativeNode * x) {
+	while (x != tree->root && x->color == NATIVE_BLACK) {
+		if (x == x->parent->left) {
+			NativeNode * s = x->parent->right;
+			if (s->color == NATIVE_RED) {
+				s->color = NATIVE_BLACK;
+				x->parent->color = NATIVE_RED;
+				_rotateRbtLeft(tree, x->parent);
+				s = x->parent->right;
+			}
+			if (s->left == NULL) {
+				return _exception(_nullPointerException);
+			}
+			if (s->left->color == NATIVE_BLACK && s->right->color == NATIVE_BLACK) {
+				s->color = NATIVE_RED;
+				x = x->parent;
+			}
+			else {
+				if (s->right->color == NATIVE_BLACK) {
+					s->left->color = NATIVE_BLACK;
+					s->color = NATIVE_RED;
+					_rotateRbtRight(tree, s);
+					s = x->parent->right;
+				}
+				s->color = x->parent->color;
+				x->parent->color = NATIVE_BLACK;
+				s->right->color = NATIVE_BLACK;
+				_rotateRbtLeft(tree, x->parent);
+				x = tree->root;
+			}
+		}
+		else {
+			NativeNode * s = x->parent->left;
+			if (s->color == NATIVE_RED) {
+				s->color = NATIVE_BLACK;
+				x->parent->color = NATIVE_RED;
+				_rotateRbtRight(tree, x->parent);
+				s = x->parent->left;
+			}
+			if (s->right == NULL) {
+				return _exception(_nullPointerException);
+			}
+			if (s->right->color == NATIVE_BLACK) {
+				s->color = NATIVE_RED;
+				x = x->parent;
+			}
+			else {
+				if (s->left->color == NATIVE_BLACK) {
+					s->right->color = NATIVE_BLACK;
+					s->color = NATIVE_RED;
+					_rotateRbtLeft(tree, s);
+					s = x->parent->left;
+				}
+				s->color = x->parent->color;
+				x->parent->color = NATIVE_BLACK;
+				s->left->color = NATIVE_BLACK;
+				_rotateRbtRight(tree, x->parent);
+				x = tree->root;
+			}
+		}
+	}
+	x->color = NATIVE_BLACK;
+	return _result(0);
+}
+
+/**
+ * Removes an element from an RBT (the last one found on the way down, if it's
+ * duplicated), or writes a line to the output if it's missing.
+ */
+static NativeTreeResult _removeFromRbt(NativeTree * tree, const int element, FILE * output) {
+	NativeNode * z = tree->nil;
+	NativeNode * node = tree->root;
+	while (node != tree->nil) {
+		if (node->data == element) {
+			z = node;
+		}
+		node = node->data <= element ? node->right : node->left;
+	}
+	if (z == tree->nil) {
+		fputs("Couldn't find key in the tree\n", output);
+		return _result(0);
+	}
+	NativeNode * x;
+	NativeNode * y = z;
+	NativeColor originalColor = y->color;
+	if (z->left == tree->nil) {
+		x = z->right;
+		_transplantRbt(tree, z, z->right);
+	}
+	else if (z->right == tree->nil) {
+		x = z->left;
+		_transplantRbt(tree, z, z->left);
+	}
+	else {
+		y = z->right;
+		while (y->left != tree->nil) {
+			y = y->left;
+		}
+		originalColor = y->color;
+		x = y->right;
+		if (y->parent == z) {
+			x->parent = y;
+		}
+		else {
+			_transplantRbt(tree, y, y->right);
+			y->right = z->right;
+			y->right->parent = y;
+		}
+		_transplantRbt(tree, z, y);
+		y->left = z->left;
+		y->left->parent = y;
+		y->color = z->color;
+	}
+	free(z);
+	return originalColor == NATIVE_BLACK ? _fixRbtDeletion(tree, x) : _result(0);
+}
+
+/**
+ * Builds a balanced RBT with the sorted elements in [from, to), where only the
+ * nodes at the red depth are red. The recursion is logarithmic.
+ */
+static NativeNode * _buildRbt(NativeTree * tree, const int * sorted, const uint32_t from, const uint32_t to, NativeNode * parent, const int depth, const int redDepth, boolean * exhausted) {
+	if (from == to || *exhausted) {
+		return tree->nil;
+	}
+	const uint32_t middle = (from + to) >> 1;
+	NativeNode * node = _createNode(tree, sorted[middle]);
+	if (node == NULL) {
+		*exhausted = true;
+		return tree->nil;
+	}
+	node->parent = parent;
+	node->color = depth == redDepth ? NATIVE_RED : NATIVE_BLACK;
+	node->left = _buildRbt(tree, sorted, from, middle, node, depth + 1, redDepth, exhausted);
+	node->right = _buildRbt(tree, sorted, middle + 1, to, node, depth + 1, redDepth, exhausted);
+	return node;
+}
+
+/**
+ * Writes a node to the graph, with its links (unless it's a leaf): a missing
+ * child is linked to an invisible node, and the sentinel to a "nil" node.
+ */
+static void _visualizeNode(NativeTree * tree, const NativeNode * node, FILE * file, unsigned int * nils) {
+	fprintf(file, "\"%d\" [\"fillcolor\"=\"white\",\"color\"=\"%s\",\"style\"=\"filled\"]\n",
+		node->data, node->color == NATIVE_RED ? "red" : "black");
+	if (node->left != NULL || node->right != NULL) {
+		_visualizeLink(tree, node, node->left, file, nils);
+		_visualizeLink(tree, node, node->right, file, nils);
+	}
+}
+
+static void _visualizeLink(NativeTree * tree, const NativeNode * node, const NativeNode * child, FILE * file, unsigned int * nils) {
+	if (child == NULL) {
+		fprintf(file, "\"%d\" -> \"invisible\" [\"style\"=\"invis\"]\n", node->data);
+		fputs("\"invisible\" [\"style\"=\"invis\"]\n", file);
+	}
+	else if (child == tree->nil) {
+		fprintf(file, "\"%d\" -> \"nil%u\"\n", node->data, *nils);
+		fprintf(file, "\"nil%u\" [\"label\"=\"nil\"]\n", (*nils)++);
+	}
+	else {
+		fprintf(file, "\"%d\" -> \"%d\"\n", node->data, child->data);
+	}
+}
+
+/**
+ * Returns true if the token is a number of a calculation, that is, if it
+ * matches "-?[0-9]+(\.[0-9]+)?".
+ */
+static boolean _isNumber(const char * token, const size_t length) {
+	size_t k = token[0] == '-' ? 1 : 0;
+	const size_t integerStart = k;
+	while (k < length && '0' <= token[k] && token[k] <= '9') {
+		++k;
+	}
+	if (k == integerStart) {
+		return false;
+	}
+	if (k < length && token[k] == '.') {
+		const size_t fractionStart = ++k;
+		while (k < length && '0' <= token[k] && token[k] <= '9') {
+			++k;
+		}
+		if (k == fractionStart) {
+			return false;
+		}
+	}
+	return k == length;
+}
+
+/**
+ * Casts a "double" to an "int", as Java does: a NaN is 0, and the values out
+ * of range saturate.
+ */
+static int _castToInteger(const double value) {
+	if (isnan(value)) {
+		return 0;
+	}
+	if (value >= (double) INT_MAX) {
+		return INT_MAX;
+	}
+	if (value <= (double) INT_MIN) {
+		return INT_MIN;
+	}
+	return (int) value;
+}
+
+/* PUBLIC FUNCTIONS */
+
+NativeTree * createNativeTree(const NativeTreeType type) {
+	NativeTree * tree = calloc(1, sizeof(NativeTree));
+	if (tree == NULL) {
+		logCritical(_logger, "Cannot allocate a tree.");
+		return NULL;
+	}
+	tree->type = type;
+	if (type == NATIVE_RBT_TREE) {
+		tree->sentinel.color = NATIVE_BLACK;
+		tree->nil = &tree->sentinel;
+		tree->root = tree->nil;
+	}
+	return tree;
+}
+
+NativeTreeResult insertIntoNativeTree(NativeTree * tree, const int element) {
+	switch (tree->type) {
+		case NATIVE_AVL_TREE: return _insertIntoAvl(tree, element);
+		case NATIVE_BST_TREE: return _insertIntoBst(tree, element);
+		case NATIVE_RBT_TREE: return _insertIntoRbt(tree, element);
+		default:
+			return _result(0);
+	}
+}
+
+NativeTreeResult insertAllIntoNativeTree(NativeTree * tree, const int * elements, const uint32_t count) {
+	const boolean balanced = tree->type == NATIVE_AVL_TREE || tree->type == NATIVE_RBT_TREE;
+	if (!balanced || !_isEmpty(tree, tree->root)) {
+		for (uint32_t k = 0; k < count; ++k) {
+			const NativeTreeResult result = insertIntoNativeTree(tree, elements[k]);
+			if (result.exception != NULL) {
+				return result;
+			}
+		}
+		return _result(0);
+	}
+	const boolean keepDuplicates = tree->type == NATIVE_RBT_TREE;
+	uint32_t sortedCount = 0;
+	int * sorted = _sortedElements(elements, count, keepDuplicates, &sortedCount);
+	if (sorted == NULL) {
+		return _exception(_outOfMemoryError);
+	}
+	boolean exhausted = false;
+	if (tree->type == NATIVE_AVL_TREE) {
+		tree->root = _buildAvl(tree, sorted, 0, sortedCount, &exhausted);
+	}
+	else {
+		// The deepest level is red, and the rest is black (but a lone root).
+		int redDepth = 0;
+		for (uint32_t size = sortedCount; 1 < size; size >>= 1) {
+			++redDepth;
+		}
+		if (sortedCount < 2) {
+			redDepth = -1;
+		}
+		tree->root = _buildRbt(tree, sorted, 0, sortedCount, tree->nil, 0, redDepth, &exhausted);
+	}
+	free(sorted);
+	return exhausted ? _exception(_outOfMemoryError) : _result(0);
+}
+
+NativeTreeResult removeFromNativeTree(NativeTree * tree, const int element, FILE * output) {
+	switch (tree->type) {
+		case NATIVE_AVL_TREE: return _removeFromAvl(tree, element);
+		case NATIVE_BST_TREE:
+			_removeFromBst(tree, element);
+			return _result(0);
+		case NATIVE_RBT_TREE: return _removeFromRbt(tree, element, output);
+		default:
+			return _result(0);
+	}
+}
+
+NativeTreeResult nativeTreeIncludes(NativeTree * tree, const int element) {
+	NativeNode * node = tree->root;
+	while (node != NULL) {
+		if (node == tree->nil) {
+			return _exception(_nullPointerException);
+		}
+		if (node->data == element) {
+			return _result(true);
+		}
+		node = node->data > element ? node->left : node->right;
+	}
+	return _result(false);
+}
+
+NativeTreeResult nativeTreeHeight(NativeTree * tree) {
+	return _result(_height(tree->root));
+}
+
+NativeTreeResult nativeTreeDepth(NativeTree * tree, const int element, FILE * output) {
+	NativeNode * node = tree->root;
+	int depth = 0;
+	while (node != NULL) {
+		if (node == tree->nil) {
+			return _exception(_nullPointerException);
+		}
+		if (node->data == element) {
+			break;
+		}
+		node = node->data > element ? node->left : node->right;
+		++depth;
+	}
+	if (node == NULL) {
+		depth = -1;
+	}
+	fprintf(output, "%d\n", depth);
+	return _result(depth);
+}
+
+NativeTreeResult traverseNativeTree(NativeTree * tree, const NativeTraversal traversal, FILE * output) {
+	tree->stackCount = 0;
+	NativeNode * node = tree->root;
+	NativeNode * visited = NULL;
+	switch (traversal) {
+		case NATIVE_PREORDER:
+			if (!_isEmpty(tree, node) && !_push(tree, node)) {
+				return _exception(_outOfMemoryError);
+			}
+			while (0 < tree->stackCount) {
+				node = tree->stack[--tree->stackCount];
+				fprintf(output, "%d ", node->data);
+				if ((!_isEmpty(tree, node->right) && !_push(tree, node->right))
+					|| (!_isEmpty(tree, node->left) && !_push(tree, node->left))) {
+					return _exception(_outOfMemoryError);
+				}
+			}
+			break;
+		case NATIVE_INORDER:
+			while (!_isEmpty(tree, node) || 0 < tree->stackCount) {
+				if (!_isEmpty(tree, node)) {
+					if (!_push(tree, node)) {
+						return _exception(_outOfMemoryError);
+					}
+					node = node->left;
+				}
+				else {
+					node = tree->stack[--tree->stackCount];
+					fprintf(output, "%d ", node->data);
+					node = node->right;
+				}
+			}
+			break;
+		case NATIVE_POSTORDER:
+			while (!_isEmpty(tree, node) || 0 < tree->stackCount) {
+				if (!_isEmpty(tree, node)) {
+					if (!_push(tree, node)) {
+						return _exception(_outOfMemoryError);
+					}
+					node = node->left;
+				}
+				else {
+					NativeNode * top = tree->stack[tree->stackCount - 1];
+					if (!_isEmpty(tree, top->right) && top->right != visited) {
+						node = top->right;
+					}
+					else {
+						fprintf(output, "%d ", top->data);
+						visited = top;
+						--tree->stackCount;
+					}
+				}
+			}
+			break;
+	}
+	fputc('\n', output);
+	return _result(0);
+}
+
+NativeTreeResult visualizeNativeTree(NativeTree * tree, FILE * file) {
+	tree->stackCount = 0;
+	unsigned int nils = 0;
+	NativeNode * node = tree->root;
+	fputs("digraph \"tree\" {\n", file);
+	while (!_isEmpty(tree, node) || 0 < tree->stackCount) {
+		if (!_isEmpty(tree, node)) {
+			if (!_push(tree, node)) {
+				return _exception(_outOfMemoryError);
+			}
+			node = node->left;
+		}
+		else {
+			node = tree->stack[--tree->stackCount];
+			_visualizeNode(tree, node, file, &nils);
+			node = node->right;
+		}
+	}
+	fputs("}\n", file);
+	return _result(0);
+}
+
+NativeTreeResult calculateWithNativeTree(NativeTree * tree, const char * expression) {
+	// Every token takes 2 characters at least (with its space), but the last.
+	const size_t capacity = strlen(expression) / 2 + 1;
+	CalculationToken * postfix = malloc(capacity * sizeof(CalculationToken));
+	char * operators = malloc(capacity);
+	double * values = malloc(capacity * sizeof(double));
+	if (postfix == NULL || operators == NULL || values == NULL) {
+		logCritical(_logger, "Cannot allocate a calculation of %zu token(s).", capacity);
+		free(values);
+		free(operators);
+		free(postfix);
+		return _exception(_outOfMemoryError);
+	}
+	const char * exception = NULL;
+	size_t postfixCount = 0;
+	size_t operatorCount = 0;
+	// From infix to postfix, with the precedence matrix of the runtime.
+	for (const char * token = expression; exception == NULL && *token != '\0';) {
+		if (*token == ' ') {
+			++token;
+			continue;
+		}
+		size_t length = 0;
+		while (token[length] != '\0' && token[length] != ' ') {
+			++length;
+		}
+		const char * symbol = length == 1 ? strchr(_operators, token[0]) : NULL;
+		if (_isNumber(token, length)) {
+			postfix[postfixCount].operator = '\0';
+			postfix[postfixCount++].number = strtod(token, NULL);
+		}
+		else if (symbol == NULL) {
+			exception = "java.lang.IllegalStateException: Illegal character";
+		}
+		else {
+			const size_t current = symbol - _operators;
+			while (0 < operatorCount && _precedences[strchr(_operators, operators[operatorCount - 1]) - _operators][current]) {
+				postfix[postfixCount].operator = operators[--operatorCount];
+				postfix[postfixCount++].number = 0;
+			}
+			if (*symbol != ')') {
+				operators[operatorCount++] = *symbol;
+			}
+			else if (operatorCount == 0 || operators[operatorCount - 1] != '(') {
+				exception = "java.lang.IllegalStateException: Didn't open the brackets";
+			}
+			else {
+				--operatorCount;
+			}
+		}
+		token += length;
+	}
+	while (exception == NULL && 0 < operatorCount) {
+		if (operators[operatorCount - 1] == '(') {
+			exception = "java.lang.IllegalStateException: Didn't close all opened brackets";
+		}
+		else {
+			postfix[postfixCount].operator = operators[--operatorCount];
+			postfix[postfixCount++].number = 0;
+		}
+	}
+	if (exception == NULL && postfixCount == 0) {
+		exception = "java.lang.StringIndexOutOfBoundsException";
+	}
+	// Evaluates the postfix expression.
+	size_t valueCount = 0;
+	for (size_t k = 0; exception == NULL && k < postfixCount; ++k) {
+		if (postfix[k].operator == '\0') {
+			values[valueCount++] = postfix[k].number;
+		}
+		else if (valueCount < 2) {
+			exception = "java.lang.IllegalArgumentException: Input is not in postfix notation: Wrong amount/order of operands.";
+		}
+		else {
+			const double right = values[--valueCount];
+			const double left = values[--valueCount];
+			switch (postfix[k].operator) {
+				case '+': values[valueCount++] = left + right; break;
+				case '-': values[valueCount++] = left - right; break;
+				case '*': values[valueCount++] = left * right; break;
+				case '/':
+					if (right == 0) {
+						exception = "java.lang.IllegalStateException: Can't divide by zero";
+					}
+					values[valueCount++] = right == 0 ? 0 : left / right;
+					break;
+				default:
+					values[valueCount++] = pow(left, right);
+					break;
+			}
+		}
+	}
+	const int value = exception == NULL ? _castToInteger(values[valueCount - 1]) : 0;
+	free(values);
+	free(operators);
+	free(postfix);
+	return exception == NULL ? _result(value) : _exception(exception);
+}
+
+void destroyNativeTree(NativeTree * tree) {
+	if (tree == NULL) {
+		return;
+	}
+	// Rotates every left child up, so the tree becomes a list to the right.
+	NativeNode * node = tree->root;
+	while (!_isEmpty(tree, node)) {
+		if (!_isEmpty(tree, node->left)) {
+			NativeNode * left = node->left;
+			node->left = left->right;
+			left->right = node;
+			node = left;
+		}
+		else {
+			NativeNode * right = node->right;
+			free(node);
+			node = right;
+		}
+	}
+	free(tree->stack);
+	free(tree);
+}
@@ -0,0 +1,99 @@
+#ifndef NATIVE_TREE_HEADER
+#define NATIVE_TREE_HEADER
+
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeNativeTreeModule();
+
+/** Shutdown module's internal state. */
+void shutdownNativeTreeModule();
+
+/**
+ * The trees of the Java runtime ("BST", "AVL", "RBT" and "EXP"), implemented
+ * in C with the same observable behaviour: the same shapes (and heights, and
+ * colors), the same output, and the same exceptions, quirks included (e.g., a
+ * BST never updates its heights, and an RBT raises a "NullPointerException"
+ * when it looks for a missing element). Every operation is iterative, so any
+ * shape of tree is supported.
+ */
+typedef struct NativeTree NativeTree;
+
+typedef enum {
+	NATIVE_AVL_TREE,
+	NATIVE_BST_TREE,
+	NATIVE_RBT_TREE,
+	NATIVE_EXP_TREE
+} NativeTreeType;
+
+typedef enum {
+	NATIVE_INORDER,
+	NATIVE_PREORDER,
+	NATIVE_POSTORDER
+} NativeTraversal;
+
+/**
+ * The result of an operation. It's considered valid only if "exception" is
+ * NULL. Otherwise, it's the Java exception that the runtime would throw.
+ */
+typedef struct {
+	const char * exception;
+	int value;
+} NativeTreeResult;
+
+/**
+ * Creates an empty tree. Returns NULL if there is no memory left.
+ */
+NativeTree * createNativeTree(const NativeTreeType type);
+
+/**
+ * Inserts an element (or every element of a list, as "insertAll" does, which
+ * builds an empty AVL or RBT at once).
+ */
+NativeTreeResult insertIntoNativeTree(NativeTree * tree, const int element);
+NativeTreeResult insertAllIntoNativeTree(NativeTree * tree, const int * elements, const uint32_t count);
+
+/**
+ * Removes an element. An RBT writes a line to the output if it's missing.
+ */
+NativeTreeResult removeFromNativeTree(NativeTree * tree, const int element, FILE * output);
+
+/**
+ * The queries of a tree. The depth is also written to the output, in its own
+ * line (and it's -1 if the element is missing).
+ */
+NativeTreeResult nativeTreeIncludes(NativeTree * tree, const int element);
+NativeTreeResult nativeTreeHeight(NativeTree * tree);
+NativeTreeResult nativeTreeDepth(NativeTree * tree, const int element, FILE * output);
+
+/**
+ * Writes every element of the tree to the output in the specified order, each
+ * followed by a space, and then a line break.
+ */
+NativeTreeResult traverseNativeTree(NativeTree * tree, const NativeTraversal traversal, FILE * output);
+
+/**
+ * Writes the graph of the tree to a file, in the DOT language of Graphviz.
+ */
+NativeTreeResult visualizeNativeTree(NativeTree * tree, FILE * file);
+
+/**
+ * Evaluates an infix expression, with its tokens split by spaces, as the
+ * "calculate" of an "EXP" tree does. The result (a Java "double") is cast to
+ * an integer.
+ */
+NativeTreeResult calculateWithNativeTree(NativeTree * tree, const char * expression);
+
+/**
+ * Releases every node of the tree, and the tree itself.
+ */
+void destroyNativeTree(NativeTree * tree);
+
+#endif
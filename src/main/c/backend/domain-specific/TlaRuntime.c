@@ -0,0 +1,146 @@
+#include "TlaRuntime.h"
+#include <sys/stat.h>
+#include <sys/types.h>
+
+/* MODULE INTERNAL STATE */
+
+static const char * _outOfMemoryError = "java.lang.OutOfMemoryError";
+static const char * _visualizationDirectory = "dots";
+static unsigned int _visualizations = 0;
+
+/* PRIVATE FUNCTIONS */
+
+static void _check(const NativeTreeResult result);
+
+/**
+ * Throws the exception of a result, if any.
+ */
+static void _check(const NativeTreeResult result) {
+	if (result.exception != NULL) {
+		tlaThrow(result.exception);
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+void tlaStart() {
+	initializeNativeTreeModule();
+}
+
+int tlaStop() {
+	fflush(stdout);
+	shutdownNativeTreeModule();
+	return 0;
+}
+
+void tlaThrow(const char * exception) {
+	fflush(stdout);
+	fprintf(stderr, "Exception in thread \"main\" %s\n", exception);
+	exit(1);
+}
+
+NativeTree * tlaCreateTree(const NativeTreeType type) {
+	NativeTree * tree = createNativeTree(type);
+	if (tree == NULL) {
+		tlaThrow(_outOfMemoryError);
+	}
+	return tree;
+}
+
+TlaList * tlaCreateList() {
+	TlaList * list = calloc(1, sizeof(TlaList));
+	if (list == NULL) {
+		tlaThrow(_outOfMemoryError);
+	}
+	return list;
+}
+
+void tlaDestroyTree(NativeTree * tree) {
+	destroyNativeTree(tree);
+}
+
+void tlaDestroyList(TlaList * list) {
+	if (list != NULL) {
+		free(list->elements);
+		free(list);
+	}
+}
+
+void tlaAppend(TlaList * list, const int element) {
+	if (list->count == list->capacity) {
+		const uint32_t capacity = list->capacity == 0 ? 16 : 2 * list->capacity;
+		int * elements = realloc(list->elements, capacity * sizeof(int));
+		if (elements == NULL) {
+			tlaThrow(_outOfMemoryError);
+		}
+		list->elements = elements;
+		list->capacity = capacity;
+	}
+	list->elements[list->count++] = element;
+}
+
+void tlaInsert(NativeTree * tree, const int element) {
+	_check(insertIntoNativeTree(tree, element));
+}
+
+void tlaInsertAll(NativeTree * tree, const TlaList * list) {
+	_check(insertAllIntoNativeTree(tree, list->elements, list->count));
+}
+
+void tlaRemove(NativeTree * tree, const int element) {
+	_check(removeFromNativeTree(tree, element, stdout));
+}
+
+boolean tlaIncludes(NativeTree * tree, const int element) {
+	const NativeTreeResult result = nativeTreeIncludes(tree, element);
+	_check(result);
+	return result.value ? true : false;
+}
+
+int tlaHeight(NativeTree * tree) {
+	const NativeTreeResult result = nativeTreeHeight(tree);
+	_check(result);
+	return result.value;
+}
+
+int tlaDepth(NativeTree * tree, const int element) {
+	const NativeTreeResult result = nativeTreeDepth(tree, element, stdout);
+	_check(result);
+	return result.value;
+}
+
+int tlaCalculate(NativeTree * tree, const char * expression) {
+	const NativeTreeResult result = calculateWithNativeTree(tree, expression);
+	_check(result);
+	return result.value;
+}
+
+void tlaVisualize(NativeTree * tree) {
+	char path[64];
+	sprintf(path, "%s/%u.dot", _visualizationDirectory, _visualizations);
+#if defined(_WIN32)
+	mkdir(_visualizationDirectory);
+#else
+	mkdir(_visualizationDirectory, 0777);
+#endif
+	FILE * file = fopen(path, "w");
+	if (file == NULL) {
+		tlaThrow("java.io.IOException");
+	}
+	const NativeTreeResult result = visualizeNativeTree(tree, file);
+	fclose(file);
+	_check(result);
+	++_visualizations;
+}
+
+void tlaInorder(NativeTree * tree) {
+	_check(traverseNativeTree(tree, NATIVE_INORDER, stdout));
+}
+
+void tlaPreorder(NativeTree * tree) {
+	_check(traverseNativeTree(tree, NATIVE_PREORDER, stdout));
+}
+
+void tlaPostorder(NativeTree * tree) {
+	_check(traverseNativeTree(tree, NATIVE_POSTORDER, stdout));
+}
@@ -0,0 +1,97 @@
+#ifndef TLA_RUNTIME_HEADER
+#define TLA_RUNTIME_HEADER
+
+#include "../../shared/Type.h"
+#include "NativeTree.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * The runtime of the C programs generated by the compiler (with
+ * "--target=c"), built as the static library "TlaRuntime". It wraps the
+ * native trees with the semantics of the Java runtime: what a program prints
+ * goes to the standard output, each visualized tree to "dots/<n>.dot", and an
+ * exception is printed to the standard error (as the JVM would), which ends
+ * the program with status 1.
+ */
+
+/**
+ * A list of integers, to insert in bulk.
+ */
+typedef struct {
+	int * elements;
+	uint32_t count;
+	uint32_t capacity;
+} TlaList;
+
+/**
+ * Starts (and stops) the runtime. Every program starts with "tlaStart", and
+ * returns the status of "tlaStop".
+ */
+void tlaStart();
+int tlaStop();
+
+/**
+ * Ends the program with a Java exception.
+ */
+void tlaThrow(const char * exception);
+
+/**
+ * Creates an empty tree (or list), and releases it at the end of its block.
+ */
+NativeTree * tlaCreateTree(const NativeTreeType type);
+TlaList * tlaCreateList();
+void tlaDestroyTree(NativeTree * tree);
+void tlaDestroyList(TlaList * list);
+
+/**
+ * The operations of a list, and of a tree.
+ */
+void tlaAppend(TlaList * list, const int element);
+void tlaInsert(NativeTree * tree, const int element);
+void tlaInsertAll(NativeTree * tree, const TlaList * list);
+void tlaRemove(NativeTree * tree, const int element);
+boolean tlaIncludes(NativeTree * tree, const int element);
+int tlaHeight(NativeTree * tree);
+int tlaDepth(NativeTree * tree, const int element);
+int tlaCalculate(NativeTree * tree, const char * expression);
+void tlaVisualize(NativeTree * tree);
+void tlaInorder(NativeTree * tree);
+void tlaPreorder(NativeTree * tree);
+void tlaPostorder(NativeTree * tree);
+
+/**
+ * Arithmetic operations, with the semantics of Java: they wrap around on
+ * overflow, and a division (or modulo) by zero throws. They are inlined into
+ * the program, since they are in its hottest paths.
+ */
+
+static inline int tlaAdd(const int leftAddend, const int rightAddend) {
+	return (int) ((unsigned int) leftAddend + (unsigned int) rightAddend);
+}
+
+static inline int tlaSubtract(const int minuend, const int subtrahend) {
+	return (int) ((unsigned int) minuend - (unsigned int) subtrahend);
+}
+
+static inline int tlaMultiply(const int multiplicand, const int multiplier) {
+	return (int) ((unsigned int) multiplicand * (unsigned int) multiplier);
+}
+
+static inline int tlaDivide(const int dividend, const int divisor) {
+	if (divisor == 0) {
+		tlaThrow("java.lang.ArithmeticException: / by zero");
+	}
+	// The only overflow (INT_MIN / -1) wraps around to INT_MIN.
+	return divisor == -1 ? tlaSubtract(0, dividend) : dividend / divisor;
+}
+
+static inline int tlaModulo(const int dividend, const int divisor) {
+	if (divisor == 0) {
+		tlaThrow("java.lang.ArithmeticException: / by zero");
+	}
+	return divisor == -1 ? 0 : dividend % divisor;
+}
+
+#endif
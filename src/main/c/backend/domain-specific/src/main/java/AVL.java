@@ -1,3 +1,4 @@
+import java.util.List;
 import java.util.function.Function;
 
 class AVL<T extends Comparable<? super T>> extends Tree<T> {
@@ -11,6 +12,18 @@ class AVL<T extends Comparable<? super T>> extends Tree<T> {
         root = deleteNode(root, element);
     }
 
+    // An empty tree is built at once from the sorted elements, without any
+    // rotation. Otherwise, they are inserted one by one.
+    @Override
+    public void insertAll(List<T> elements) {
+        if (root != null) {
+            super.insertAll(elements);
+            return;
+        }
+        List<T> sorted = sortedElements(elements, false);
+        root = build(sorted, 0, sorted.size());
+    }
+
     @Override
     public T max() {
         if(root==null)
@@ -77,6 +90,20 @@ class AVL<T extends Comparable<? super T>> extends Tree<T> {
         return y;
     }
 
+    // Builds a balanced subtree with the sorted elements in [from, to). The
+    // heights follow those of "insert" (a new leaf has a height of 0).
+    private Node<T> build(List<T> sorted, int from, int to) {
+        if (from == to)
+            return null;
+        int middle = (from + to) >>> 1;
+        Node<T> node = new Node<>(sorted.get(middle));
+        node.setLeft(build(sorted, from, middle));
+        node.setRight(build(sorted, middle + 1, to));
+        if (!node.isLeaf())
+            node.setH(1 + Math.max(heightFromNode(node.getLeft()), heightFromNode(node.getRight())));
+        return node;
+    }
+
     // Get Balance factor of node N
     private int getBalance(Node<T> N) {
         if (N == null)
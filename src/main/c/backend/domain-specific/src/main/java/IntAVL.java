@@ -0,0 +1,159 @@
+import java.util.List;
+
+// An "AVL" of primitive keys, whose nodes only keep their height besides their
+// key and children. It rotates (and updates the heights) as "AVL" does.
+public final class IntAVL extends IntTree<IntAVL.Node> {
+
+    static final class Node extends IntNode<Node> {
+        // A leaf has a height of 0.
+        int h;
+
+        Node(int key) {
+            super(key);
+        }
+    }
+
+    public IntAVL() {
+        super(null);
+    }
+
+    @Override
+    public void insert(int element) {
+        root = insert(root, element);
+    }
+
+    @Override
+    public void remove(int element) {
+        root = deleteNode(root, element);
+    }
+
+    // An empty tree is built at once from the sorted elements, without any
+    // rotation. Otherwise, they are inserted one by one.
+    @Override
+    public void insertAll(List<Integer> elements) {
+        if (root != null) {
+            super.insertAll(elements);
+            return;
+        }
+        int[] sorted = sortedElements(elements, false);
+        root = build(sorted, 0, sorted.length);
+    }
+
+    @Override
+    public int height() {
+        return height(root);
+    }
+
+    private static int height(Node node) {
+        return node == null ? 0 : node.h;
+    }
+
+    private static int getBalance(Node node) {
+        return node == null ? 0 : height(node.left) - height(node.right);
+    }
+
+    private static void updateHeight(Node node) {
+        node.h = 1 + Math.max(height(node.left), height(node.right));
+    }
+
+    private static Node rightRotate(Node y) {
+        Node x = y.left;
+        y.left = x.right;
+        x.right = y;
+        updateHeight(y);
+        updateHeight(x);
+        return x;
+    }
+
+    private static Node leftRotate(Node x) {
+        Node y = x.right;
+        x.right = y.left;
+        y.left = x;
+        updateHeight(x);
+        updateHeight(y);
+        return y;
+    }
+
+    // Builds a balanced subtree with the sorted elements in [from, to). The
+    // heights follow those of "insert" (a new leaf has a height of 0).
+    private static Node build(int[] sorted, int from, int to) {
+        if (from == to)
+            return null;
+        int middle = (from + to) >>> 1;
+        Node node = new Node(sorted[middle]);
+        node.left = build(sorted, from, middle);
+        node.right = build(sorted, middle + 1, to);
+        if (!node.isLeaf())
+            updateHeight(node);
+        return node;
+    }
+
+    // Inserts an element (unless it's already there) into a subtree, and
+    // returns its new root.
+    private static Node insert(Node node, int element) {
+        if (node == null)
+            return new Node(element);
+        if (element < node.key)
+            node.left = insert(node.left, element);
+        else if (element > node.key)
+            node.right = insert(node.right, element);
+        else
+            return node;
+
+        updateHeight(node);
+        int balance = getBalance(node);
+        if (balance > 1 && element < node.left.key)
+            return rightRotate(node);
+        if (balance < -1 && element > node.right.key)
+            return leftRotate(node);
+        if (balance > 1 && element > node.left.key) {
+            node.left = leftRotate(node.left);
+            return rightRotate(node);
+        }
+        if (balance < -1 && element < node.right.key) {
+            node.right = rightRotate(node.right);
+            return leftRotate(node);
+        }
+        return node;
+    }
+
+    // Removes an element from a subtree, and returns its new root. A node with
+    // two children takes the key of its successor, which is then removed from
+    // its right subtree. As in "AVL", the height of an ancestor becomes
+    // "max(hl, hr + 1)".
+    private static Node deleteNode(Node node, int element) {
+        if (node == null)
+            return null;
+        if (element < node.key) {
+            node.left = deleteNode(node.left, element);
+        } else if (element > node.key) {
+            node.right = deleteNode(node.right, element);
+        } else if (node.left == null || node.right == null) {
+            node = node.left == null ? node.right : node.left;
+            if (node == null)
+                return null;
+        } else {
+            Node successor = node.right;
+            while (successor.left != null)
+                successor = successor.left;
+            node.key = successor.key;
+            node.right = deleteNode(node.right, successor.key);
+        }
+
+        node.h = Math.max(height(node.left), height(node.right) + 1);
+        int balance = getBalance(node);
+        if (balance > 1 && getBalance(node.left) >= 0)
+            return rightRotate(node);
+        if (balance > 1 && getBalance(node.left) < 0) {
+            node.left = leftRotate(node.left);
+            return rightRotate(node);
+        }
+        if (balance < -1 && getBalance(node.right) <= 0)
+            return leftRotate(node);
+        if (balance < -1 && getBalance(node.right) > 0) {
+            node.right = rightRotate(node.right);
+            return leftRotate(node);
+        }
+        return node;
+    }
+}
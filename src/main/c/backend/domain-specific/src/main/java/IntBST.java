@@ -0,0 +1,70 @@
+// A "BST" of primitive keys, whose nodes keep no balance information (since
+// the heights of a "BST" are never updated). Its operations are iterative, so
+// a degenerate tree does not overflow the stack.
+public final class IntBST extends IntTree<IntBST.Node> {
+
+    static final class Node extends IntNode<Node> {
+        Node(int key) {
+            super(key);
+        }
+    }
+
+    public IntBST() {
+        super(null);
+    }
+
+    // Inserts an element, unless it's already there.
+    @Override
+    public void insert(int element) {
+        if (root == null) {
+            root = new Node(element);
+            return;
+        }
+        Node node = root;
+        while (node.key != element) {
+            if (element < node.key) {
+                if (node.left == null)
+                    node.left = new Node(element);
+                node = node.left;
+            } else {
+                if (node.right == null)
+                    node.right = new Node(element);
+                node = node.right;
+            }
+        }
+    }
+
+    // A node with two children takes the minimum of its right subtree, but
+    // the element itself is still removed from there (as "BST" does), so the
+    // minimum is only removed if it's a duplicate of it.
+    @Override
+    public void remove(int element) {
+        Node parent = null;
+        Node node = root;
+        while (node != null) {
+            if (element < node.key) {
+                parent = node;
+                node = node.left;
+            } else if (element > node.key) {
+                parent = node;
+                node = node.right;
+            } else if (node.left == null || node.right == null) {
+                Node child = node.left == null ? node.right : node.left;
+                if (parent == null)
+                    root = child;
+                else if (parent.left == node)
+                    parent.left = child;
+                else
+                    parent.right = child;
+                return;
+            } else {
+                Node minimum = node.right;
+                while (minimum.left != null)
+                    minimum = minimum.left;
+                node.key = minimum.key;
+                parent = node;
+                node = node.right;
+            }
+        }
+    }
+}
@@ -0,0 +1,16 @@
+// A node of an "IntTree", whose key is a primitive "int". Each tree extends it
+// with its own balance information only (e.g., the height of an AVL), so its
+// nodes take no more memory than they need.
+abstract class IntNode<N extends IntNode<N>> {
+    int key;
+    N left;
+    N right;
+
+    IntNode(int key) {
+        this.key = key;
+    }
+
+    boolean isLeaf() {
+        return left == null && right == null;
+    }
+}
@@ -0,0 +1,276 @@
+import java.util.List;
+
+// An "RBT" of primitive keys, whose nodes keep their parent and their color
+// besides their key and children. It keeps the sentinel of "RBT" (every missing
+// child), and fixes the tree as "RBT" does, its exceptions included.
+public final class IntRBT extends IntTree<IntRBT.Node> {
+
+    static final class Node extends IntNode<Node> {
+        Node parent;
+        boolean red;
+
+        Node(int key) {
+            super(key);
+        }
+    }
+
+    public IntRBT() {
+        super(new Node(0));
+    }
+
+    // Inserts a red element (a duplicate goes to the right), and fixes the
+    // tree, unless its parent is the root.
+    @Override
+    public void insert(int element) {
+        Node node = new Node(element);
+        node.parent = nil;
+        node.left = nil;
+        node.right = nil;
+        node.red = true;
+
+        Node y = nil;
+        Node x = root;
+        while (x != nil) {
+            y = x;
+            x = element < x.key ? x.left : x.right;
+        }
+
+        node.parent = y;
+        if (y == nil)
+            root = node;
+        else if (element < y.key)
+            y.left = node;
+        else
+            y.right = node;
+
+        if (node.parent == nil) {
+            node.red = false;
+            return;
+        }
+        if (node.parent.parent == nil)
+            return;
+        fixInsert(node);
+    }
+
+    // An empty tree is built at once from the sorted elements (duplicates
+    // included, as "insert" does), without any rotation or recoloring.
+    @Override
+    public void insertAll(List<Integer> elements) {
+        if (root != nil) {
+            super.insertAll(elements);
+            return;
+        }
+        int[] sorted = sortedElements(elements, true);
+        // The deepest level is red, and the rest is black (but a lone root).
+        int redDepth = sorted.length < 2 ? -1 : 31 - Integer.numberOfLeadingZeros(sorted.length);
+        root = build(sorted, 0, sorted.length, nil, 0, redDepth);
+    }
+
+    // Removes an element (the last one found on the way down, if it's
+    // duplicated), or prints a line if it's missing.
+    @Override
+    public void remove(int element) {
+        Node z = nil;
+        Node node = root;
+        while (node != nil) {
+            if (node.key == element)
+                z = node;
+            node = node.key <= element ? node.right : node.left;
+        }
+        if (z == nil) {
+            System.out.println("Couldn't find key in the tree");
+            return;
+        }
+
+        Node x;
+        Node y = z;
+        boolean yOriginalRed = y.red;
+        if (z.left == nil) {
+            x = z.right;
+            transplant(z, z.right);
+        } else if (z.right == nil) {
+            x = z.left;
+            transplant(z, z.left);
+        } else {
+            y = z.right;
+            while (y.left != nil)
+                y = y.left;
+            yOriginalRed = y.red;
+            x = y.right;
+            if (y.parent == z) {
+                x.parent = y;
+            } else {
+                transplant(y, y.right);
+                y.right = z.right;
+                y.right.parent = y;
+            }
+            transplant(z, y);
+            y.left = z.left;
+            y.left.parent = y;
+            y.red = z.red;
+        }
+        if (!yOriginalRed)
+            fixDelete(x);
+    }
+
+    @Override
+    protected boolean isRed(Node node) {
+        return node.red;
+    }
+
+    private Node build(int[] sorted, int from, int to, Node parent, int depth, int redDepth) {
+        if (from == to)
+            return nil;
+        int middle = (from + to) >>> 1;
+        Node node = new Node(sorted[middle]);
+        node.parent = parent;
+        node.red = depth == redDepth;
+        node.left = build(sorted, from, middle, node, depth + 1, redDepth);
+        node.right = build(sorted, middle + 1, to, node, depth + 1, redDepth);
+        return node;
+    }
+
+    // Restores the colors after an insertion. The uncle is missing (so it
+    // throws, as "RBT" does) only if the grandparent is the sentinel.
+    private void fixInsert(Node k) {
+        while (k.parent.red) {
+            Node grandparent = k.parent.parent;
+            if (k.parent == grandparent.right) {
+                Node u = grandparent.left;
+                if (u.red) {
+                    u.red = false;
+                    k.parent.red = false;
+                    grandparent.red = true;
+                    k = grandparent;
+                } else {
+                    if (k == k.parent.left) {
+                        k = k.parent;
+                        rightRotate(k);
+                    }
+                    k.parent.red = false;
+                    k.parent.parent.red = true;
+                    leftRotate(k.parent.parent);
+                }
+            } else {
+                Node u = grandparent.right;
+                if (u.red) {
+                    u.red = false;
+                    k.parent.red = false;
+                    grandparent.red = true;
+                    k = grandparent;
+                } else {
+                    if (k == k.parent.right) {
+                        k = k.parent;
+                        leftRotate(k);
+                    }
+                    k.parent.red = false;
+                    k.parent.parent.red = true;
+                    rightRotate(k.parent.parent);
+                }
+            }
+            if (k == root)
+                break;
+        }
+        root.red = false;
+    }
+
+    // Restores the colors after a deletion. As in "RBT", the mirrored case 3.2
+    // only checks the right child of the sibling, and a missing sibling (i.e.,
+    // the sentinel, without children) throws.
+    private void fixDelete(Node x) {
+        while (x != root && !x.red) {
+            if (x == x.parent.left) {
+                Node s = x.parent.right;
+                if (s.red) {
+                    s.red = false;
+                    x.parent.red = true;
+                    leftRotate(x.parent);
+                    s = x.parent.right;
+                }
+                if (!s.left.red && !s.right.red) {
+                    s.red = true;
+                    x = x.parent;
+                } else {
+                    if (!s.right.red) {
+                        s.left.red = false;
+                        s.red = true;
+                        rightRotate(s);
+                        s = x.parent.right;
+                    }
+                    s.red = x.parent.red;
+                    x.parent.red = false;
+                    s.right.red = false;
+                    leftRotate(x.parent);
+                    x = root;
+                }
+            } else {
+                Node s = x.parent.left;
+                if (s.red) {
+                    s.red = false;
+                    x.parent.red = true;
+                    rightRotate(x.parent);
+                    s = x.parent.left;
+                }
+                if (!s.right.red) {
+                    s.red = true;
+                    x = x.parent;
+                } else {
+                    if (!s.left.red) {
+                        s.right.red = false;
+                        s.red = true;
+                        leftRotate(s);
+                        s = x.parent.left;
+                    }
+                    s.red = x.parent.red;
+                    x.parent.red = false;
+                    s.left.red = false;
+                    rightRotate(x.parent);
+                    x = root;
+                }
+            }
+        }
+        x.red = false;
+    }
+
+    private void transplant(Node u, Node v) {
+        if (u.parent == nil)
+            root = v;
+        else if (u == u.parent.left)
+            u.parent.left = v;
+        else
+            u.parent.right = v;
+        v.parent = u.parent;
+    }
+
+    private void leftRotate(Node x) {
+        Node y = x.right;
+        x.right = y.left;
+        if (y.left != nil)
+            y.left.parent = x;
+        y.parent = x.parent;
+        if (x.parent == nil)
+            root = y;
+        else if (x == x.parent.left)
+            x.parent.left = y;
+        else
+            x.parent.right = y;
+        y.left = x;
+        x.parent = y;
+    }
+
+    private void rightRotate(Node x) {
+        Node y = x.left;
+        x.left = y.right;
+        if (y.right != nil)
+            y.right.parent = x;
+        y.parent = x.parent;
+        if (x.parent == nil)
+            root = y;
+        else if (x == x.parent.right)
+            x.parent.right = y;
+        else
+            x.parent.left = y;
+        y.right = x;
+        x.parent = y;
+    }
+}
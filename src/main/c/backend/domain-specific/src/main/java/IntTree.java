@@ -0,0 +1,206 @@
+import guru.nidi.graphviz.attribute.Attributes;
+import guru.nidi.graphviz.attribute.Label;
+import guru.nidi.graphviz.attribute.Style;
+import guru.nidi.graphviz.model.*;
+
+import java.io.IOException;
+import java.util.ArrayDeque;
+import java.util.Arrays;
+import java.util.Deque;
+import java.util.List;
+
+import static guru.nidi.graphviz.model.Factory.*;
+
+// A tree of primitive "int" keys, which behaves as the "Tree" of the same
+// kind (its output, its heights and its exceptions included), but compares
+// its keys without boxing them. The generated programs declare each tree with
+// its final class, so its calls are bound statically.
+public abstract class IntTree<N extends IntNode<N>> {
+
+    protected N root;
+
+    // The node of every missing child, which is null but in an RBT (where it's
+    // the sentinel, without a key).
+    protected final N nil;
+
+    protected IntTree(N nil) {
+        this.nil = nil;
+        this.root = nil;
+    }
+
+    public abstract void insert(int element);
+
+    public abstract void remove(int element);
+
+    // Inserts every element, in order. The balanced trees override it, to
+    // build themselves at once (in linear time) when they are empty.
+    public void insertAll(List<Integer> elements) {
+        for (int element : elements)
+            this.insert(element);
+    }
+
+    // Only an AVL keeps the heights of its nodes, so the height of the other
+    // trees is always 0 (as in "Tree").
+    public int height() {
+        return 0;
+    }
+
+    // Looking for a missing element in an RBT reaches its sentinel, which has
+    // no key, so it throws (as in "Tree").
+    public boolean includes(int element) {
+        N node = root;
+        while (node != null) {
+            if (node == nil)
+                throw new NullPointerException();
+            if (node.key == element)
+                return true;
+            node = node.key > element ? node.left : node.right;
+        }
+        return false;
+    }
+
+    public int depth(int value) {
+        N node = root;
+        int depth = 0;
+        while (node != null) {
+            if (node == nil)
+                throw new NullPointerException();
+            if (node.key == value)
+                break;
+            node = node.key > value ? node.left : node.right;
+            ++depth;
+        }
+        if (node == null)
+            depth = -1;
+        System.out.println(depth);
+        return depth;
+    }
+
+    // ===== For drawing =====
+
+    public void visualize() throws IOException {
+        MutableGraph graph = mutGraph("tree").setDirected(true);
+        int qtyNils = 0;
+        Deque<N> stack = new ArrayDeque<>();
+        N node = root;
+        while (!isEmpty(node) || !stack.isEmpty()) {
+            if (!isEmpty(node)) {
+                stack.push(node);
+                node = node.left;
+                continue;
+            }
+            node = stack.pop();
+            MutableNode mutNode = mutNode(Integer.toString(node.key));
+            if (!node.isLeaf()) {
+                qtyNils = addLink(mutNode, node.left, qtyNils);
+                qtyNils = addLink(mutNode, node.right, qtyNils);
+            }
+            mutNode.add(Attributes.attr("fillcolor", "white"));
+            mutNode.add(Attributes.attr("color", isRed(node) ? "red" : "black"));
+            mutNode.add(Style.FILLED);
+            graph.add(mutNode);
+            node = node.right;
+        }
+        Tree.render(graph);
+    }
+
+    public void inorder() {
+        StringBuilder builder = new StringBuilder();
+        Deque<N> stack = new ArrayDeque<>();
+        N node = root;
+        while (!isEmpty(node) || !stack.isEmpty()) {
+            if (!isEmpty(node)) {
+                stack.push(node);
+                node = node.left;
+                continue;
+            }
+            node = stack.pop();
+            builder.append(node.key).append(' ');
+            node = node.right;
+        }
+        System.out.println(builder);
+    }
+
+    public void preorder() {
+        StringBuilder builder = new StringBuilder();
+        Deque<N> stack = new ArrayDeque<>();
+        if (!isEmpty(root))
+            stack.push(root);
+        while (!stack.isEmpty()) {
+            N node = stack.pop();
+            builder.append(node.key).append(' ');
+            if (!isEmpty(node.right))
+                stack.push(node.right);
+            if (!isEmpty(node.left))
+                stack.push(node.left);
+        }
+        System.out.println(builder);
+    }
+
+    public void postorder() {
+        StringBuilder builder = new StringBuilder();
+        Deque<N> stack = new ArrayDeque<>();
+        N node = root;
+        N visited = null;
+        while (!isEmpty(node) || !stack.isEmpty()) {
+            if (!isEmpty(node)) {
+                stack.push(node);
+                node = node.left;
+                continue;
+            }
+            N top = stack.peek();
+            if (!isEmpty(top.right) && top.right != visited) {
+                node = top.right;
+            } else {
+                builder.append(top.key).append(' ');
+                visited = stack.pop();
+            }
+        }
+        System.out.println(builder);
+    }
+
+    // The border color of a node, which is only red in an RBT.
+    protected boolean isRed(N node) {
+        return false;
+    }
+
+    protected boolean isEmpty(N node) {
+        return node == null || node == nil;
+    }
+
+    // Links a node to a child: a missing one is linked to an invisible node,
+    // and the sentinel to a "nil" node. Returns the count of "nil" nodes.
+    private int addLink(MutableNode mutNode, N child, int qtyNils) {
+        if (child == null) {
+            Link invisibleLink = Factory.to(mutNode("invisible").add(Style.INVIS)).with(Style.INVIS);
+            mutNode.addLink(invisibleLink);
+        } else if (child == nil) {
+            mutNode.addLink(mutNode("nil" + qtyNils++).add(Label.of("nil")));
+        } else {
+            mutNode.addLink(mutNode(Integer.toString(child.key)));
+        }
+        return qtyNils;
+    }
+
+    // Returns the elements in ascending order (without duplicates, unless they
+    // must be kept). Already sorted elements are only checked, in linear time.
+    protected static int[] sortedElements(List<Integer> elements, boolean keepDuplicates) {
+        int[] sorted = new int[elements.size()];
+        boolean ascending = true;
+        int count = 0;
+        for (int element : elements) {
+            ascending = ascending && (count == 0 || sorted[count - 1] <= element);
+            sorted[count++] = element;
+        }
+        if (!ascending)
+            Arrays.sort(sorted);
+        if (keepDuplicates)
+            return sorted;
+        int distinct = 0;
+        for (int element : sorted) {
+            if (distinct == 0 || sorted[distinct - 1] != element)
+                sorted[distinct++] = element;
+        }
+        return Arrays.copyOf(sorted, distinct);
+    }
+}
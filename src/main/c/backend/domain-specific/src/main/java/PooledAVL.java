@@ -0,0 +1,164 @@
+import java.util.List;
+
+// An "IntAVL" whose nodes live in a pool (see "PooledTree"), where the balance
+// of a node is its height. It rotates (and updates the heights) as "AVL" does.
+public final class PooledAVL extends PooledTree {
+
+    public PooledAVL() {
+        super(false);
+    }
+
+    @Override
+    public void insert(int element) {
+        root = insert(root, element);
+    }
+
+    @Override
+    public void remove(int element) {
+        root = deleteNode(root, element);
+    }
+
+    // An empty tree is built at once from the sorted elements, without any
+    // rotation. Otherwise, they are inserted one by one.
+    @Override
+    public void insertAll(List<Integer> elements) {
+        if (root != NONE) {
+            super.insertAll(elements);
+            return;
+        }
+        int[] sorted = IntTree.sortedElements(elements, false);
+        reserve(sorted.length);
+        root = build(sorted, 0, sorted.length);
+    }
+
+    @Override
+    public int height() {
+        return height(root);
+    }
+
+    private int height(int node) {
+        return node == NONE ? 0 : balances[node];
+    }
+
+    private int getBalance(int node) {
+        return node == NONE ? 0 : height(lefts[node]) - height(rights[node]);
+    }
+
+    private void updateHeight(int node) {
+        balances[node] = 1 + Math.max(height(lefts[node]), height(rights[node]));
+    }
+
+    // A rotation may lack the child to rotate (since the heights of a removal
+    // are not exact), so it throws as "AVL" does.
+    private int rightRotate(int y) {
+        int x = lefts[y];
+        if (x == NONE)
+            throw new NullPointerException();
+        lefts[y] = rights[x];
+        rights[x] = y;
+        updateHeight(y);
+        updateHeight(x);
+        return x;
+    }
+
+    private int leftRotate(int x) {
+        int y = rights[x];
+        if (y == NONE)
+            throw new NullPointerException();
+        rights[x] = lefts[y];
+        lefts[y] = x;
+        updateHeight(x);
+        updateHeight(y);
+        return y;
+    }
+
+    // Builds a balanced subtree with the sorted elements in [from, to). The
+    // heights follow those of "insert" (a new leaf has a height of 0).
+    private int build(int[] sorted, int from, int to) {
+        if (from == to)
+            return NONE;
+        int middle = (from + to) >>> 1;
+        int node = allocate(sorted[middle]);
+        int left = build(sorted, from, middle);
+        int right = build(sorted, middle + 1, to);
+        lefts[node] = left;
+        rights[node] = right;
+        if (left != NONE || right != NONE)
+            updateHeight(node);
+        return node;
+    }
+
+    // Inserts an element (unless it's already there) into a subtree, and
+    // returns its new root.
+    private int insert(int node, int element) {
+        if (node == NONE)
+            return allocate(element);
+        if (element < keys[node]) {
+            int left = insert(lefts[node], element);
+            lefts[node] = left;
+        } else if (element > keys[node]) {
+            int right = insert(rights[node], element);
+            rights[node] = right;
+        } else {
+            return node;
+        }
+
+        updateHeight(node);
+        int balance = getBalance(node);
+        if (balance > 1 && element < keys[lefts[node]])
+            return rightRotate(node);
+        if (balance < -1 && element > keys[rights[node]])
+            return leftRotate(node);
+        if (balance > 1 && element > keys[lefts[node]]) {
+            lefts[node] = leftRotate(lefts[node]);
+            return rightRotate(node);
+        }
+        if (balance < -1 && element < keys[rights[node]]) {
+            rights[node] = rightRotate(rights[node]);
+            return leftRotate(node);
+        }
+        return node;
+    }
+
+    // Removes an element from a subtree, and returns its new root. A node with
+    // two children takes the key of its successor, which is then removed from
+    // its right subtree. As in "AVL", the height of an ancestor becomes
+    // "max(hl, hr + 1)".
+    private int deleteNode(int node, int element) {
+        if (node == NONE)
+            return NONE;
+        if (element < keys[node]) {
+            lefts[node] = deleteNode(lefts[node], element);
+        } else if (element > keys[node]) {
+            rights[node] = deleteNode(rights[node], element);
+        } else if (lefts[node] == NONE || rights[node] == NONE) {
+            int child = lefts[node] == NONE ? rights[node] : lefts[node];
+            release(node);
+            if (child == NONE)
+                return NONE;
+            node = child;
+        } else {
+            int successor = rights[node];
+            while (lefts[successor] != NONE)
+                successor = lefts[successor];
+            keys[node] = keys[successor];
+            rights[node] = deleteNode(rights[node], keys[successor]);
+        }
+
+        balances[node] = Math.max(height(lefts[node]), height(rights[node]) + 1);
+        int balance = getBalance(node);
+        if (balance > 1 && getBalance(lefts[node]) >= 0)
+            return rightRotate(node);
+        if (balance > 1 && getBalance(lefts[node]) < 0) {
+            lefts[node] = leftRotate(lefts[node]);
+            return rightRotate(node);
+        }
+        if (balance < -1 && getBalance(rights[node]) <= 0)
+            return leftRotate(node);
+        if (balance < -1 && getBalance(rights[node]) > 0) {
+            rights[node] = rightRotate(rights[node]);
+            return leftRotate(node);
+        }
+        return node;
+    }
+}
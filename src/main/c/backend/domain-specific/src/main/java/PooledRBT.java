@@ -0,0 +1,268 @@
+import java.util.List;
+
+// An "IntRBT" whose nodes live in a pool (see "PooledTree"), where the balance
+// of a node is its color. It keeps the sentinel of "RBT" (every missing child),
+// and fixes the tree as "RBT" does, its exceptions included.
+public final class PooledRBT extends PooledTree {
+
+    private static final int BLACK = 0;
+    private static final int RED = 1;
+
+    public PooledRBT() {
+        super(true);
+    }
+
+    // Inserts a red element (a duplicate goes to the right), and fixes the
+    // tree, unless its parent is the root.
+    @Override
+    public void insert(int element) {
+        int node = allocate(element);
+        balances[node] = RED;
+
+        int y = nil;
+        int x = root;
+        while (x != nil) {
+            y = x;
+            x = element < keys[x] ? lefts[x] : rights[x];
+        }
+
+        parents[node] = y;
+        if (y == nil)
+            root = node;
+        else if (element < keys[y])
+            lefts[y] = node;
+        else
+            rights[y] = node;
+
+        if (parents[node] == nil) {
+            balances[node] = BLACK;
+            return;
+        }
+        if (parents[parents[node]] == nil)
+            return;
+        fixInsert(node);
+    }
+
+    // An empty tree is built at once from the sorted elements (duplicates
+    // included, as "insert" does), without any rotation or recoloring.
+    @Override
+    public void insertAll(List<Integer> elements) {
+        if (root != nil) {
+            super.insertAll(elements);
+            return;
+        }
+        int[] sorted = IntTree.sortedElements(elements, true);
+        // The deepest level is red, and the rest is black (but a lone root).
+        int redDepth = sorted.length < 2 ? -1 : 31 - Integer.numberOfLeadingZeros(sorted.length);
+        reserve(sorted.length);
+        root = build(sorted, 0, sorted.length, nil, 0, redDepth);
+    }
+
+    // Removes an element (the last one found on the way down, if it's
+    // duplicated), or prints a line if it's missing.
+    @Override
+    public void remove(int element) {
+        int z = nil;
+        int node = root;
+        while (node != nil) {
+            if (keys[node] == element)
+                z = node;
+            node = keys[node] <= element ? rights[node] : lefts[node];
+        }
+        if (z == nil) {
+            System.out.println("Couldn't find key in the tree");
+            return;
+        }
+
+        int x;
+        int y = z;
+        int yOriginalColor = balances[y];
+        if (lefts[z] == nil) {
+            x = rights[z];
+            transplant(z, rights[z]);
+        } else if (rights[z] == nil) {
+            x = lefts[z];
+            transplant(z, lefts[z]);
+        } else {
+            y = rights[z];
+            while (lefts[y] != nil)
+                y = lefts[y];
+            yOriginalColor = balances[y];
+            x = rights[y];
+            if (parents[y] == z) {
+                parents[x] = y;
+            } else {
+                transplant(y, rights[y]);
+                rights[y] = rights[z];
+                parents[rights[y]] = y;
+            }
+            transplant(z, y);
+            lefts[y] = lefts[z];
+            parents[lefts[y]] = y;
+            balances[y] = balances[z];
+        }
+        release(z);
+        if (yOriginalColor == BLACK)
+            fixDelete(x);
+    }
+
+    @Override
+    protected boolean isRed(int node) {
+        return balances[node] == RED;
+    }
+
+    private int build(int[] sorted, int from, int to, int parent, int depth, int redDepth) {
+        if (from == to)
+            return nil;
+        int middle = (from + to) >>> 1;
+        int node = allocate(sorted[middle]);
+        parents[node] = parent;
+        balances[node] = depth == redDepth ? RED : BLACK;
+        int left = build(sorted, from, middle, node, depth + 1, redDepth);
+        int right = build(sorted, middle + 1, to, node, depth + 1, redDepth);
+        lefts[node] = left;
+        rights[node] = right;
+        return node;
+    }
+
+    // Restores the colors after an insertion. The uncle is missing (so it
+    // throws, as "RBT" does) only if the grandparent is the sentinel.
+    private void fixInsert(int k) {
+        while (balances[parents[k]] == RED) {
+            int grandparent = parents[parents[k]];
+            boolean right = parents[k] == rights[grandparent];
+            int u = right ? lefts[grandparent] : rights[grandparent];
+            if (u == NONE)
+                throw new NullPointerException();
+            if (balances[u] == RED) {
+                balances[u] = BLACK;
+                balances[parents[k]] = BLACK;
+                balances[grandparent] = RED;
+                k = grandparent;
+            } else if (right) {
+                if (k == lefts[parents[k]]) {
+                    k = parents[k];
+                    rightRotate(k);
+                }
+                balances[parents[k]] = BLACK;
+                balances[parents[parents[k]]] = RED;
+                leftRotate(parents[parents[k]]);
+            } else {
+                if (k == rights[parents[k]]) {
+                    k = parents[k];
+                    leftRotate(k);
+                }
+                balances[parents[k]] = BLACK;
+                balances[parents[parents[k]]] = RED;
+                rightRotate(parents[parents[k]]);
+            }
+            if (k == root)
+                break;
+        }
+        balances[root] = BLACK;
+    }
+
+    // Restores the colors after a deletion. As in "RBT", the mirrored case 3.2
+    // only checks the right child of the sibling, and a missing sibling (i.e.,
+    // the sentinel, without children) throws.
+    private void fixDelete(int x) {
+        while (x != root && balances[x] == BLACK) {
+            if (x == lefts[parents[x]]) {
+                int s = rights[parents[x]];
+                if (balances[s] == RED) {
+                    balances[s] = BLACK;
+                    balances[parents[x]] = RED;
+                    leftRotate(parents[x]);
+                    s = rights[parents[x]];
+                }
+                if (lefts[s] == NONE)
+                    throw new NullPointerException();
+                if (balances[lefts[s]] == BLACK && balances[rights[s]] == BLACK) {
+                    balances[s] = RED;
+                    x = parents[x];
+                } else {
+                    if (balances[rights[s]] == BLACK) {
+                        balances[lefts[s]] = BLACK;
+                        balances[s] = RED;
+                        rightRotate(s);
+                        s = rights[parents[x]];
+                    }
+                    balances[s] = balances[parents[x]];
+                    balances[parents[x]] = BLACK;
+                    balances[rights[s]] = BLACK;
+                    leftRotate(parents[x]);
+                    x = root;
+                }
+            } else {
+                int s = lefts[parents[x]];
+                if (balances[s] == RED) {
+                    balances[s] = BLACK;
+                    balances[parents[x]] = RED;
+                    rightRotate(parents[x]);
+                    s = lefts[parents[x]];
+                }
+                if (rights[s] == NONE)
+                    throw new NullPointerException();
+                if (balances[rights[s]] == BLACK) {
+                    balances[s] = RED;
+                    x = parents[x];
+                } else {
+                    if (balances[lefts[s]] == BLACK) {
+                        balances[rights[s]] = BLACK;
+                        balances[s] = RED;
+                        leftRotate(s);
+                        s = lefts[parents[x]];
+                    }
+                    balances[s] = balances[parents[x]];
+                    balances[parents[x]] = BLACK;
+                    balances[lefts[s]] = BLACK;
+                    rightRotate(parents[x]);
+                    x = root;
+                }
+            }
+        }
+        balances[x] = BLACK;
+    }
+
+    private void transplant(int u, int v) {
+        if (parents[u] == nil)
+            root = v;
+        else if (u == lefts[parents[u]])
+            lefts[parents[u]] = v;
+        else
+            rights[parents[u]] = v;
+        parents[v] = parents[u];
+    }
+
+    private void leftRotate(int x) {
+        int y = rights[x];
+        rights[x] = lefts[y];
+        if (lefts[y] != nil)
+            parents[lefts[y]] = x;
+        parents[y] = parents[x];
+        if (parents[x] == nil)
+            root = y;
+        else if (x == lefts[parents[x]])
+            lefts[parents[x]] = y;
+        else
+            rights[parents[x]] = y;
+        lefts[y] = x;
+        parents[x] = y;
+    }
+
+    private void rightRotate(int x) {
+        int y = lefts[x];
+        lefts[x] = rights[y];
+        if (rights[y] != nil)
+            parents[rights[y]] = x;
+        parents[y] = parents[x];
+        if (parents[x] == nil)
+            root = y;
+        else if (x == rights[parents[x]])
+            rights[parents[x]] = y;
+        else
+            lefts[parents[x]] = y;
+        rights[y] = x;
+        parents[x] = y;
+    }
+}
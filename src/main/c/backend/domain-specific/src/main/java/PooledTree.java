@@ -0,0 +1,264 @@
+import guru.nidi.graphviz.attribute.Attributes;
+import guru.nidi.graphviz.attribute.Label;
+import guru.nidi.graphviz.attribute.Style;
+import guru.nidi.graphviz.model.*;
+
+import java.io.IOException;
+import java.util.Arrays;
+import java.util.List;
+
+import static guru.nidi.graphviz.model.Factory.*;
+
+// A tree of primitive "int" keys (as an "IntTree"), whose nodes live in a pool
+// of parallel arrays instead of being objects: a node is an index into them.
+// The arrays double when they are full, and the nodes released by "remove" are
+// reused first (they are linked through their left children), so a tree under
+// insertions and removals allocates almost nothing, and leaves nothing behind
+// for the garbage collector. It has the public methods of "IntTree", so the
+// generators switch to it (with "POOLED_TREES=true") by its name only.
+public abstract class PooledTree {
+
+    // The index of a missing node (i.e., a null reference).
+    protected static final int NONE = -1;
+
+    private static final int INITIAL_CAPACITY = 16;
+
+    protected int[] keys;
+    protected int[] lefts;
+    protected int[] rights;
+    // The parent of each node, which only an RBT keeps (it's null otherwise).
+    protected int[] parents;
+    // The height of each node in an AVL, or its color in an RBT.
+    protected int[] balances;
+
+    protected int root;
+
+    // The node of every missing child, which is "NONE" but in an RBT (where
+    // it's the sentinel, whose children are missing, and which has no key).
+    protected final int nil;
+
+    // The nodes ever allocated, and the first released one (if any).
+    private int count = 0;
+    private int released = NONE;
+
+    // The stack of the iterative traversals, which is reused.
+    private int[] stack = new int[INITIAL_CAPACITY];
+
+    protected PooledTree(boolean sentinel) {
+        keys = new int[INITIAL_CAPACITY];
+        lefts = new int[INITIAL_CAPACITY];
+        rights = new int[INITIAL_CAPACITY];
+        parents = sentinel ? new int[INITIAL_CAPACITY] : null;
+        balances = new int[INITIAL_CAPACITY];
+        if (sentinel) {
+            nil = count++;
+            lefts[nil] = NONE;
+            rights[nil] = NONE;
+            parents[nil] = NONE;
+        } else {
+            nil = NONE;
+        }
+        root = nil;
+    }
+
+    public abstract void insert(int element);
+
+    public abstract void remove(int element);
+
+    // Inserts every element, in order. The balanced trees override it, to
+    // build themselves at once (in linear time) when they are empty.
+    public void insertAll(List<Integer> elements) {
+        for (int element : elements)
+            this.insert(element);
+    }
+
+    // Only an AVL keeps the heights of its nodes, so the height of the other
+    // trees is always 0 (as in "Tree").
+    public int height() {
+        return 0;
+    }
+
+    // Looking for a missing element in an RBT reaches its sentinel, which has
+    // no key, so it throws (as in "Tree").
+    public boolean includes(int element) {
+        int node = root;
+        while (node != NONE) {
+            if (node == nil)
+                throw new NullPointerException();
+            if (keys[node] == element)
+                return true;
+            node = keys[node] > element ? lefts[node] : rights[node];
+        }
+        return false;
+    }
+
+    public int depth(int value) {
+        int node = root;
+        int depth = 0;
+        while (node != NONE) {
+            if (node == nil)
+                throw new NullPointerException();
+            if (keys[node] == value)
+                break;
+            node = keys[node] > value ? lefts[node] : rights[node];
+            ++depth;
+        }
+        if (node == NONE)
+            depth = -1;
+        System.out.println(depth);
+        return depth;
+    }
+
+    // ===== For drawing =====
+
+    public void visualize() throws IOException {
+        MutableGraph graph = mutGraph("tree").setDirected(true);
+        int qtyNils = 0;
+        int size = 0;
+        int node = root;
+        while (!isEmpty(node) || size != 0) {
+            if (!isEmpty(node)) {
+                size = push(size, node);
+                node = lefts[node];
+                continue;
+            }
+            node = stack[--size];
+            MutableNode mutNode = mutNode(Integer.toString(keys[node]));
+            if (lefts[node] != NONE || rights[node] != NONE) {
+                qtyNils = addLink(mutNode, lefts[node], qtyNils);
+                qtyNils = addLink(mutNode, rights[node], qtyNils);
+            }
+            mutNode.add(Attributes.attr("fillcolor", "white"));
+            mutNode.add(Attributes.attr("color", isRed(node) ? "red" : "black"));
+            mutNode.add(Style.FILLED);
+            graph.add(mutNode);
+            node = rights[node];
+        }
+        Tree.render(graph);
+    }
+
+    public void inorder() {
+        StringBuilder builder = new StringBuilder();
+        int size = 0;
+        int node = root;
+        while (!isEmpty(node) || size != 0) {
+            if (!isEmpty(node)) {
+                size = push(size, node);
+                node = lefts[node];
+                continue;
+            }
+            node = stack[--size];
+            builder.append(keys[node]).append(' ');
+            node = rights[node];
+        }
+        System.out.println(builder);
+    }
+
+    public void preorder() {
+        StringBuilder builder = new StringBuilder();
+        int size = isEmpty(root) ? 0 : push(0, root);
+        while (size != 0) {
+            int node = stack[--size];
+            builder.append(keys[node]).append(' ');
+            if (!isEmpty(rights[node]))
+                size = push(size, rights[node]);
+            if (!isEmpty(lefts[node]))
+                size = push(size, lefts[node]);
+        }
+        System.out.println(builder);
+    }
+
+    public void postorder() {
+        StringBuilder builder = new StringBuilder();
+        int size = 0;
+        int node = root;
+        int visited = NONE;
+        while (!isEmpty(node) || size != 0) {
+            if (!isEmpty(node)) {
+                size = push(size, node);
+                node = lefts[node];
+                continue;
+            }
+            int top = stack[size - 1];
+            if (!isEmpty(rights[top]) && rights[top] != visited) {
+                node = rights[top];
+            } else {
+                builder.append(keys[top]).append(' ');
+                visited = top;
+                --size;
+            }
+        }
+        System.out.println(builder);
+    }
+
+    // Returns a node with the key, and no children (nor parent). The arrays
+    // may be replaced, so a caller must not hold one of them across a call
+    // that allocates (e.g., "lefts[node] = insert(...)" would write the old
+    // array).
+    protected int allocate(int key) {
+        int node = released;
+        if (node != NONE) {
+            released = lefts[node];
+        } else {
+            reserve(1);
+            node = count++;
+        }
+        keys[node] = key;
+        lefts[node] = nil;
+        rights[node] = nil;
+        if (parents != null)
+            parents[node] = nil;
+        balances[node] = 0;
+        return node;
+    }
+
+    // Releases a node (which is no longer linked), to be reused.
+    protected void release(int node) {
+        lefts[node] = released;
+        released = node;
+    }
+
+    // Makes room for "more" nodes (without reusing the released ones), so a
+    // tree built at once grows its arrays only once.
+    protected void reserve(int more) {
+        if (count + more <= keys.length)
+            return;
+        int capacity = Math.max(count + more, 2 * keys.length);
+        keys = Arrays.copyOf(keys, capacity);
+        lefts = Arrays.copyOf(lefts, capacity);
+        rights = Arrays.copyOf(rights, capacity);
+        if (parents != null)
+            parents = Arrays.copyOf(parents, capacity);
+        balances = Arrays.copyOf(balances, capacity);
+    }
+
+    // The border color of a node, which is only red in an RBT.
+    protected boolean isRed(int node) {
+        return false;
+    }
+
+    protected boolean isEmpty(int node) {
+        return node == NONE || node == nil;
+    }
+
+    private int push(int size, int node) {
+        if (size == stack.length)
+            stack = Arrays.copyOf(stack, 2 * size);
+        stack[size] = node;
+        return size + 1;
+    }
+
+    // Links a node to a child: a missing one is linked to an invisible node,
+    // and the sentinel to a "nil" node. Returns the count of "nil" nodes.
+    private int addLink(MutableNode mutNode, int child, int qtyNils) {
+        if (child == NONE) {
+            Link invisibleLink = Factory.to(mutNode("invisible").add(Style.INVIS)).with(Style.INVIS);
+            mutNode.addLink(invisibleLink);
+        } else if (child == nil) {
+            mutNode.addLink(mutNode("nil" + qtyNils++).add(Label.of("nil")));
+        } else {
+            mutNode.addLink(mutNode(Integer.toString(keys[child])));
+        }
+        return qtyNils;
+    }
+}
@@ -1,6 +1,7 @@
 // Based on: https://github.com/Bibeknam/algorithmtutorprograms/blob/master/data-structures/red-black-trees/RedBlackTree.java
 
 import java.awt.*;
+import java.util.List;
 import java.util.function.Function;
 
 public class RBT<T extends Comparable<? super T>> extends Tree<T> {
@@ -61,6 +62,33 @@ public class RBT<T extends Comparable<? super T>> extends Tree<T> {
         fixInsert(node);
     }
 
+    // build an empty tree at once from the sorted elements (duplicates
+    // included, as "insert" does), without any rotation or recoloring
+    @Override
+    public void insertAll(List<T> elements) {
+        if (root != TNULL) {
+            super.insertAll(elements);
+            return;
+        }
+        List<T> sorted = sortedElements(elements, true);
+        // Every leaf of a balanced build is at one of the last 2 levels, so
+        // the deepest level is red and the rest is black (but a lone root).
+        int redDepth = sorted.size() < 2 ? -1 : 31 - Integer.numberOfLeadingZeros(sorted.size());
+        root = build(sorted, 0, sorted.size(), TNULL, 0, redDepth);
+    }
+
+    private Node<T> build(List<T> sorted, int from, int to, Node<T> parent, int depth, int redDepth) {
+        if (from == to)
+            return TNULL;
+        int middle = (from + to) >>> 1;
+        Node<T> node = new Node<>(sorted.get(middle));
+        node.setParent(parent);
+        node.setBorderColor(depth == redDepth ? Color.RED : Color.BLACK);
+        node.setLeft(build(sorted, from, middle, node, depth + 1, redDepth));
+        node.setRight(build(sorted, middle + 1, to, node, depth + 1, redDepth));
+        return node;
+    }
+
     // delete the node from the tree
     @Override
     public void remove(T element) {
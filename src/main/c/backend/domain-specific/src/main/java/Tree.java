@@ -9,7 +9,9 @@ import java.awt.*;
 import java.io.File;
 import java.io.IOException;
 import java.lang.reflect.Field;
+import java.util.ArrayList;
 import java.util.Iterator;
+import java.util.List;
 import java.util.function.Function;
 
 import static guru.nidi.graphviz.model.Factory.*;
@@ -32,6 +34,14 @@ public abstract class Tree<T extends Comparable<? super T>> implements Iterable<
 
     abstract void remove(T element);
 
+    // Inserts every element, in order. The balanced trees override it, to
+    // build themselves at once (in linear time) when they are empty, which
+    // gives them another shape (so it's only used when none is observed).
+    public void insertAll(List<T> elements) {
+        for (T element : elements)
+            this.insert(element);
+    }
+
     abstract <E extends Comparable<? super E>> Tree<E> reduce(Function<T, E> function);
 
     public void addTree(Tree<T> tree) {
@@ -118,6 +128,12 @@ public abstract class Tree<T extends Comparable<? super T>> implements Iterable<
                 graph.add(mutNode);
             }
         }
+        render(graph);
+    }
+
+    // Renders a graph into the next DOT file (the trees of primitive keys
+    // render theirs here too, so the files are numbered in order).
+    static void render(MutableGraph graph) throws IOException {
         String pathDot = DOT_DIR + DOT_FILE_COUNTER + DOT_EXT;
         Graphviz.fromGraph(graph).render(Format.DOT).toFile(new File(pathDot));
         DOT_FILE_COUNTER++;
@@ -215,6 +231,25 @@ public abstract class Tree<T extends Comparable<? super T>> implements Iterable<
         return node;
     }
 
+    // Returns the elements in ascending order (without duplicates, unless they
+    // must be kept). Already sorted elements are only checked, in linear time.
+    protected static <T extends Comparable<? super T>> List<T> sortedElements(List<T> elements, boolean keepDuplicates) {
+        List<T> sorted = new ArrayList<>(elements);
+        boolean ascending = true;
+        for (int k = 1; ascending && k < sorted.size(); ++k)
+            ascending = sorted.get(k - 1).compareTo(sorted.get(k)) <= 0;
+        if (!ascending)
+            sorted.sort(null);
+        if (keepDuplicates)
+            return sorted;
+        List<T> distinct = new ArrayList<>(sorted.size());
+        for (T element : sorted) {
+            if (distinct.isEmpty() || distinct.get(distinct.size() - 1).compareTo(element) != 0)
+                distinct.add(element);
+        }
+        return distinct;
+    }
+
     // A utility function to get height of the tree
     protected int heightFromNode(Node<T> N) {
         if (N == null)
@@ -0,0 +1,470 @@
+#include "IntermediateRepresentation.h"
+
+/* MODULE INTERNAL STATE */
+
+// The initial capacity of the arrays of instructions and variables.
+#define INITIAL_IR_CAPACITY 256
+
+// The spaces of each level of indentation of the listing.
+#define IR_LISTING_INDENTATION 2
+
+// The deepest block indented in the listing (the deeper ones are not, so the
+// listing stays linear in the IR).
+#define IR_LISTING_MAXIMUM_DEPTH 32
+
+static Logger * _logger = NULL;
+
+void initializeIntermediateRepresentationModule() {
+	_logger = createLogger("IntermediateRepresentation");
+}
+
+void shutdownIntermediateRepresentationModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _reserve(IntermediateRepresentation * intermediateRepresentation, void ** elements, uint32_t * count, uint32_t * capacity, const size_t size, uint32_t * index);
+static unsigned int _temporaryOperands(const IrInstruction * instruction);
+static void _dumpOperand(const IntermediateRepresentation * intermediateRepresentation, const IrOperand * operand, FILE * file);
+static void _dumpVariable(const IntermediateRepresentation * intermediateRepresentation, const IrVariableIndex variable, FILE * file);
+
+/**
+ * Reserves a slot at the end of an array, doubling its capacity if it's full.
+ * Returns false if there is no memory left.
+ */
+static boolean _reserve(IntermediateRepresentation * intermediateRepresentation, void ** elements, uint32_t * count, uint32_t * capacity, const size_t size, uint32_t * index) {
+	if (*count == *capacity) {
+		const uint32_t newCapacity = *capacity == 0 ? INITIAL_IR_CAPACITY : 2 * *capacity;
+		void * newElements = newCapacity < *capacity ? NULL : realloc(*elements, newCapacity * size);
+		if (newElements == NULL) {
+			if (!intermediateRepresentation->exhausted) {
+				logCritical(_logger, "Cannot allocate %u elements of %zu bytes.", newCapacity, size);
+			}
+			intermediateRepresentation->exhausted = true;
+			return false;
+		}
+		*elements = newElements;
+		*capacity = newCapacity;
+	}
+	*index = (*count)++;
+	return true;
+}
+
+/**
+ * Returns the number of operands of an instruction that are temporaries.
+ */
+static unsigned int _temporaryOperands(const IrInstruction * instruction) {
+	return (instruction->operands[0].kind == IR_TEMPORARY_OPERAND ? 1 : 0)
+		+ (instruction->operands[1].kind == IR_TEMPORARY_OPERAND ? 1 : 0);
+}
+
+static void _dumpOperand(const IntermediateRepresentation * intermediateRepresentation, const IrOperand * operand, FILE * file) {
+	switch (operand->kind) {
+		case IR_CONSTANT_OPERAND:
+			if (operand->type == IR_BOOLEAN) {
+				fputs(operand->constant ? "true" : "false", file);
+			}
+			else {
+				fprintf(file, "%d", operand->constant);
+			}
+			break;
+		case IR_STRING_OPERAND:
+			fprintf(file, "\"%s\"", operand->string);
+			break;
+		case IR_TEMPORARY_OPERAND:
+			fprintf(file, "%%%u", operand->temporary);
+			break;
+		case IR_VARIABLE_OPERAND:
+			_dumpVariable(intermediateRepresentation, operand->variable, file);
+			break;
+		default:
+			break;
+	}
+}
+
+static void _dumpVariable(const IntermediateRepresentation * intermediateRepresentation, const IrVariableIndex variable, FILE * file) {
+	const IrVariable * irVariable = &intermediateRepresentation->variables[variable];
+	if (irVariable->synthetic) {
+		fprintf(file, "%s_%u", irVariable->name, variable);
+	}
+	else {
+		fputs(irVariable->name, file);
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+IntermediateRepresentation * createIntermediateRepresentation() {
+	IntermediateRepresentation * intermediateRepresentation = calloc(1, sizeof(IntermediateRepresentation));
+	if (intermediateRepresentation == NULL) {
+		logCritical(_logger, "Cannot allocate the IR.");
+	}
+	return intermediateRepresentation;
+}
+
+IrInstructionIndex appendIrInstruction(IntermediateRepresentation * intermediateRepresentation, const IrInstruction instruction) {
+	IrInstructionIndex index = 0;
+	if (_reserve(intermediateRepresentation, (void **) &intermediateRepresentation->instructions,
+			&intermediateRepresentation->instructionCount, &intermediateRepresentation->instructionCapacity, sizeof(IrInstruction), &index)) {
+		intermediateRepresentation->instructions[index] = instruction;
+	}
+	return index;
+}
+
+IrVariableIndex appendIrVariable(IntermediateRepresentation * intermediateRepresentation, const IrVariable variable) {
+	IrVariableIndex index = IR_NO_VARIABLE;
+	if (_reserve(intermediateRepresentation, (void **) &intermediateRepresentation->variables,
+			&intermediateRepresentation->variableCount, &intermediateRepresentation->variableCapacity, sizeof(IrVariable), &index)) {
+		intermediateRepresentation->variables[index] = variable;
+	}
+	return index;
+}
+
+IrInstructionIndex appendRenamedIrInstruction(IntermediateRepresentation * intermediateRepresentation, IrInstruction instruction, const IrInstructionIndex * renames) {
+	for (unsigned int k = 0; k < 2; ++k) {
+		if (instruction.operands[k].kind == IR_TEMPORARY_OPERAND) {
+			instruction.operands[k].temporary = renames[instruction.operands[k].temporary];
+		}
+	}
+	return appendIrInstruction(intermediateRepresentation, instruction);
+}
+
+void copyIrInstructions(IntermediateRepresentation * intermediateRepresentation, const IrInstruction * instructions, const IrInstructionIndex first, const IrInstructionIndex last, IrInstructionIndex * renames) {
+	for (IrInstructionIndex k = first; k < last; ++k) {
+		renames[k] = appendRenamedIrInstruction(intermediateRepresentation, instructions[k], renames);
+	}
+}
+
+IrInstruction * detachIrInstructions(IntermediateRepresentation * intermediateRepresentation, uint32_t * count) {
+	IrInstruction * instructions = intermediateRepresentation->instructions;
+	*count = intermediateRepresentation->instructionCount;
+	intermediateRepresentation->instructions = NULL;
+	intermediateRepresentation->instructionCount = 0;
+	intermediateRepresentation->instructionCapacity = 0;
+	return instructions;
+}
+
+IrInstructionIndex irStatementStart(const IrInstruction * instructions, const IrInstructionIndex statement) {
+	IrInstructionIndex start = statement;
+	for (unsigned int pending = _temporaryOperands(&instructions[statement]); 0 < pending; ) {
+		--start;
+		pending += _temporaryOperands(&instructions[start]) - 1;
+	}
+	return start;
+}
+
+IrInstructionIndex irStatementEnd(const IrInstruction * instructions, const uint32_t count, const IrInstructionIndex index) {
+	IrInstructionIndex end = index;
+	while (end < count && instructions[end].type != IR_VOID) {
+		++end;
+	}
+	return end;
+}
+
+IrInstructionIndex irTreeOperation(const IntermediateRepresentation * intermediateRepresentation, IrVariableIndex * variable) {
+	for (IrInstructionIndex k = 0; k < intermediateRepresentation->instructionCount; ++k) {
+		const IrInstruction * instruction = &intermediateRepresentation->instructions[k];
+		if (!isIrOperation(instruction->opcode) && instruction->opcode != IR_STORE) {
+			continue;
+		}
+		for (unsigned int operand = 0; operand < 2; ++operand) {
+			const IrOperand * irOperand = &instruction->operands[operand];
+			if (irOperand->kind != IR_VARIABLE_OPERAND) {
+				continue;
+			}
+			const IrType type = intermediateRepresentation->variables[irOperand->variable].type;
+			if (type != IR_INTEGER && type != IR_BOOLEAN) {
+				*variable = irOperand->variable;
+				return k;
+			}
+		}
+	}
+	return intermediateRepresentation->instructionCount;
+}
+
+IrInstructionIndex irBlockEnd(const IrInstruction * instructions, const uint32_t count, const IrInstructionIndex opening) {
+	unsigned int depth = 0;
+	for (IrInstructionIndex k = opening + 1; k < count; ++k) {
+		switch (instructions[k].opcode) {
+			case IR_IF:
+			case IR_FOR:
+				++depth;
+				break;
+			case IR_ELSE:
+				if (depth == 0) {
+					return k;
+				}
+				break;
+			case IR_END_IF:
+			case IR_END_FOR:
+				if (depth == 0) {
+					return k;
+				}
+				--depth;
+				break;
+			default:
+				break;
+		}
+	}
+	return count;
+}
+
+IrInstructionIndex irChunkEnd(const IrInstruction * instructions, const uint32_t count, const IrInstructionIndex start, const uint32_t size) {
+	IrInstructionIndex end = start;
+	while (end < count) {
+		IrInstructionIndex next = irStatementEnd(instructions, count, end);
+		if (next < count && (instructions[next].opcode == IR_IF || instructions[next].opcode == IR_FOR)) {
+			next = irBlockEnd(instructions, count, next);
+			if (next < count && instructions[next].opcode == IR_ELSE) {
+				next = irBlockEnd(instructions, count, next);
+			}
+		}
+		next = next < count ? next + 1 : count;
+		if (start < end && size < next - start) {
+			break;
+		}
+		end = next;
+	}
+	return end;
+}
+
+uint32_t irChunkVariables(const IntermediateRepresentation * intermediateRepresentation, const uint32_t size, uint32_t * chunks) {
+	const uint32_t count = intermediateRepresentation->instructionCount;
+	for (IrVariableIndex v = 0; v < intermediateRepresentation->variableCount; ++v) {
+		chunks[v] = 0;
+	}
+	uint32_t chunk = 0;
+	for (IrInstructionIndex start = 0; start < count; ++chunk) {
+		const IrInstructionIndex end = irChunkEnd(intermediateRepresentation->instructions, count, start, size);
+		for (IrInstructionIndex k = start; k < end; ++k) {
+			const IrInstruction * instruction = &intermediateRepresentation->instructions[k];
+			if (instruction->opcode == IR_DECLARE || instruction->opcode == IR_FOR) {
+				chunks[instruction->variable] = chunk;
+			}
+			else if (instruction->variable != IR_NO_VARIABLE && chunks[instruction->variable] != chunk) {
+				chunks[instruction->variable] = IR_SHARED_CHUNK;
+			}
+			for (unsigned int operand = 0; operand < 2; ++operand) {
+				const IrOperand * irOperand = &instruction->operands[operand];
+				if (irOperand->kind == IR_VARIABLE_OPERAND && chunks[irOperand->variable] != chunk) {
+					chunks[irOperand->variable] = IR_SHARED_CHUNK;
+				}
+			}
+		}
+		start = end;
+	}
+	return chunk;
+}
+
+boolean verifyIntermediateRepresentation(const IntermediateRepresentation * intermediateRepresentation) {
+	const uint32_t count = intermediateRepresentation->instructionCount;
+	// The pending temporaries, and the opened blocks, share the allocation.
+	uint32_t * pending = malloc((2 * (size_t) count + 1) * sizeof(uint32_t));
+	if (pending == NULL) {
+		logCritical(_logger, "Cannot allocate the state of the verification.");
+		return false;
+	}
+	uint32_t * blocks = pending + count;
+	uint32_t pendingCount = 0;
+	uint32_t blockCount = 0;
+	const char * violation = NULL;
+	IrInstructionIndex k = 0;
+	for (; k < count; ++k) {
+		const IrInstruction * instruction = &intermediateRepresentation->instructions[k];
+		for (int j = 1; violation == NULL && 0 <= j; --j) {
+			const IrOperand * operand = &instruction->operands[j];
+			if (operand->kind == IR_TEMPORARY_OPERAND) {
+				if (pendingCount == 0 || pending[pendingCount - 1] != operand->temporary) {
+					violation = "a temporary is not used in post-order";
+				}
+				else {
+					--pendingCount;
+				}
+			}
+			else if (operand->kind == IR_VARIABLE_OPERAND && intermediateRepresentation->variableCount <= operand->variable) {
+				violation = "an operand is an unknown variable";
+			}
+		}
+		if (violation != NULL) {
+			break;
+		}
+		if (instruction->variable != IR_NO_VARIABLE && intermediateRepresentation->variableCount <= instruction->variable) {
+			violation = "the variable is unknown";
+		}
+		else if (instruction->type != IR_VOID) {
+			pending[pendingCount++] = k;
+		}
+		else if (0 < pendingCount) {
+			violation = "a statement leaves unused temporaries";
+		}
+		else if (instruction->opcode == IR_IF || instruction->opcode == IR_FOR) {
+			blocks[blockCount++] = instruction->opcode;
+		}
+		else if (instruction->opcode == IR_ELSE) {
+			if (blockCount == 0 || blocks[blockCount - 1] != IR_IF) {
+				violation = "an \"else\" has no \"if\"";
+			}
+			else {
+				blocks[blockCount - 1] = IR_ELSE;
+			}
+		}
+		else if (instruction->opcode == IR_END_IF) {
+			if (blockCount == 0 || (blocks[blockCount - 1] != IR_IF && blocks[blockCount - 1] != IR_ELSE)) {
+				violation = "an \"if\" is not closed properly";
+			}
+			else {
+				--blockCount;
+			}
+		}
+		else if (instruction->opcode == IR_END_FOR) {
+			if (blockCount == 0 || blocks[blockCount - 1] != IR_FOR) {
+				violation = "a \"for\" is not closed properly";
+			}
+			else {
+				--blockCount;
+			}
+		}
+		if (violation != NULL) {
+			break;
+		}
+	}
+	if (violation == NULL && (0 < pendingCount || 0 < blockCount)) {
+		violation = "the program ends inside an expression (or a block)";
+	}
+	free(pending);
+	if (violation != NULL) {
+		logCritical(_logger, "The IR is not valid at instruction %u: %s.", k, violation);
+		return false;
+	}
+	return true;
+}
+
+void dumpIntermediateRepresentation(const IntermediateRepresentation * intermediateRepresentation, FILE * file) {
+	fprintf(file, "; %u instruction(s), %u variable(s)\n",
+		intermediateRepresentation->instructionCount,
+		intermediateRepresentation->variableCount);
+	unsigned int depth = 0;
+	for (IrInstructionIndex k = 0; k < intermediateRepresentation->instructionCount; ++k) {
+		const IrInstruction * instruction = &intermediateRepresentation->instructions[k];
+		const IrOpcode opcode = instruction->opcode;
+		if (opcode == IR_ELSE || opcode == IR_END_IF || opcode == IR_END_FOR) {
+			--depth;
+		}
+		fprintf(file, "%*s", (depth < IR_LISTING_MAXIMUM_DEPTH ? depth : IR_LISTING_MAXIMUM_DEPTH) * IR_LISTING_INDENTATION, "");
+		if (instruction->type != IR_VOID) {
+			fprintf(file, "%%%u: %s = ", k, irTypeName(instruction->type));
+		}
+		fputs(irOpcodeName(opcode), file);
+		const char * separator = " ";
+		if (opcode == IR_DECLARE) {
+			fprintf(file, " %s", irTypeName(intermediateRepresentation->variables[instruction->variable].type));
+		}
+		if (instruction->variable != IR_NO_VARIABLE) {
+			fputs(separator, file);
+			_dumpVariable(intermediateRepresentation, instruction->variable, file);
+			separator = ", ";
+		}
+		for (unsigned int j = 0; j < 2; ++j) {
+			if (instruction->operands[j].kind != IR_NO_OPERAND) {
+				fputs(separator, file);
+				_dumpOperand(intermediateRepresentation, &instruction->operands[j], file);
+				separator = ", ";
+			}
+		}
+		fputc('\n', file);
+		if (opcode == IR_IF || opcode == IR_ELSE || opcode == IR_FOR) {
+			++depth;
+		}
+	}
+}
+
+boolean isIrOperation(const IrOpcode opcode) {
+	return opcode <= IR_NOT;
+}
+
+const char * irOperationSymbol(const IrOpcode opcode) {
+	switch (opcode) {
+		case IR_ADD: return "+";
+		case IR_SUBTRACT: return "-";
+		case IR_MULTIPLY: return "*";
+		case IR_DIVIDE: return "/";
+		case IR_MODULO: return "%";
+		case IR_EQUAL: return "==";
+		case IR_NOT_EQUAL: return "!=";
+		case IR_LESS: return "<";
+		case IR_LESS_EQUAL: return "<=";
+		case IR_GREATER: return ">";
+		case IR_GREATER_EQUAL: return ">=";
+		case IR_AND: return "&&";
+		case IR_OR: return "||";
+		case IR_NOT: return "!";
+		default:
+			return NULL;
+	}
+}
+
+const char * irOpcodeName(const IrOpcode opcode) {
+	switch (opcode) {
+		case IR_ADD: return "add";
+		case IR_SUBTRACT: return "subtract";
+		case IR_MULTIPLY: return "multiply";
+		case IR_DIVIDE: return "divide";
+		case IR_MODULO: return "modulo";
+		case IR_EQUAL: return "equal";
+		case IR_NOT_EQUAL: return "not-equal";
+		case IR_LESS: return "less";
+		case IR_LESS_EQUAL: return "less-equal";
+		case IR_GREATER: return "greater";
+		case IR_GREATER_EQUAL: return "greater-equal";
+		case IR_AND: return "and";
+		case IR_OR: return "or";
+		case IR_NOT: return "not";
+		case IR_DECLARE: return "declare";
+		case IR_STORE: return "store";
+		case IR_INSERT: return "insert";
+		case IR_INSERT_ALL: return "insert-all";
+		case IR_REMOVE: return "remove";
+		case IR_INCLUDES: return "includes";
+		case IR_HEIGHT: return "height";
+		case IR_DEPTH: return "depth";
+		case IR_CALCULATE: return "calculate";
+		case IR_VISUALIZE: return "visualize";
+		case IR_INORDER: return "inorder";
+		case IR_PREORDER: return "preorder";
+		case IR_POSTORDER: return "postorder";
+		case IR_APPEND: return "append";
+		case IR_IF: return "if";
+		case IR_ELSE: return "else";
+		case IR_END_IF: return "end-if";
+		case IR_FOR: return "for";
+		case IR_END_FOR: return "end-for";
+		default:
+			return "unknown";
+	}
+}
+
+const char * irTypeName(const IrType type) {
+	switch (type) {
+		case IR_VOID: return "void";
+		case IR_BOOLEAN: return "boolean";
+		case IR_INTEGER: return "int";
+		case IR_AVL_TREE: return "avl";
+		case IR_BST_TREE: return "bst";
+		case IR_RBT_TREE: return "rbt";
+		case IR_EXP_TREE: return "exp";
+		case IR_LIST: return "list";
+		default:
+			return "unknown";
+	}
+}
+
+void destroyIntermediateRepresentation(IntermediateRepresentation * intermediateRepresentation) {
+	if (intermediateRepresentation != NULL) {
+		free(intermediateRepresentation->instructions);
+		free(intermediateRepresentation->variables);
+		free(intermediateRepresentation);
+	}
+}
@@ -0,0 +1,259 @@
+#ifndef INTERMEDIATE_REPRESENTATION_HEADER
+#define INTERMEDIATE_REPRESENTATION_HEADER
+
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Initialize module's internal state. */
+void initializeIntermediateRepresentationModule();
+
+/** Shutdown module's internal state. */
+void shutdownIntermediateRepresentationModule();
+
+/**
+ * The Intermediate Representation (IR) of a program, lowered from the AST, is
+ * a flat array of typed three-address instructions. An instruction with a
+ * result defines a temporary, named after the index of the instruction, and
+ * its operands are constants, variables or earlier temporaries.
+ *
+ * The expressions are lowered in post-order, so every temporary is used once,
+ * by a later instruction, and only other temporaries are defined in between:
+ * the pending temporaries always form a stack. Since that keeps the
+ * expressions free of side-effects between a definition and its use, an
+ * emitter can evaluate a temporary where it's used (e.g., as a nested Java
+ * expression, which keeps the short-circuit of "&&" and "||").
+ *
+ * An instruction without a result (of type "IR_VOID") is a statement, and it
+ * ends the definitions of its operands. The control-flow is structured, with
+ * markers that nest like the blocks of the program ("IR_IF", "IR_ELSE",
+ * "IR_END_IF", "IR_FOR" and "IR_END_FOR").
+ */
+
+#define IR_NO_VARIABLE UINT32_MAX
+#define IR_SHARED_CHUNK UINT32_MAX
+
+typedef uint32_t IrInstructionIndex;
+typedef uint32_t IrVariableIndex;
+
+typedef enum {
+	IR_VOID,
+	IR_BOOLEAN,
+	IR_INTEGER,
+	IR_AVL_TREE,
+	IR_BST_TREE,
+	IR_RBT_TREE,
+	IR_EXP_TREE,
+	// A list of integers, to insert in bulk.
+	IR_LIST
+} IrType;
+
+typedef enum {
+	// Values (the result is a temporary).
+	IR_ADD,
+	IR_SUBTRACT,
+	IR_MULTIPLY,
+	IR_DIVIDE,
+	IR_MODULO,
+	IR_EQUAL,
+	IR_NOT_EQUAL,
+	IR_LESS,
+	IR_LESS_EQUAL,
+	IR_GREATER,
+	IR_GREATER_EQUAL,
+	IR_AND,
+	IR_OR,
+	IR_NOT,
+	// Variables.
+	IR_DECLARE,
+	IR_STORE,
+	// Trees (the queries have a result, unless it's discarded).
+	IR_INSERT,
+	IR_INSERT_ALL,
+	IR_REMOVE,
+	IR_INCLUDES,
+	IR_HEIGHT,
+	IR_DEPTH,
+	IR_CALCULATE,
+	IR_VISUALIZE,
+	IR_INORDER,
+	IR_PREORDER,
+	IR_POSTORDER,
+	// Lists.
+	IR_APPEND,
+	// Control-flow.
+	IR_IF,
+	IR_ELSE,
+	IR_END_IF,
+	IR_FOR,
+	IR_END_FOR
+} IrOpcode;
+
+typedef enum {
+	IR_NO_OPERAND,
+	IR_CONSTANT_OPERAND,
+	IR_STRING_OPERAND,
+	IR_TEMPORARY_OPERAND,
+	IR_VARIABLE_OPERAND
+} IrOperandKind;
+
+typedef struct {
+	IrOperandKind kind;
+	IrType type;
+	union {
+		// A boolean constant is either 0 or 1.
+		int constant;
+		const char * string;
+		IrInstructionIndex temporary;
+		IrVariableIndex variable;
+	};
+} IrOperand;
+
+/**
+ * The variable of an instruction is the one it declares or writes, the tree
+ * (or list) it operates on, or the variable of a loop. The loop variable is
+ * declared by its "IR_FOR", which iterates over the range [operands[0],
+ * operands[1]), and the range is evaluated before each iteration.
+ */
+typedef struct {
+	IrOpcode opcode;
+	// The type of the result, or "IR_VOID" if it's a statement.
+	IrType type;
+	IrVariableIndex variable;
+	IrOperand operands[2];
+} IrInstruction;
+
+/**
+ * A variable of the program, or one made by the compiler (which is named after
+ * its purpose and its index, so it never clashes with the program).
+ */
+typedef struct {
+	// Interned, if it comes from the program.
+	const char * name;
+	IrType type;
+	boolean synthetic;
+} IrVariable;
+
+typedef struct {
+	IrInstruction * instructions;
+	uint32_t instructionCount;
+	uint32_t instructionCapacity;
+
+	IrVariable * variables;
+	uint32_t variableCount;
+	uint32_t variableCapacity;
+
+	// True if some instruction (or variable) could not be allocated.
+	boolean exhausted;
+} IntermediateRepresentation;
+
+/**
+ * Creates an empty IR. Returns NULL if there is no memory left.
+ */
+IntermediateRepresentation * createIntermediateRepresentation();
+
+/**
+ * Appends an instruction (or a variable), and returns its index. If there is
+ * no memory left, the IR is marked as exhausted, and the returned index must
+ * not be used.
+ */
+IrInstructionIndex appendIrInstruction(IntermediateRepresentation * intermediateRepresentation, const IrInstruction instruction);
+IrVariableIndex appendIrVariable(IntermediateRepresentation * intermediateRepresentation, const IrVariable variable);
+
+/**
+ * Appends an instruction of a previous version of the IR, whose temporaries
+ * are renamed with "renames" (indexed by the previous version). The caller
+ * records the new name of its result, if any.
+ */
+IrInstructionIndex appendRenamedIrInstruction(IntermediateRepresentation * intermediateRepresentation, IrInstruction instruction, const IrInstructionIndex * renames);
+
+/**
+ * Appends the instructions [first, last) of a previous version of the IR, and
+ * records the new name of each one in "renames".
+ */
+void copyIrInstructions(IntermediateRepresentation * intermediateRepresentation, const IrInstruction * instructions, const IrInstructionIndex first, const IrInstructionIndex last, IrInstructionIndex * renames);
+
+/**
+ * Takes the instructions out of the IR, which is left empty (but with its
+ * variables), so a pass can append a rewritten version. The caller owns the
+ * returned array.
+ */
+IrInstruction * detachIrInstructions(IntermediateRepresentation * intermediateRepresentation, uint32_t * count);
+
+/**
+ * Returns the first instruction of the statement that ends at the specified
+ * one, that is, the definition of its first operand (or the statement itself).
+ */
+IrInstructionIndex irStatementStart(const IrInstruction * instructions, const IrInstructionIndex statement);
+
+/**
+ * Returns the statement that ends at, or after, the specified instruction.
+ */
+IrInstructionIndex irStatementEnd(const IrInstruction * instructions, const uint32_t count, const IrInstructionIndex index);
+
+/**
+ * Returns the marker that closes the block opened by the specified "IR_IF",
+ * "IR_ELSE" or "IR_FOR" (i.e., the "IR_ELSE" of an "IR_IF", if any).
+ */
+IrInstructionIndex irBlockEnd(const IrInstruction * instructions, const uint32_t count, const IrInstructionIndex opening);
+
+/**
+ * Returns the end of the chunk that starts at the specified instruction: as
+ * many top-level statements (with their operands, and their blocks) as fit in
+ * "size" instructions, but at least one.
+ */
+IrInstructionIndex irChunkEnd(const IrInstruction * instructions, const uint32_t count, const IrInstructionIndex start, const uint32_t size);
+
+/**
+ * Partitions the IR in chunks of "size" instructions (see "irChunkEnd"), and
+ * records the chunk that declares each variable, or "IR_SHARED_CHUNK" if
+ * another chunk uses it too (an unused variable is left in the first chunk).
+ * Returns the number of chunks.
+ */
+uint32_t irChunkVariables(const IntermediateRepresentation * intermediateRepresentation, const uint32_t size, uint32_t * chunks);
+
+/**
+ * Returns the first operation (or store) of the IR that operates on a whole
+ * tree (or list), such as "c = a + b", which has no counterpart in any
+ * runtime, and writes that variable. Returns the instruction count if every
+ * operation operates on values.
+ */
+IrInstructionIndex irTreeOperation(const IntermediateRepresentation * intermediateRepresentation, IrVariableIndex * variable);
+
+/**
+ * Returns true if the operands of the IR keep its invariants (see above), and
+ * its blocks are balanced. Otherwise, logs the first violation.
+ */
+boolean verifyIntermediateRepresentation(const IntermediateRepresentation * intermediateRepresentation);
+
+/**
+ * Writes a human-readable listing of the IR, with an instruction per line, and
+ * the blocks indented.
+ */
+void dumpIntermediateRepresentation(const IntermediateRepresentation * intermediateRepresentation, FILE * file);
+
+/**
+ * Returns true if the opcode computes a value from its operands only (i.e.,
+ * an arithmetic, relational or logical operation).
+ */
+boolean isIrOperation(const IrOpcode opcode);
+
+/**
+ * Returns the operator of an operation, in the notation of Java (and C).
+ */
+const char * irOperationSymbol(const IrOpcode opcode);
+
+/**
+ * Returns the name of an opcode (or of a type), as shown by the listing.
+ */
+const char * irOpcodeName(const IrOpcode opcode);
+const char * irTypeName(const IrType type);
+
+/**
+ * Releases the instructions and variables of the IR, and the IR itself.
+ */
+void destroyIntermediateRepresentation(IntermediateRepresentation * intermediateRepresentation);
+
+#endif
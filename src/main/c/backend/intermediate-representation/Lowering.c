@@ -0,0 +1,601 @@
+#include "Lowering.h"
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializeLoweringModule() {
+	_logger = createLogger("Lowering");
+}
+
+void shutdownLoweringModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+typedef struct {
+	AbstractSyntaxTree * abstractSyntaxTree;
+	IntermediateRepresentation * intermediateRepresentation;
+	Arena * arena;
+	symbolTableADT symbolTable;
+
+	// The operands of the expression being lowered, as a stack.
+	IrOperand * operands;
+	uint32_t operandCount;
+	uint32_t operandCapacity;
+
+	// The text of the argument of a "calculate".
+	char * text;
+	size_t textLength;
+	size_t textCapacity;
+
+	// A stack for the expressions, reused by every statement.
+	NodeStack expressions;
+
+	// False if some variable cannot be resolved, or there is no memory left.
+	boolean succeed;
+} Lowering;
+
+/* PRIVATE FUNCTIONS */
+
+static IrType _declarationType(const DeclarationType type);
+static IrOpcode _operationOpcode(const ExpressionType type);
+static IrOperand _constantOperand(const IrType type, const int constant);
+static IrOperand _temporaryOperand(Lowering * lowering, const IrInstructionIndex temporary);
+static IrOperand _variableOperand(Lowering * lowering, const IrVariableIndex variable);
+static IrInstruction _instruction(const IrOpcode opcode, const IrType type, const IrVariableIndex variable, const IrOperand left, const IrOperand right);
+static IrOperand _emit(Lowering * lowering, const IrInstruction instruction);
+static void _pushOperand(Lowering * lowering, const IrOperand operand);
+static IrOperand _popOperand(Lowering * lowering);
+static IrVariableIndex _declare(Lowering * lowering, char * varName, const IrType type);
+static IrVariableIndex _resolve(Lowering * lowering, char * varName);
+static IrOperand _lowerExpression(Lowering * lowering, const ExpressionIndex index);
+static void _appendText(Lowering * lowering, const char * token);
+static IrOperand _lowerCalculation(Lowering * lowering, const ExpressionIndex index);
+static IrOperand _lowerFunctionCall(Lowering * lowering, const FunctionCallIndex index, const boolean discarded);
+static void _lowerAssignment(Lowering * lowering, const IrVariableIndex variable, Assignment * assignment);
+static boolean _lowerStatement(Lowering * lowering, Statement * statement, const uint32_t stage, StatementIndex * block);
+static void _lowerProgram(Lowering * lowering);
+
+/**
+ * Converts the type of a declaration into the type of its variable.
+ */
+static IrType _declarationType(const DeclarationType type) {
+	switch (type) {
+		case AVL_DECLARATION: return IR_AVL_TREE;
+		case BST_DECLARATION: return IR_BST_TREE;
+		case RBT_DECLARATION: return IR_RBT_TREE;
+		case EXP_DECLARATION: return IR_EXP_TREE;
+		case BOOL_DECLARATION: return IR_BOOLEAN;
+		default:
+			return IR_INTEGER;
+	}
+}
+
+/**
+ * Converts the type of an operation (i.e., not a factor) into its opcode.
+ */
+static IrOpcode _operationOpcode(const ExpressionType type) {
+	switch (type) {
+		case ADDITION_EXP: return IR_ADD;
+		case SUBTRACTION_EXP: return IR_SUBTRACT;
+		case MULTIPLICATION_EXP: return IR_MULTIPLY;
+		case DIVISION_EXP: return IR_DIVIDE;
+		case MODULE_EXP: return IR_MODULO;
+		case EQUAL_EXP: return IR_EQUAL;
+		case NOT_EQUAL_EXP: return IR_NOT_EQUAL;
+		case LESS_EXP: return IR_LESS;
+		case LESS_EQUAL_EXP: return IR_LESS_EQUAL;
+		case GREATER_EXP: return IR_GREATER;
+		case GREATER_EQUAL_EXP: return IR_GREATER_EQUAL;
+		case AND_EXP: return IR_AND;
+		case OR_EXP: return IR_OR;
+		default:
+			return IR_NOT;
+	}
+}
+
+static IrOperand _constantOperand(const IrType type, const int constant) {
+	const IrOperand operand = {
+		.kind = IR_CONSTANT_OPERAND,
+		.type = type,
+		.constant = constant
+	};
+	return operand;
+}
+
+static IrOperand _temporaryOperand(Lowering * lowering, const IrInstructionIndex temporary) {
+	const IrOperand operand = {
+		.kind = IR_TEMPORARY_OPERAND,
+		.type = lowering->intermediateRepresentation->instructions[temporary].type,
+		.temporary = temporary
+	};
+	return operand;
+}
+
+static IrOperand _variableOperand(Lowering * lowering, const IrVariableIndex variable) {
+	if (variable == IR_NO_VARIABLE) {
+		return _constantOperand(IR_INTEGER, 0);
+	}
+	const IrOperand operand = {
+		.kind = IR_VARIABLE_OPERAND,
+		.type = lowering->intermediateRepresentation->variables[variable].type,
+		.variable = variable
+	};
+	return operand;
+}
+
+static IrInstruction _instruction(const IrOpcode opcode, const IrType type, const IrVariableIndex variable, const IrOperand left, const IrOperand right) {
+	const IrInstruction instruction = {
+		.opcode = opcode,
+		.type = type,
+		.variable = variable,
+		.operands = { left, right }
+	};
+	return instruction;
+}
+
+/**
+ * Appends an instruction, and returns its result (if it has one).
+ */
+static IrOperand _emit(Lowering * lowering, const IrInstruction instruction) {
+	const IrOperand none = { .kind = IR_NO_OPERAND, .type = IR_VOID };
+	const IrInstructionIndex index = appendIrInstruction(lowering->intermediateRepresentation, instruction);
+	if (lowering->intermediateRepresentation->exhausted) {
+		lowering->succeed = false;
+		return none;
+	}
+	return instruction.type == IR_VOID ? none : _temporaryOperand(lowering, index);
+}
+
+static void _pushOperand(Lowering * lowering, const IrOperand operand) {
+	if (lowering->operandCount == lowering->operandCapacity) {
+		const uint32_t capacity = lowering->operandCapacity == 0 ? 64 : 2 * lowering->operandCapacity;
+		IrOperand * operands = capacity < lowering->operandCapacity ? NULL : realloc(lowering->operands, capacity * sizeof(IrOperand));
+		if (operands == NULL) {
+			logCritical(_logger, "Cannot allocate a stack of %u operands.", capacity);
+			lowering->succeed = false;
+			return;
+		}
+		lowering->operands = operands;
+		lowering->operandCapacity = capacity;
+	}
+	lowering->operands[lowering->operandCount++] = operand;
+}
+
+static IrOperand _popOperand(Lowering * lowering) {
+	if (lowering->operandCount == 0) {
+		return _constantOperand(IR_INTEGER, 0);
+	}
+	return lowering->operands[--lowering->operandCount];
+}
+
+/**
+ * Creates the variable of a declaration (or loop), visible in the current
+ * scope.
+ */
+static IrVariableIndex _declare(Lowering * lowering, char * varName, const IrType type) {
+	const IrVariable irVariable = {
+		.name = varName,
+		.type = type,
+		.synthetic = false
+	};
+	const IrVariableIndex variable = appendIrVariable(lowering->intermediateRepresentation, irVariable);
+	if (lowering->intermediateRepresentation->exhausted) {
+		lowering->succeed = false;
+		return IR_NO_VARIABLE;
+	}
+	struct key key = {
+		.varname = varName
+	};
+	struct value value = {
+		.type = INVALID_VAR,
+		.declaration = variable
+	};
+	symbolTableInsert(lowering->symbolTable, &key, &value);
+	return variable;
+}
+
+/**
+ * Returns the variable of the innermost visible declaration of a name.
+ */
+static IrVariableIndex _resolve(Lowering * lowering, char * varName) {
+	struct key key = {
+		.varname = varName
+	};
+	struct value value;
+	if (!symbolTableFind(lowering->symbolTable, &key, &value)) {
+		logError(_logger, "The variable cannot be resolved: \"%s\"", varName);
+		lowering->succeed = false;
+		return IR_NO_VARIABLE;
+	}
+	return value.declaration;
+}
+
+/**
+ * Lowers an expression in post-order, with an explicit stack, so any depth of
+ * nesting is supported. The factors become operands, and every operation
+ * becomes an instruction. Returns the operand with the value of the
+ * expression.
+ */
+static IrOperand _lowerExpression(Lowering * lowering, const ExpressionIndex index) {
+	AbstractSyntaxTree * abstractSyntaxTree = lowering->abstractSyntaxTree;
+	NodeStack * nodeStack = &lowering->expressions;
+	const IrOperand none = { .kind = IR_NO_OPERAND, .type = IR_VOID };
+	if (!pushNodeFrame(nodeStack, index, 0)) {
+		lowering->succeed = false;
+	}
+	while (lowering->succeed && !isNodeStackEmpty(nodeStack)) {
+		NodeFrame * frame = peekNodeFrame(nodeStack);
+		Expression * expression = &abstractSyntaxTree->expressions[frame->index];
+		const uint32_t stage = frame->stage++;
+		switch (expression->type) {
+			case CONSTANT_EXP:
+				_pushOperand(lowering, expression->constant.type == BOOL_CONSTANT
+					? _constantOperand(IR_BOOLEAN, expression->constant.boolValue ? 1 : 0)
+					: _constantOperand(IR_INTEGER, expression->constant.intValue));
+				popNodeFrame(nodeStack);
+				break;
+			case VARIABLE_EXP:
+				_pushOperand(lowering, _variableOperand(lowering, _resolve(lowering, expression->varName)));
+				popNodeFrame(nodeStack);
+				break;
+			case PARENTHESIZED_EXP:
+				if (stage == 0) {
+					lowering->succeed = pushNodeFrame(nodeStack, expression->expression, 0);
+				}
+				else {
+					popNodeFrame(nodeStack);
+				}
+				break;
+			case NOT_EXP:
+				if (stage == 0) {
+					lowering->succeed = pushNodeFrame(nodeStack, expression->leftExpression, 0);
+				}
+				else {
+					const IrOperand operand = _popOperand(lowering);
+					_pushOperand(lowering, _emit(lowering, _instruction(IR_NOT, IR_BOOLEAN, IR_NO_VARIABLE, operand, none)));
+					popNodeFrame(nodeStack);
+				}
+				break;
+			default:
+				if (stage == 0) {
+					lowering->succeed = pushNodeFrame(nodeStack, expression->leftExpression, 0);
+				}
+				else if (stage == 1) {
+					lowering->succeed = pushNodeFrame(nodeStack, expression->rightExpression, 0);
+				}
+				else {
+					const IrOpcode opcode = _operationOpcode(expression->type);
+					const IrType type = opcode <= IR_MODULO ? IR_INTEGER : IR_BOOLEAN;
+					const IrOperand right = _popOperand(lowering);
+					const IrOperand left = _popOperand(lowering);
+					_pushOperand(lowering, _emit(lowering, _instruction(opcode, type, IR_NO_VARIABLE, left, right)));
+					popNodeFrame(nodeStack);
+				}
+				break;
+		}
+	}
+	if (!lowering->succeed) {
+		while (!isNodeStackEmpty(nodeStack)) {
+			popNodeFrame(nodeStack);
+		}
+		lowering->operandCount = 0;
+		return none;
+	}
+	return _popOperand(lowering);
+}
+
+/**
+ * Appends a token to the text of a calculation, after a space (the expression
+ * tree splits the tokens by spaces).
+ */
+static void _appendText(Lowering * lowering, const char * token) {
+	const size_t length = strlen(token);
+	const size_t required = lowering->textLength + length + 2;
+	if (lowering->textCapacity < required) {
+		size_t capacity = lowering->textCapacity == 0 ? 256 : lowering->textCapacity;
+		while (capacity < required) {
+			capacity *= 2;
+		}
+		char * text = realloc(lowering->text, capacity);
+		if (text == NULL) {
+			logCritical(_logger, "Cannot allocate a text of %zu characters.", capacity);
+			lowering->succeed = false;
+			return;
+		}
+		lowering->text = text;
+		lowering->textCapacity = capacity;
+	}
+	if (0 < lowering->textLength) {
+		lowering->text[lowering->textLength++] = ' ';
+	}
+	memcpy(lowering->text + lowering->textLength, token, length);
+	lowering->textLength += length;
+}
+
+/**
+ * Lowers the argument of a "calculate" into a string operand, with the text of
+ * the expression (walked in-order, with an explicit stack).
+ */
+static IrOperand _lowerCalculation(Lowering * lowering, const ExpressionIndex index) {
+	AbstractSyntaxTree * abstractSyntaxTree = lowering->abstractSyntaxTree;
+	NodeStack * nodeStack = &lowering->expressions;
+	char number[16];
+	lowering->textLength = 0;
+	if (!pushNodeFrame(nodeStack, index, 0)) {
+		lowering->succeed = false;
+	}
+	while (lowering->succeed && !isNodeStackEmpty(nodeStack)) {
+		NodeFrame * frame = peekNodeFrame(nodeStack);
+		Expression * expression = &abstractSyntaxTree->expressions[frame->index];
+		const uint32_t stage = frame->stage++;
+		switch (expression->type) {
+			case CONSTANT_EXP:
+				if (expression->constant.type == BOOL_CONSTANT) {
+					_appendText(lowering, expression->constant.boolValue ? "true" : "false");
+				}
+				else {
+					sprintf(number, "%d", expression->constant.intValue);
+					_appendText(lowering, number);
+				}
+				popNodeFrame(nodeStack);
+				break;
+			case VARIABLE_EXP:
+				_appendText(lowering, expression->varName);
+				popNodeFrame(nodeStack);
+				break;
+			case PARENTHESIZED_EXP:
+				_appendText(lowering, stage == 0 ? "(" : ")");
+				if (stage == 0) {
+					lowering->succeed = lowering->succeed && pushNodeFrame(nodeStack, expression->expression, 0);
+				}
+				else {
+					popNodeFrame(nodeStack);
+				}
+				break;
+			case NOT_EXP:
+				if (stage == 0) {
+					_appendText(lowering, "!");
+					lowering->succeed = lowering->succeed && pushNodeFrame(nodeStack, expression->leftExpression, 0);
+				}
+				else {
+					popNodeFrame(nodeStack);
+				}
+				break;
+			default:
+				if (stage == 0) {
+					lowering->succeed = pushNodeFrame(nodeStack, expression->leftExpression, 0);
+				}
+				else if (stage == 1) {
+					_appendText(lowering, irOperationSymbol(_operationOpcode(expression->type)));
+					lowering->succeed = lowering->succeed && pushNodeFrame(nodeStack, expression->rightExpression, 0);
+				}
+				else {
+					popNodeFrame(nodeStack);
+				}
+				break;
+		}
+	}
+	while (!isNodeStackEmpty(nodeStack)) {
+		popNodeFrame(nodeStack);
+	}
+	IrOperand operand = {
+		.kind = IR_STRING_OPERAND,
+		.type = IR_VOID,
+		.string = lowering->succeed ? copyStringToArena(lowering->arena, lowering->text, lowering->textLength) : NULL
+	};
+	if (operand.string == NULL) {
+		lowering->succeed = false;
+		operand.string = "";
+	}
+	return operand;
+}
+
+/**
+ * Lowers a function call into a tree operation. If its result is discarded
+ * (i.e., it's a statement), the instruction has none.
+ */
+static IrOperand _lowerFunctionCall(Lowering * lowering, const FunctionCallIndex index, const boolean discarded) {
+	FunctionCall * functionCall = &lowering->abstractSyntaxTree->functionCalls[index];
+	const IrVariableIndex tree = _resolve(lowering, functionCall->varName);
+	const IrOperand none = { .kind = IR_NO_OPERAND, .type = IR_VOID };
+	IrOpcode opcode;
+	IrType type = IR_VOID;
+	IrOperand argument = none;
+	switch (functionCall->type) {
+		case INSERT_CALL:
+			opcode = IR_INSERT;
+			argument = _lowerExpression(lowering, functionCall->expression);
+			break;
+		case REMOVE_CALL:
+			opcode = IR_REMOVE;
+			argument = _lowerExpression(lowering, functionCall->expression);
+			break;
+		case INCLUDES_CALL:
+			opcode = IR_INCLUDES;
+			type = IR_BOOLEAN;
+			argument = _lowerExpression(lowering, functionCall->expression);
+			break;
+		case HEIGHT_CALL:
+			opcode = IR_HEIGHT;
+			type = IR_INTEGER;
+			break;
+		case DEPTH_CALL:
+			opcode = IR_DEPTH;
+			type = IR_INTEGER;
+			argument = _lowerExpression(lowering, functionCall->expression);
+			break;
+		case CALCULATE_CALL:
+			opcode = IR_CALCULATE;
+			type = IR_INTEGER;
+			argument = _lowerCalculation(lowering, functionCall->expression);
+			break;
+		case VISUALIZE_CALL:
+			opcode = IR_VISUALIZE;
+			break;
+		default:
+			logError(_logger, "Unknown function call type: %d", functionCall->type);
+			lowering->succeed = false;
+			return none;
+	}
+	if (!discarded && type == IR_VOID) {
+		logError(_logger, "The function call has no value: \"%s\" (%s)", functionCall->varName, irOpcodeName(opcode));
+		lowering->succeed = false;
+		return none;
+	}
+	return _emit(lowering, _instruction(opcode, discarded ? IR_VOID : type, tree, argument, none));
+}
+
+/**
+ * Lowers the value of an assignment (or an initialized declaration), and the
+ * store into its variable.
+ */
+static void _lowerAssignment(Lowering * lowering, const IrVariableIndex variable, Assignment * assignment) {
+	const IrOperand none = { .kind = IR_NO_OPERAND, .type = IR_VOID };
+	const IrOperand value = assignment->functionCall == NO_NODE
+		? _lowerExpression(lowering, assignment->expression)
+		: _lowerFunctionCall(lowering, assignment->functionCall, false);
+	_emit(lowering, _instruction(IR_STORE, IR_VOID, variable, value, none));
+}
+
+/**
+ * Lowers a statement, in stages (as the generator did): each time a nested
+ * block must be lowered, it sets that block, and the next stage starts after
+ * it. Returns true when the statement is complete.
+ */
+static boolean _lowerStatement(Lowering * lowering, Statement * statement, const uint32_t stage, StatementIndex * block) {
+	const IrOperand none = { .kind = IR_NO_OPERAND, .type = IR_VOID };
+	switch (statement->type) {
+		case IF_STATEMENT: {
+			IfStatement * ifStatement = &statement->ifStatement;
+			if (stage == 0) {
+				const IrOperand condition = _lowerExpression(lowering, ifStatement->condition);
+				_emit(lowering, _instruction(IR_IF, IR_VOID, IR_NO_VARIABLE, condition, none));
+				*block = ifStatement->blockIf;
+				return false;
+			}
+			if (stage == 1 && ifStatement->type == IF_ELSE_TYPE) {
+				_emit(lowering, _instruction(IR_ELSE, IR_VOID, IR_NO_VARIABLE, none, none));
+				*block = ifStatement->blockElse;
+				return false;
+			}
+			_emit(lowering, _instruction(IR_END_IF, IR_VOID, IR_NO_VARIABLE, none, none));
+			return true;
+		}
+		case FOR_STATEMENT: {
+			ForStatement * forStatement = &statement->forStatement;
+			if (stage == 0) {
+				const IrOperand from = _lowerExpression(lowering, forStatement->range.expressionLeft);
+				const IrOperand to = _lowerExpression(lowering, forStatement->range.expressionRight);
+				// The loop variable lives in the scope of the block.
+				symbolTableEnterScope(lowering->symbolTable);
+				const IrVariableIndex variable = _declare(lowering, forStatement->varName, IR_INTEGER);
+				_emit(lowering, _instruction(IR_FOR, IR_VOID, variable, from, to));
+				*block = forStatement->block;
+				return false;
+			}
+			_emit(lowering, _instruction(IR_END_FOR, IR_VOID, IR_NO_VARIABLE, none, none));
+			return true;
+		}
+		case FUNCTION_CALL_STATEMENT:
+			_lowerFunctionCall(lowering, statement->functionCall, true);
+			return true;
+		case DECLARATION_STATEMENT: {
+			Declaration * declaration = &statement->declaration;
+			const IrVariableIndex variable = _declare(lowering, declaration->assignment.varName, _declarationType(declaration->type));
+			_emit(lowering, _instruction(IR_DECLARE, IR_VOID, variable, none, none));
+			if (declaration->hasAssignment) {
+				_lowerAssignment(lowering, variable, &declaration->assignment);
+			}
+			return true;
+		}
+		case ASSIGNMENT_STATEMENT:
+			_lowerAssignment(lowering, _resolve(lowering, statement->assignment.varName), &statement->assignment);
+			return true;
+		case ITERATE_STATEMENT: {
+			IterateStatement * iterateStatement = &statement->iterateStatement;
+			const IrOpcode opcode = iterateStatement->type == INORDER
+				? IR_INORDER
+				: iterateStatement->type == PREORDER ? IR_PREORDER : IR_POSTORDER;
+			_emit(lowering, _instruction(opcode, IR_VOID, _resolve(lowering, iterateStatement->varName), none, none));
+			return true;
+		}
+		default:
+			logError(_logger, "Unknown statement type: %d", statement->type);
+			lowering->succeed = false;
+			return true;
+	}
+}
+
+/**
+ * Lowers the program in order, with a scope per block. The blocks are pushed
+ * to an explicit stack, so any depth of nesting is supported.
+ */
+static void _lowerProgram(Lowering * lowering) {
+	AbstractSyntaxTree * abstractSyntaxTree = lowering->abstractSyntaxTree;
+	NodeStack nodeStack;
+	initializeNodeStack(&nodeStack);
+	lowering->succeed = pushNodeFrame(&nodeStack, abstractSyntaxTree->program, 0);
+	while (lowering->succeed && !isNodeStackEmpty(&nodeStack)) {
+		NodeFrame * frame = peekNodeFrame(&nodeStack);
+		if (frame->index == NO_NODE) {
+			popNodeFrame(&nodeStack);
+			if (!isNodeStackEmpty(&nodeStack)) {
+				symbolTableExitScope(lowering->symbolTable);
+			}
+			continue;
+		}
+		Statement * statement = &abstractSyntaxTree->statements[frame->index];
+		StatementIndex block = NO_NODE;
+		if (_lowerStatement(lowering, statement, frame->stage++, &block)) {
+			frame->index = statement->next;
+			frame->stage = 0;
+			continue;
+		}
+		// A loop opens the scope of its block itself, to declare its variable.
+		if (statement->type != FOR_STATEMENT) {
+			symbolTableEnterScope(lowering->symbolTable);
+		}
+		lowering->succeed = lowering->succeed && pushNodeFrame(&nodeStack, block, 0);
+	}
+	finalizeNodeStack(&nodeStack);
+}
+
+/* PUBLIC FUNCTIONS */
+
+IntermediateRepresentation * lowerAbstractSyntaxTree(AbstractSyntaxTree * abstractSyntaxTree, Arena * arena) {
+	Lowering lowering = {
+		.abstractSyntaxTree = abstractSyntaxTree,
+		.intermediateRepresentation = createIntermediateRepresentation(),
+		.arena = arena,
+		.symbolTable = symbolTableInit(),
+		.operands = NULL,
+		.operandCount = 0,
+		.operandCapacity = 0,
+		.text = NULL,
+		.textLength = 0,
+		.textCapacity = 0,
+		.succeed = true
+	};
+	initializeNodeStack(&lowering.expressions);
+	if (lowering.intermediateRepresentation != NULL && lowering.symbolTable != NULL) {
+		_lowerProgram(&lowering);
+	}
+	else {
+		lowering.succeed = false;
+	}
+	if (!lowering.succeed) {
+		logError(_logger, "The AST cannot be lowered into the IR.");
+		destroyIntermediateRepresentation(lowering.intermediateRepresentation);
+		lowering.intermediateRepresentation = NULL;
+	}
+	finalizeNodeStack(&lowering.expressions);
+	if (lowering.symbolTable != NULL) {
+		symbolTableDestroy(lowering.symbolTable);
+	}
+	free(lowering.operands);
+	free(lowering.text);
+	return lowering.intermediateRepresentation;
+}
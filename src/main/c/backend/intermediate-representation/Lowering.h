@@ -0,0 +1,27 @@
+#ifndef LOWERING_HEADER
+#define LOWERING_HEADER
+
+#include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../shared/Arena.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "../semantic-analysis/symbolTable.h"
+#include "IntermediateRepresentation.h"
+
+/** Initialize module's internal state. */
+void initializeLoweringModule();
+
+/** Shutdown module's internal state. */
+void shutdownLoweringModule();
+
+/**
+ * Lowers a checked AST (already folded and pruned) into a new IR. Every
+ * declaration (and loop) gets its own variable, resolved with a scope per
+ * block, as the parser does. The argument of a "calculate" becomes a string,
+ * allocated in the arena, since the expression tree parses it at runtime.
+ *
+ * Returns NULL if there is no memory left.
+ */
+IntermediateRepresentation * lowerAbstractSyntaxTree(AbstractSyntaxTree * abstractSyntaxTree, Arena * arena);
+
+#endif
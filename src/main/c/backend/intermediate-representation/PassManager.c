@@ -0,0 +1,56 @@
+#include "PassManager.h"
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializePassManagerModule() {
+	_logger = createLogger("PassManager");
+}
+
+void shutdownPassManagerModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * A pass over the IR, which rewrites it in place. Returns false if there is no
+ * memory left.
+ */
+typedef struct {
+	const char * name;
+	boolean (*run)(IntermediateRepresentation * intermediateRepresentation);
+} Pass;
+
+// The passes, in the order they run: the loops are fused before they are
+// unrolled, and the insertions left in loops are done in bulk at the end.
+static const Pass _passes[] = {
+	{ "loop-fusion", fuseLoops },
+	{ "loop-unrolling", unrollLoops },
+	{ "bound-hoisting", hoistLoopBounds },
+	{ "bulk-insertion", insertInBulk }
+};
+
+/* PUBLIC FUNCTIONS */
+
+boolean runPasses(IntermediateRepresentation * intermediateRepresentation) {
+	if (!verifyIntermediateRepresentation(intermediateRepresentation)) {
+		logCritical(_logger, "The lowering leaves an invalid IR.");
+		return false;
+	}
+	for (size_t k = 0; k < sizeof(_passes) / sizeof(Pass); ++k) {
+		const uint32_t count = intermediateRepresentation->instructionCount;
+		if (!_passes[k].run(intermediateRepresentation)) {
+			logCritical(_logger, "The pass \"%s\" runs out of memory.", _passes[k].name);
+			return false;
+		}
+		if (!verifyIntermediateRepresentation(intermediateRepresentation)) {
+			logCritical(_logger, "The pass \"%s\" leaves an invalid IR.", _passes[k].name);
+			return false;
+		}
+		logDebugging(_logger, "The pass \"%s\" is done (from %u to %u instruction(s)).",
+			_passes[k].name, count, intermediateRepresentation->instructionCount);
+	}
+	return true;
+}
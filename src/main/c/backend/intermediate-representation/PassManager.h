@@ -0,0 +1,25 @@
+#ifndef PASS_MANAGER_HEADER
+#define PASS_MANAGER_HEADER
+
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "../optimization/BulkInsertion.h"
+#include "../optimization/LoopOptimization.h"
+#include "IntermediateRepresentation.h"
+
+/** Initialize module's internal state. */
+void initializePassManagerModule();
+
+/** Shutdown module's internal state. */
+void shutdownPassManagerModule();
+
+/**
+ * Runs every pass over the IR, in order, and verifies the IR before the first
+ * one and after each of them, so a pass never sees the mistakes of another.
+ * Each pass is enabled (or disabled) by its own environment variable.
+ *
+ * Returns false if a pass runs out of memory, or leaves an invalid IR.
+ */
+boolean runPasses(IntermediateRepresentation * intermediateRepresentation);
+
+#endif
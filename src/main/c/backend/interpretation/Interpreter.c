@@ -0,0 +1,507 @@
+#include "Interpreter.h"
+
+/* MODULE INTERNAL STATE */
+
+static const char * _arithmeticException = "java.lang.ArithmeticException: / by zero";
+static const char * _outOfMemoryError = "java.lang.OutOfMemoryError";
+static const char * _visualizationDirectory = "dots";
+static Logger * _logger = NULL;
+
+void initializeInterpreterModule() {
+	_logger = createLogger("Interpreter");
+}
+
+void shutdownInterpreterModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * The value of a variable: an integer (or a boolean), a tree, or a list.
+ */
+typedef struct {
+	int value;
+	NativeTree * tree;
+	int * elements;
+	uint32_t elementCount;
+	uint32_t elementCapacity;
+} Slot;
+
+typedef struct {
+	IntermediateRepresentation * intermediateRepresentation;
+	FILE * output;
+	Slot * slots;
+
+	// The marker that closes each block marker (i.e., the "IR_ELSE" or the
+	// "IR_END_IF" of an "IR_IF"), and the "IR_FOR" of each "IR_END_FOR".
+	IrInstructionIndex * matches;
+
+	// The pending values of the expression being evaluated.
+	int * values;
+	uint32_t valueCount;
+	uint32_t valueCapacity;
+	NodeStack nodeStack;
+
+	// The exception thrown by the program, if any.
+	const char * exception;
+
+	// The amount of trees visualized so far.
+	unsigned int visualizations;
+} Interpreter;
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _prepare(Interpreter * interpreter);
+static boolean _isValue(const Interpreter * interpreter, const IrOperand * operand);
+static boolean _pushValue(Interpreter * interpreter, const int value);
+static boolean _pushOperand(Interpreter * interpreter, const IrOperand * operand);
+static boolean _compute(Interpreter * interpreter, const IrOpcode opcode, const int left, const int right);
+static boolean _evaluate(Interpreter * interpreter, const IrOperand * operand, int * value);
+static boolean _visualize(Interpreter * interpreter, NativeTree * tree);
+static boolean _append(Interpreter * interpreter, Slot * list, const int element);
+static boolean _call(Interpreter * interpreter, const IrInstruction * instruction, const int argument, int * result);
+static boolean _declare(Interpreter * interpreter, const IrVariableIndex variable);
+static boolean _iterates(Interpreter * interpreter, const IrInstruction * loop, boolean * iterates);
+
+/**
+ * Matches the markers of every block in a single pass, and checks that every
+ * operation (and store) only operates on values: the runtime has no operators
+ * for whole trees (e.g., "tree1 + tree2" has no Java counterpart). Returns
+ * false if the program cannot run, or there is no memory left.
+ */
+static boolean _prepare(Interpreter * interpreter) {
+	const IntermediateRepresentation * intermediateRepresentation = interpreter->intermediateRepresentation;
+	IrInstructionIndex * openings = malloc((intermediateRepresentation->instructionCount + 1) * sizeof(IrInstructionIndex));
+	if (openings == NULL) {
+		logCritical(_logger, "Cannot allocate the blocks of a program of %u instruction(s).", intermediateRepresentation->instructionCount);
+		interpreter->exception = _outOfMemoryError;
+		return false;
+	}
+	uint32_t count = 0;
+	for (IrInstructionIndex k = 0; k < intermediateRepresentation->instructionCount; ++k) {
+		const IrInstruction * instruction = &intermediateRepresentation->instructions[k];
+		if (isIrOperation(instruction->opcode) || instruction->opcode == IR_STORE) {
+			for (unsigned int operand = 0; operand < 2; ++operand) {
+				const IrOperand * irOperand = &instruction->operands[operand];
+				if (irOperand->kind == IR_VARIABLE_OPERAND && !_isValue(interpreter, irOperand)) {
+					logError(_logger, "The program cannot run, since it operates on a whole tree: \"%s\" (%s)",
+						intermediateRepresentation->variables[irOperand->variable].name, irOpcodeName(instruction->opcode));
+					free(openings);
+					return false;
+				}
+			}
+		}
+		switch (instruction->opcode) {
+			case IR_IF:
+			case IR_FOR:
+				openings[count++] = k;
+				break;
+			case IR_ELSE:
+				interpreter->matches[openings[count - 1]] = k;
+				openings[count - 1] = k;
+				break;
+			case IR_END_IF:
+				interpreter->matches[openings[--count]] = k;
+				break;
+			case IR_END_FOR:
+				interpreter->matches[openings[count - 1]] = k;
+				interpreter->matches[k] = openings[--count];
+				break;
+			default:
+				break;
+		}
+	}
+	free(openings);
+	return true;
+}
+
+/**
+ * Returns true if the operand has an integer (or boolean) value, that is, if
+ * it's not a string, a list, nor missing.
+ */
+static boolean _isValue(const Interpreter * interpreter, const IrOperand * operand) {
+	switch (operand->kind) {
+		case IR_CONSTANT_OPERAND:
+		case IR_TEMPORARY_OPERAND:
+			return true;
+		case IR_VARIABLE_OPERAND: {
+			const IrType type = interpreter->intermediateRepresentation->variables[operand->variable].type;
+			return type == IR_INTEGER || type == IR_BOOLEAN;
+		}
+		default:
+			return false;
+	}
+}
+
+/**
+ * Pushes a pending value. Returns false if there is no memory left.
+ */
+static boolean _pushValue(Interpreter * interpreter, const int value) {
+	if (interpreter->valueCount == interpreter->valueCapacity) {
+		const uint32_t capacity = interpreter->valueCapacity == 0 ? 64 : 2 * interpreter->valueCapacity;
+		int * values = realloc(interpreter->values, capacity * sizeof(int));
+		if (values == NULL) {
+			logCritical(_logger, "Cannot allocate a stack of %u value(s).", capacity);
+			return false;
+		}
+		interpreter->values = values;
+		interpreter->valueCapacity = capacity;
+	}
+	interpreter->values[interpreter->valueCount++] = value;
+	return true;
+}
+
+/**
+ * Evaluates an operand, within "_evaluate": a temporary is pushed to the
+ * stack, and the value of an atom is pushed at once (a string, or a list, has
+ * none). Returns false if there is no memory left.
+ */
+static boolean _pushOperand(Interpreter * interpreter, const IrOperand * operand) {
+	if (operand->kind == IR_TEMPORARY_OPERAND) {
+		return pushNodeFrame(&interpreter->nodeStack, operand->temporary, 0);
+	}
+	if (!_isValue(interpreter, operand)) {
+		return true;
+	}
+	if (operand->kind == IR_CONSTANT_OPERAND) {
+		return _pushValue(interpreter, operand->constant);
+	}
+	return _pushValue(interpreter, interpreter->slots[operand->variable].value);
+}
+
+/**
+ * Computes a binary operation, and pushes its value. The arithmetic wraps
+ * around on overflow, as in Java. Returns false if it throws (or if there is
+ * no memory left).
+ */
+static boolean _compute(Interpreter * interpreter, const IrOpcode opcode, const int left, const int right) {
+	if ((opcode == IR_DIVIDE || opcode == IR_MODULO) && right == 0) {
+		interpreter->exception = _arithmeticException;
+		return false;
+	}
+	int value = 0;
+	switch (opcode) {
+		case IR_ADD: value = add(left, right).value; break;
+		case IR_SUBTRACT: value = subtract(left, right).value; break;
+		case IR_MULTIPLY: value = multiply(left, right).value; break;
+		case IR_DIVIDE: value = divide(left, right).value; break;
+		case IR_MODULO: value = modulo(left, right).value; break;
+		case IR_EQUAL: value = left == right; break;
+		case IR_NOT_EQUAL: value = left != right; break;
+		case IR_LESS: value = left < right; break;
+		case IR_LESS_EQUAL: value = left <= right; break;
+		case IR_GREATER: value = left > right; break;
+		case IR_GREATER_EQUAL: value = left >= right; break;
+		default:
+			logError(_logger, "Unknown operation: %s", irOpcodeName(opcode));
+			break;
+	}
+	return _pushValue(interpreter, value);
+}
+
+/**
+ * Evaluates an operand: every temporary is evaluated from the instruction that
+ * defines it, in post-order, so "&&" and "||" short-circuit, and the queries
+ * run in the order of the generated expression. Returns false if it throws.
+ */
+static boolean _evaluate(Interpreter * interpreter, const IrOperand * operand, int * value) {
+	const IrInstruction * instructions = interpreter->intermediateRepresentation->instructions;
+	NodeStack * nodeStack = &interpreter->nodeStack;
+	interpreter->valueCount = 0;
+	boolean succeed = _pushOperand(interpreter, operand);
+	while (succeed && !isNodeStackEmpty(nodeStack)) {
+		NodeFrame * frame = peekNodeFrame(nodeStack);
+		const IrInstruction * instruction = &instructions[frame->index];
+		const uint32_t stage = frame->stage++;
+		const IrOpcode opcode = instruction->opcode;
+		const boolean logical = opcode == IR_AND || opcode == IR_OR;
+		if (stage == 0) {
+			succeed = _pushOperand(interpreter, &instruction->operands[0]);
+		}
+		else if (stage == 1 && !isIrOperation(opcode)) {
+			const int argument = _isValue(interpreter, &instruction->operands[0])
+				? interpreter->values[--interpreter->valueCount]
+				: 0;
+			int result = 0;
+			succeed = _call(interpreter, instruction, argument, &result) && _pushValue(interpreter, result);
+			popNodeFrame(nodeStack);
+		}
+		else if (stage == 1 && opcode == IR_NOT) {
+			interpreter->values[interpreter->valueCount - 1] = !interpreter->values[interpreter->valueCount - 1];
+			popNodeFrame(nodeStack);
+		}
+		else if (stage == 1 && logical && interpreter->values[interpreter->valueCount - 1] == (opcode == IR_OR)) {
+			// The left operand is the value of the short-circuit.
+			popNodeFrame(nodeStack);
+		}
+		else if (stage == 1) {
+			if (logical) {
+				--interpreter->valueCount;
+			}
+			succeed = _pushOperand(interpreter, &instruction->operands[1]);
+		}
+		else {
+			// The right operand is the value of a logical operation.
+			if (!logical) {
+				const int right = interpreter->values[--interpreter->valueCount];
+				const int left = interpreter->values[--interpreter->valueCount];
+				succeed = _compute(interpreter, opcode, left, right);
+			}
+			popNodeFrame(nodeStack);
+		}
+	}
+	while (!isNodeStackEmpty(nodeStack)) {
+		popNodeFrame(nodeStack);
+	}
+	if (!succeed) {
+		if (interpreter->exception == NULL) {
+			interpreter->exception = _outOfMemoryError;
+		}
+		return false;
+	}
+	*value = interpreter->values[--interpreter->valueCount];
+	return true;
+}
+
+/**
+ * Writes the graph of a tree to the next file of the visualizations. Returns
+ * false if it cannot be written (as the runtime would throw).
+ */
+static boolean _visualize(Interpreter * interpreter, NativeTree * tree) {
+	char path[64];
+	sprintf(path, "%s/%u.dot", _visualizationDirectory, interpreter->visualizations);
+#if defined(_WIN32)
+	mkdir(_visualizationDirectory);
+#else
+	mkdir(_visualizationDirectory, 0777);
+#endif
+	FILE * file = fopen(path, "w");
+	if (file == NULL) {
+		logError(_logger, "The graph of the tree cannot be written: \"%s\"", path);
+		interpreter->exception = "java.io.IOException";
+		return false;
+	}
+	const NativeTreeResult result = visualizeNativeTree(tree, file);
+	fclose(file);
+	if (result.exception != NULL) {
+		interpreter->exception = result.exception;
+		return false;
+	}
+	++interpreter->visualizations;
+	return true;
+}
+
+/**
+ * Appends an element to a list. Returns false if there is no memory left.
+ */
+static boolean _append(Interpreter * interpreter, Slot * list, const int element) {
+	if (list->elementCount == list->elementCapacity) {
+		const uint32_t capacity = list->elementCapacity == 0 ? 64 : 2 * list->elementCapacity;
+		int * elements = realloc(list->elements, capacity * sizeof(int));
+		if (elements == NULL) {
+			logCritical(_logger, "Cannot allocate a list of %u element(s).", capacity);
+			interpreter->exception = _outOfMemoryError;
+			return false;
+		}
+		list->elements = elements;
+		list->elementCapacity = capacity;
+	}
+	list->elements[list->elementCount++] = element;
+	return true;
+}
+
+/**
+ * Calls a method of a tree (or list), with the value of its argument (if it
+ * has one). Returns false if it throws.
+ */
+static boolean _call(Interpreter * interpreter, const IrInstruction * instruction, const int argument, int * result) {
+	Slot * slot = &interpreter->slots[instruction->variable];
+	FILE * output = interpreter->output;
+	NativeTreeResult nativeTreeResult = { .exception = NULL, .value = 0 };
+	switch (instruction->opcode) {
+		case IR_INSERT:
+			nativeTreeResult = insertIntoNativeTree(slot->tree, argument);
+			break;
+		case IR_INSERT_ALL: {
+			const Slot * list = &interpreter->slots[instruction->operands[0].variable];
+			nativeTreeResult = insertAllIntoNativeTree(slot->tree, list->elements, list->elementCount);
+			break;
+		}
+		case IR_REMOVE:
+			nativeTreeResult = removeFromNativeTree(slot->tree, argument, output);
+			break;
+		case IR_INCLUDES:
+			nativeTreeResult = nativeTreeIncludes(slot->tree, argument);
+			break;
+		case IR_HEIGHT:
+			nativeTreeResult = nativeTreeHeight(slot->tree);
+			break;
+		case IR_DEPTH:
+			nativeTreeResult = nativeTreeDepth(slot->tree, argument, output);
+			break;
+		case IR_CALCULATE:
+			nativeTreeResult = calculateWithNativeTree(slot->tree, instruction->operands[0].string);
+			break;
+		case IR_VISUALIZE:
+			return _visualize(interpreter, slot->tree);
+		case IR_INORDER:
+			nativeTreeResult = traverseNativeTree(slot->tree, NATIVE_INORDER, output);
+			break;
+		case IR_PREORDER:
+			nativeTreeResult = traverseNativeTree(slot->tree, NATIVE_PREORDER, output);
+			break;
+		case IR_POSTORDER:
+			nativeTreeResult = traverseNativeTree(slot->tree, NATIVE_POSTORDER, output);
+			break;
+		case IR_APPEND:
+			return _append(interpreter, slot, argument);
+		default:
+			logError(_logger, "Unknown instruction: %s", irOpcodeName(instruction->opcode));
+			nativeTreeResult.exception = "java.lang.UnsupportedOperationException";
+			break;
+	}
+	if (nativeTreeResult.exception != NULL) {
+		interpreter->exception = nativeTreeResult.exception;
+		return false;
+	}
+	*result = nativeTreeResult.value;
+	return true;
+}
+
+/**
+ * Declares a variable: a tree starts empty (and the previous one, of an
+ * earlier iteration, is released), as does a list.
+ */
+static boolean _declare(Interpreter * interpreter, const IrVariableIndex variable) {
+	Slot * slot = &interpreter->slots[variable];
+	NativeTreeType type;
+	switch (interpreter->intermediateRepresentation->variables[variable].type) {
+		case IR_AVL_TREE: type = NATIVE_AVL_TREE; break;
+		case IR_BST_TREE: type = NATIVE_BST_TREE; break;
+		case IR_RBT_TREE: type = NATIVE_RBT_TREE; break;
+		case IR_EXP_TREE: type = NATIVE_EXP_TREE; break;
+		case IR_LIST:
+			slot->elementCount = 0;
+			return true;
+		default:
+			slot->value = 0;
+			return true;
+	}
+	destroyNativeTree(slot->tree);
+	slot->tree = createNativeTree(type);
+	if (slot->tree == NULL) {
+		interpreter->exception = _outOfMemoryError;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Evaluates the end of the range of a loop, and decides whether the loop runs
+ * another iteration. Returns false if it throws.
+ */
+static boolean _iterates(Interpreter * interpreter, const IrInstruction * loop, boolean * iterates) {
+	int end = 0;
+	if (!_evaluate(interpreter, &loop->operands[1], &end)) {
+		return false;
+	}
+	*iterates = interpreter->slots[loop->variable].value < end;
+	return true;
+}
+
+/* PUBLIC FUNCTIONS */
+
+boolean interpret(IntermediateRepresentation * intermediateRepresentation, FILE * output) {
+	const uint32_t count = intermediateRepresentation->instructionCount;
+	Interpreter interpreter = {
+		.intermediateRepresentation = intermediateRepresentation,
+		.output = output,
+		.slots = calloc(intermediateRepresentation->variableCount + 1, sizeof(Slot)),
+		.matches = calloc(count + 1, sizeof(IrInstructionIndex)),
+		.values = NULL,
+		.valueCount = 0,
+		.valueCapacity = 0,
+		.exception = NULL,
+		.visualizations = 0
+	};
+	initializeNodeStack(&interpreter.nodeStack);
+	boolean prepared = false;
+	if (interpreter.slots == NULL || interpreter.matches == NULL) {
+		logCritical(_logger, "Cannot allocate the state of a program of %u instruction(s).", count);
+		interpreter.exception = _outOfMemoryError;
+	}
+	else {
+		prepared = _prepare(&interpreter);
+	}
+	IrInstructionIndex k = 0;
+	while (prepared && interpreter.exception == NULL && k < count) {
+		const IrInstruction * instruction = &intermediateRepresentation->instructions[k];
+		if (instruction->type != IR_VOID) {
+			++k;
+			continue;
+		}
+		int value = 0;
+		boolean condition = false;
+		switch (instruction->opcode) {
+			case IR_DECLARE:
+				_declare(&interpreter, instruction->variable);
+				++k;
+				break;
+			case IR_STORE:
+				if (_evaluate(&interpreter, &instruction->operands[0], &value)) {
+					interpreter.slots[instruction->variable].value = value;
+				}
+				++k;
+				break;
+			case IR_IF:
+				if (_evaluate(&interpreter, &instruction->operands[0], &value)) {
+					k = value ? k + 1 : interpreter.matches[k] + 1;
+				}
+				break;
+			case IR_ELSE:
+				k = interpreter.matches[k] + 1;
+				break;
+			case IR_FOR:
+				if (_evaluate(&interpreter, &instruction->operands[0], &value)) {
+					interpreter.slots[instruction->variable].value = value;
+					if (_iterates(&interpreter, instruction, &condition)) {
+						k = condition ? k + 1 : interpreter.matches[k] + 1;
+					}
+				}
+				break;
+			case IR_END_FOR: {
+				const IrInstructionIndex loop = interpreter.matches[k];
+				const IrInstruction * loopInstruction = &intermediateRepresentation->instructions[loop];
+				Slot * slot = &interpreter.slots[loopInstruction->variable];
+				slot->value = add(slot->value, 1).value;
+				if (_iterates(&interpreter, loopInstruction, &condition)) {
+					k = condition ? loop + 1 : k + 1;
+				}
+				break;
+			}
+			case IR_END_IF:
+				++k;
+				break;
+			default:
+				if (!_isValue(&interpreter, &instruction->operands[0]) || _evaluate(&interpreter, &instruction->operands[0], &value)) {
+					_call(&interpreter, instruction, value, &value);
+				}
+				++k;
+				break;
+		}
+	}
+	fflush(output);
+	if (interpreter.exception != NULL) {
+		logError(_logger, "Exception in thread \"main\" %s", interpreter.exception);
+	}
+	for (IrVariableIndex v = 0; interpreter.slots != NULL && v < intermediateRepresentation->variableCount; ++v) {
+		destroyNativeTree(interpreter.slots[v].tree);
+		free(interpreter.slots[v].elements);
+	}
+	finalizeNodeStack(&interpreter.nodeStack);
+	free(interpreter.values);
+	free(interpreter.matches);
+	free(interpreter.slots);
+	return prepared && interpreter.exception == NULL;
+}
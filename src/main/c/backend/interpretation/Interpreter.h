@@ -0,0 +1,34 @@
+#ifndef INTERPRETER_HEADER
+#define INTERPRETER_HEADER
+
+#include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "../domain-specific/Calculator.h"
+#include "../domain-specific/NativeTree.h"
+#include "../intermediate-representation/IntermediateRepresentation.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+/** Initialize module's internal state. */
+void initializeInterpreterModule();
+
+/** Shutdown module's internal state. */
+void shutdownInterpreterModule();
+
+/**
+ * Runs the program of the IR, with the native trees, instead of generating
+ * Java: it writes to the output what the generated class would print, and
+ * each visualized tree to "dots/<n>.dot". The statements run in order, and
+ * every temporary is evaluated where it's used (as the generated expressions
+ * are), with an explicit stack.
+ *
+ * Returns false if the program throws an exception (which is logged, as the
+ * JVM would), if it operates on a whole tree (e.g., "c = a + b", whose class
+ * would not compile), or if there is no memory left.
+ */
+boolean interpret(IntermediateRepresentation * intermediateRepresentation, FILE * output);
+
+#endif
@@ -0,0 +1,283 @@
+#include "BulkInsertion.h"
+
+/* MODULE INTERNAL STATE */
+
+static boolean _bulkInsertion = true;
+static Logger * _logger = NULL;
+
+void initializeBulkInsertionModule() {
+	_bulkInsertion = getBooleanOrDefault("BULK_INSERTION", _bulkInsertion);
+	_logger = createLogger("BulkInsertion");
+}
+
+void shutdownBulkInsertionModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+typedef struct {
+	IntermediateRepresentation * intermediateRepresentation;
+
+	// The previous version of the instructions.
+	IrInstruction * instructions;
+	uint32_t count;
+
+	// The new name of each previous temporary.
+	IrInstructionIndex * renames;
+
+	// The list of each tree in the loop being rewritten, or IR_NO_VARIABLE.
+	IrVariableIndex * lists;
+
+	// Whether the shape of each tree may be observed (see "_observeShapes").
+	boolean * observed;
+
+	// The insertions turned into bulk insertions.
+	uint32_t insertions;
+} Batching;
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _observesShape(const IrOpcode opcode);
+static void _observeShapes(Batching * batching);
+static boolean _isPureInsertion(Batching * batching, const IrInstructionIndex start, const IrInstructionIndex end);
+static IrInstructionIndex _runEnd(Batching * batching, const IrInstructionIndex end);
+static boolean _isInsertionLoop(Batching * batching, const IrInstructionIndex loop);
+static IrVariableIndex _declareList(Batching * batching);
+static void _append(Batching * batching, const IrInstructionIndex start, const IrInstructionIndex end, const IrVariableIndex list);
+static void _insertAll(Batching * batching, const IrVariableIndex tree, const IrVariableIndex list);
+static void _rewriteRun(Batching * batching, const IrInstructionIndex start, const IrInstructionIndex last);
+static void _rewriteLoop(Batching * batching, const IrInstructionIndex start, const IrInstructionIndex loop);
+
+/**
+ * Returns true if the operation may observe the shape of its tree, which a bulk
+ * insertion changes: a balanced tree built at once is not the one built by
+ * inserting its elements one by one (e.g., the AVL of 1, 2, 3 and 4 is "2 1 3
+ * 4" in pre-order, but "3 2 1 4" if it's built at once). The insertions, the
+ * in-order traversal and the inclusion (which throws for a missing element of
+ * an RBT anyway) do not, but a removal may throw as a rotation does.
+ */
+static boolean _observesShape(const IrOpcode opcode) {
+	switch (opcode) {
+		case IR_REMOVE:
+		case IR_HEIGHT:
+		case IR_DEPTH:
+		case IR_CALCULATE:
+		case IR_VISUALIZE:
+		case IR_PREORDER:
+		case IR_POSTORDER:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/**
+ * Records the trees whose shape may be observed, anywhere in the program: by
+ * an operation, or as the operand of another one (which copies it).
+ */
+static void _observeShapes(Batching * batching) {
+	for (IrInstructionIndex k = 0; k < batching->count; ++k) {
+		const IrInstruction * instruction = &batching->instructions[k];
+		if (_observesShape(instruction->opcode)) {
+			batching->observed[instruction->variable] = true;
+		}
+		for (uint32_t o = 0; o < 2; ++o) {
+			if (instruction->operands[o].kind == IR_VARIABLE_OPERAND) {
+				batching->observed[instruction->operands[o].variable] = true;
+			}
+		}
+	}
+}
+
+/**
+ * Returns true if the statement [start, end] is an insertion whose operand is
+ * computed by operations only, into a tree whose shape is never observed.
+ */
+static boolean _isPureInsertion(Batching * batching, const IrInstructionIndex start, const IrInstructionIndex end) {
+	if (batching->count <= end || batching->instructions[end].opcode != IR_INSERT || batching->observed[batching->instructions[end].variable]) {
+		return false;
+	}
+	for (IrInstructionIndex k = start; k < end; ++k) {
+		if (!isIrOperation(batching->instructions[k].opcode)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Returns the last insertion of the run that starts with the specified one
+ * (which is the run itself, if the next statement inserts into another tree).
+ */
+static IrInstructionIndex _runEnd(Batching * batching, const IrInstructionIndex end) {
+	IrInstructionIndex last = end;
+	while (last + 1 < batching->count) {
+		const IrInstructionIndex next = irStatementEnd(batching->instructions, batching->count, last + 1);
+		if (!_isPureInsertion(batching, last + 1, next) || batching->instructions[next].variable != batching->instructions[end].variable) {
+			break;
+		}
+		last = next;
+	}
+	return last;
+}
+
+/**
+ * Returns true if the body of the loop only inserts into trees. The body is
+ * scanned up to its first statement that is not an insertion, which must be
+ * the end of the loop.
+ */
+static boolean _isInsertionLoop(Batching * batching, const IrInstructionIndex loop) {
+	IrInstructionIndex k = loop + 1;
+	while (k < batching->count) {
+		const IrInstructionIndex end = irStatementEnd(batching->instructions, batching->count, k);
+		if (!_isPureInsertion(batching, k, end)) {
+			break;
+		}
+		k = end + 1;
+	}
+	return loop + 1 < k && k < batching->count && batching->instructions[k].opcode == IR_END_FOR;
+}
+
+/**
+ * Declares a new list, for the elements of a tree.
+ */
+static IrVariableIndex _declareList(Batching * batching) {
+	const IrVariable irVariable = {
+		.name = "bulk",
+		.type = IR_LIST,
+		.synthetic = true
+	};
+	const IrVariableIndex list = appendIrVariable(batching->intermediateRepresentation, irVariable);
+	const IrInstruction declaration = {
+		.opcode = IR_DECLARE,
+		.type = IR_VOID,
+		.variable = list,
+		.operands = { { .kind = IR_NO_OPERAND }, { .kind = IR_NO_OPERAND } }
+	};
+	appendIrInstruction(batching->intermediateRepresentation, declaration);
+	return list;
+}
+
+/**
+ * Appends the element of the insertion [start, end] to a list, instead of
+ * inserting it.
+ */
+static void _append(Batching * batching, const IrInstructionIndex start, const IrInstructionIndex end, const IrVariableIndex list) {
+	copyIrInstructions(batching->intermediateRepresentation, batching->instructions, start, end, batching->renames);
+	IrInstruction append = batching->instructions[end];
+	append.opcode = IR_APPEND;
+	append.variable = list;
+	appendRenamedIrInstruction(batching->intermediateRepresentation, append, batching->renames);
+	++batching->insertions;
+}
+
+/**
+ * Inserts every element of a list into a tree.
+ */
+static void _insertAll(Batching * batching, const IrVariableIndex tree, const IrVariableIndex list) {
+	const IrInstruction insertion = {
+		.opcode = IR_INSERT_ALL,
+		.type = IR_VOID,
+		.variable = tree,
+		.operands = {
+			{ .kind = IR_VARIABLE_OPERAND, .type = IR_LIST, .variable = list },
+			{ .kind = IR_NO_OPERAND }
+		}
+	};
+	appendIrInstruction(batching->intermediateRepresentation, insertion);
+}
+
+/**
+ * Rewrites the run of insertions [start, last] into a list, inserted at once.
+ */
+static void _rewriteRun(Batching * batching, const IrInstructionIndex start, const IrInstructionIndex last) {
+	const IrVariableIndex list = _declareList(batching);
+	for (IrInstructionIndex k = start; k <= last; ++k) {
+		const IrInstructionIndex end = irStatementEnd(batching->instructions, batching->count, k);
+		_append(batching, k, end, list);
+		k = end;
+	}
+	_insertAll(batching, batching->instructions[last].variable, list);
+}
+
+/**
+ * Rewrites a loop that only inserts into trees (whose range starts at
+ * "start"), so it appends the elements to a list per tree, declared before the
+ * loop, and inserted after it.
+ */
+static void _rewriteLoop(Batching * batching, const IrInstructionIndex start, const IrInstructionIndex loop) {
+	const IrInstructionIndex loopEnd = irBlockEnd(batching->instructions, batching->count, loop);
+	for (IrInstructionIndex k = loop + 1; k < loopEnd; ++k) {
+		const IrVariableIndex tree = batching->instructions[k].variable;
+		if (batching->instructions[k].opcode == IR_INSERT && batching->lists[tree] == IR_NO_VARIABLE) {
+			batching->lists[tree] = _declareList(batching);
+		}
+	}
+	copyIrInstructions(batching->intermediateRepresentation, batching->instructions, start, loop + 1, batching->renames);
+	for (IrInstructionIndex k = loop + 1; k < loopEnd; ++k) {
+		const IrInstructionIndex end = irStatementEnd(batching->instructions, batching->count, k);
+		_append(batching, k, end, batching->lists[batching->instructions[end].variable]);
+		k = end;
+	}
+	copyIrInstructions(batching->intermediateRepresentation, batching->instructions, loopEnd, loopEnd + 1, batching->renames);
+	for (IrInstructionIndex k = loop + 1; k < loopEnd; ++k) {
+		const IrVariableIndex tree = batching->instructions[k].variable;
+		if (batching->instructions[k].opcode == IR_INSERT && batching->lists[tree] != IR_NO_VARIABLE) {
+			_insertAll(batching, tree, batching->lists[tree]);
+			batching->lists[tree] = IR_NO_VARIABLE;
+		}
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+boolean insertInBulk(IntermediateRepresentation * intermediateRepresentation) {
+	if (!_bulkInsertion) {
+		return true;
+	}
+	Batching batching = {
+		.intermediateRepresentation = intermediateRepresentation,
+		.instructions = NULL,
+		.count = 0,
+		.renames = calloc(intermediateRepresentation->instructionCount + 1, sizeof(IrInstructionIndex)),
+		.lists = malloc((intermediateRepresentation->variableCount + 1) * sizeof(IrVariableIndex)),
+		.observed = calloc(intermediateRepresentation->variableCount + 1, sizeof(boolean)),
+		.insertions = 0
+	};
+	if (batching.renames == NULL || batching.lists == NULL || batching.observed == NULL) {
+		logCritical(_logger, "Cannot allocate the state of the bulk insertion.");
+		free(batching.renames);
+		free(batching.lists);
+		free(batching.observed);
+		return false;
+	}
+	for (IrVariableIndex k = 0; k < intermediateRepresentation->variableCount; ++k) {
+		batching.lists[k] = IR_NO_VARIABLE;
+	}
+	batching.instructions = detachIrInstructions(intermediateRepresentation, &batching.count);
+	_observeShapes(&batching);
+	for (IrInstructionIndex k = 0; k < batching.count && !intermediateRepresentation->exhausted; ++k) {
+		const IrInstructionIndex end = irStatementEnd(batching.instructions, batching.count, k);
+		const IrOpcode opcode = end < batching.count ? batching.instructions[end].opcode : IR_END_FOR;
+		const IrInstructionIndex last = _isPureInsertion(&batching, k, end) ? _runEnd(&batching, end) : end;
+		if (last != end) {
+			_rewriteRun(&batching, k, last);
+			k = last;
+		}
+		else if (opcode == IR_FOR && _isInsertionLoop(&batching, end)) {
+			_rewriteLoop(&batching, k, end);
+			k = irBlockEnd(batching.instructions, batching.count, end);
+		}
+		else {
+			copyIrInstructions(intermediateRepresentation, batching.instructions, k, end < batching.count ? end + 1 : end, batching.renames);
+			k = end;
+		}
+	}
+	logDebugging(_logger, "%u insertion(s) are done in bulk.", batching.insertions);
+	free(batching.instructions);
+	free(batching.renames);
+	free(batching.lists);
+	free(batching.observed);
+	return !intermediateRepresentation->exhausted;
+}
@@ -0,0 +1,32 @@
+#ifndef BULK_INSERTION_HEADER
+#define BULK_INSERTION_HEADER
+
+#include "../../shared/Environment.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "../intermediate-representation/IntermediateRepresentation.h"
+
+/** Initialize module's internal state. */
+void initializeBulkInsertionModule();
+
+/** Shutdown module's internal state. */
+void shutdownBulkInsertionModule();
+
+/**
+ * Turns the insertions that can be done at once into bulk insertions, so the
+ * balanced trees can build themselves in linear time:
+ *
+ *	- A run of consecutive insertions into the same tree.
+ *	- A loop whose body only inserts into trees, whose elements are appended
+ *	  to a list per tree, and inserted after the loop.
+ *
+ * The operands of an insertion cannot query a tree, so no element observes
+ * the tree half-built. A balanced tree built at once has another shape, so
+ * only the trees whose shape is never observed (i.e., they are never removed
+ * from, measured, traversed but in-order, visualized, nor copied) are inserted
+ * in bulk, and the program prints the same. It's disabled with
+ * "BULK_INSERTION=false". Returns false if there is no memory left.
+ */
+boolean insertInBulk(IntermediateRepresentation * intermediateRepresentation);
+
+#endif
@@ -0,0 +1,617 @@
+#include "DeadCodeElimination.h"
+
+/* MODULE INTERNAL STATE */
+
+static boolean _deadCodeElimination = true;
+static Logger * _logger = NULL;
+
+void initializeDeadCodeEliminationModule() {
+	_deadCodeElimination = getBooleanOrDefault("DEAD_CODE_ELIMINATION", _deadCodeElimination);
+	_logger = createLogger("DeadCodeElimination");
+}
+
+void shutdownDeadCodeEliminationModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * What the elimination knows about a statement. Every variable is identified
+ * by the statement that declares it (a declaration, or the "for" of a loop
+ * variable), so the fields of a declaration describe its variable too.
+ */
+typedef struct {
+	// The variables read by the statement itself (not by its blocks), as a
+	// range over the reads of the elimination.
+	uint32_t firstRead;
+	uint32_t readCount;
+
+	// The variable written by the statement, or NO_NODE.
+	StatementIndex target;
+
+	// The next statement that writes the same variable. The list of writes of
+	// a variable starts at its declaration.
+	StatementIndex nextWrite;
+
+	// The "if" (or "for") of the block that holds the statement, or NO_NODE.
+	StatementIndex parent;
+	boolean inElse;
+
+	// The statements still alive in the blocks of an "if" (or "for").
+	uint32_t liveStatements;
+	uint32_t liveElseStatements;
+
+	// The statements still alive that read the variable, and whether it can be
+	// removed once there are none (i.e., every write is free of side-effects).
+	uint32_t readers;
+	boolean removable;
+
+	boolean removed;
+
+	// The negated condition of an "if" whose first block becomes empty.
+	ExpressionIndex negation;
+} StatementInfo;
+
+typedef struct {
+	AbstractSyntaxTree * abstractSyntaxTree;
+	StatementInfo * infos;
+	symbolTableADT symbolTable;
+
+	// The variables read by every statement (see "StatementInfo").
+	StatementIndex * reads;
+	uint32_t readCount;
+	uint32_t readCapacity;
+
+	// The statements to remove.
+	NodeStack pending;
+
+	// A stack for the expressions, reused by every statement.
+	NodeStack expressions;
+} Elimination;
+
+/* PRIVATE FUNCTIONS */
+
+static StatementIndex _resolve(Elimination * elimination, char * varName);
+static boolean _isRedBlackTree(Elimination * elimination, const StatementIndex variable);
+static boolean _addRead(Elimination * elimination, const StatementIndex statement, const StatementIndex variable);
+static boolean _addExpressionReads(Elimination * elimination, const StatementIndex statement, const ExpressionIndex expression);
+static boolean _mayThrow(Elimination * elimination, const ExpressionIndex expression);
+static boolean _addFunctionCallReads(Elimination * elimination, const StatementIndex statement, const FunctionCallIndex index);
+static void _addWrite(Elimination * elimination, const StatementIndex statement, const StatementIndex variable, const boolean pure);
+static void _adoptBlock(Elimination * elimination, const StatementIndex parent, const StatementIndex block, const boolean inElse);
+static boolean _analyzeStatement(Elimination * elimination, const StatementIndex index);
+static boolean _analyze(Elimination * elimination);
+static boolean _removeBlock(Elimination * elimination, const StatementIndex block);
+static boolean _removeVariable(Elimination * elimination, const StatementIndex variable);
+static boolean _seed(Elimination * elimination);
+static boolean _propagate(Elimination * elimination);
+static StatementIndex _firstAlive(Elimination * elimination, StatementIndex index);
+static boolean _negateConditions(Elimination * elimination);
+static void _rewrite(Elimination * elimination);
+
+/**
+ * Returns the declaration of a visible variable, or NO_NODE. Since a program
+ * cannot use a variable before declaring it, the walk of the analysis sees
+ * the same declarations as the parser.
+ */
+static StatementIndex _resolve(Elimination * elimination, char * varName) {
+	struct key key = {
+		.varname = varName
+	};
+	struct value value;
+	return symbolTableFind(elimination->symbolTable, &key, &value) ? value.declaration : NO_NODE;
+}
+
+/**
+ * Returns true if the variable is an RBT, whose removal prints a line if the
+ * element is missing, and whose inclusion throws (since it reaches the
+ * sentinel) if so, so neither is free of side-effects.
+ */
+static boolean _isRedBlackTree(Elimination * elimination, const StatementIndex variable) {
+	if (variable == NO_NODE) {
+		return false;
+	}
+	const Statement * statement = &elimination->abstractSyntaxTree->statements[variable];
+	return statement->type == DECLARATION_STATEMENT && statement->declaration.type == RBT_VAR;
+}
+
+/**
+ * Records that a statement reads a variable. A statement that writes the
+ * variable it reads (e.g., "x = x + 1") doesn't keep it alive.
+ */
+static boolean _addRead(Elimination * elimination, const StatementIndex statement, const StatementIndex variable) {
+	if (variable == NO_NODE || variable == elimination->infos[statement].target) {
+		return true;
+	}
+	if (elimination->readCount == elimination->readCapacity) {
+		const uint32_t capacity = elimination->readCapacity == 0 ? 256 : 2 * elimination->readCapacity;
+		StatementIndex * reads = capacity < elimination->readCapacity ? NULL : realloc(elimination->reads, capacity * sizeof(StatementIndex));
+		if (reads == NULL) {
+			return false;
+		}
+		elimination->reads = reads;
+		elimination->readCapacity = capacity;
+	}
+	elimination->reads[elimination->readCount++] = variable;
+	++elimination->infos[statement].readCount;
+	++elimination->infos[variable].readers;
+	return true;
+}
+
+/**
+ * Records every variable of an expression as read by the statement.
+ */
+static boolean _addExpressionReads(Elimination * elimination, const StatementIndex statement, const ExpressionIndex expression) {
+	if (expression == NO_NODE) {
+		return true;
+	}
+	AbstractSyntaxTree * abstractSyntaxTree = elimination->abstractSyntaxTree;
+	NodeStack * nodeStack = &elimination->expressions;
+	boolean succeed = pushNodeFrame(nodeStack, expression, 0);
+	while (succeed && !isNodeStackEmpty(nodeStack)) {
+		const Expression * node = &abstractSyntaxTree->expressions[popNodeFrame(nodeStack).index];
+		switch (node->type) {
+			case CONSTANT_EXP:
+				break;
+			case VARIABLE_EXP:
+				succeed = _addRead(elimination, statement, _resolve(elimination, node->varName));
+				break;
+			case PARENTHESIZED_EXP:
+				succeed = pushNodeFrame(nodeStack, node->expression, 0);
+				break;
+			case NOT_EXP:
+				succeed = pushNodeFrame(nodeStack, node->leftExpression, 0);
+				break;
+			default:
+				succeed = pushNodeFrame(nodeStack, node->leftExpression, 0)
+					&& pushNodeFrame(nodeStack, node->rightExpression, 0);
+				break;
+		}
+	}
+	// On failure, the stack may still hold frames.
+	finalizeNodeStack(nodeStack);
+	return succeed;
+}
+
+/**
+ * Returns true if the expression may throw, since it divides by (or takes the
+ * modulo of) a divisor that is not a nonzero constant. On failure (i.e., if
+ * there is no memory left), it's assumed to throw.
+ */
+static boolean _mayThrow(Elimination * elimination, const ExpressionIndex expression) {
+	AbstractSyntaxTree * abstractSyntaxTree = elimination->abstractSyntaxTree;
+	NodeStack * nodeStack = &elimination->expressions;
+	boolean succeed = pushNodeFrame(nodeStack, expression, 0);
+	boolean throws = !succeed;
+	while (succeed && !throws && !isNodeStackEmpty(nodeStack)) {
+		const Expression * node = &abstractSyntaxTree->expressions[popNodeFrame(nodeStack).index];
+		switch (node->type) {
+			case CONSTANT_EXP:
+			case VARIABLE_EXP:
+				break;
+			case PARENTHESIZED_EXP:
+				succeed = pushNodeFrame(nodeStack, node->expression, 0);
+				break;
+			case NOT_EXP:
+				succeed = pushNodeFrame(nodeStack, node->leftExpression, 0);
+				break;
+			case DIVISION_EXP:
+			case MODULE_EXP: {
+				const Expression * divisor = &abstractSyntaxTree->expressions[node->rightExpression];
+				while (divisor->type == PARENTHESIZED_EXP) {
+					divisor = &abstractSyntaxTree->expressions[divisor->expression];
+				}
+				throws = divisor->type != CONSTANT_EXP || divisor->constant.intValue == 0;
+				succeed = pushNodeFrame(nodeStack, node->leftExpression, 0)
+					&& pushNodeFrame(nodeStack, node->rightExpression, 0);
+				break;
+			}
+			default:
+				succeed = pushNodeFrame(nodeStack, node->leftExpression, 0)
+					&& pushNodeFrame(nodeStack, node->rightExpression, 0);
+				break;
+		}
+	}
+	finalizeNodeStack(nodeStack);
+	return throws || !succeed;
+}
+
+/**
+ * Records the argument of a function call as read by the statement, and the
+ * tree too, unless the call only modifies it.
+ */
+static boolean _addFunctionCallReads(Elimination * elimination, const StatementIndex statement, const FunctionCallIndex index) {
+	const FunctionCall * functionCall = &elimination->abstractSyntaxTree->functionCalls[index];
+	if (functionCall->type != INSERT_CALL && functionCall->type != REMOVE_CALL) {
+		if (!_addRead(elimination, statement, _resolve(elimination, functionCall->varName))) {
+			return false;
+		}
+	}
+	return _addExpressionReads(elimination, statement, functionCall->expression);
+}
+
+/**
+ * Records that a statement writes a variable. If the statement has other
+ * side-effects (it prints, or modifies a tree), the variable is kept.
+ */
+static void _addWrite(Elimination * elimination, const StatementIndex statement, const StatementIndex variable, const boolean pure) {
+	if (variable == NO_NODE) {
+		return;
+	}
+	StatementInfo * infos = elimination->infos;
+	infos[statement].target = variable;
+	if (statement != variable) {
+		infos[statement].nextWrite = infos[variable].nextWrite;
+		infos[variable].nextWrite = statement;
+	}
+	if (!pure) {
+		infos[variable].removable = false;
+	}
+}
+
+/**
+ * Makes a statement the parent of every statement of one of its blocks.
+ */
+static void _adoptBlock(Elimination * elimination, const StatementIndex parent, const StatementIndex block, const boolean inElse) {
+	for (StatementIndex index = block; index != NO_NODE; index = elimination->abstractSyntaxTree->statements[index].next) {
+		elimination->infos[index].parent = parent;
+		elimination->infos[index].inElse = inElse;
+		if (inElse) {
+			++elimination->infos[parent].liveElseStatements;
+		}
+		else {
+			++elimination->infos[parent].liveStatements;
+		}
+	}
+}
+
+/**
+ * Records the reads and writes of a statement (but not of its blocks), and
+ * declares its variable, if any.
+ */
+static boolean _analyzeStatement(Elimination * elimination, const StatementIndex index) {
+	AbstractSyntaxTree * abstractSyntaxTree = elimination->abstractSyntaxTree;
+	Statement * statement = &abstractSyntaxTree->statements[index];
+	elimination->infos[index].firstRead = elimination->readCount;
+	switch (statement->type) {
+		case IF_STATEMENT:
+			return _addExpressionReads(elimination, index, statement->ifStatement.condition);
+		case FOR_STATEMENT:
+			return _addExpressionReads(elimination, index, statement->forStatement.range.expressionLeft)
+				&& _addExpressionReads(elimination, index, statement->forStatement.range.expressionRight);
+		case FUNCTION_CALL_STATEMENT: {
+			const FunctionCall * functionCall = &abstractSyntaxTree->functionCalls[statement->functionCall];
+			if (functionCall->type == INSERT_CALL || functionCall->type == REMOVE_CALL) {
+				const StatementIndex tree = _resolve(elimination, functionCall->varName);
+				_addWrite(elimination, index, tree, functionCall->type == INSERT_CALL || !_isRedBlackTree(elimination, tree));
+			}
+			return _addFunctionCallReads(elimination, index, statement->functionCall);
+		}
+		case DECLARATION_STATEMENT:
+		case ASSIGNMENT_STATEMENT: {
+			Assignment * assignment = statement->type == DECLARATION_STATEMENT ? &statement->declaration.assignment : &statement->assignment;
+			StatementIndex variable = index;
+			if (statement->type == DECLARATION_STATEMENT) {
+				struct key key = {
+					.varname = assignment->varName
+				};
+				struct value value = {
+					.type = INVALID_VAR,
+					.declaration = index
+				};
+				symbolTableInsert(elimination->symbolTable, &key, &value);
+				elimination->infos[index].removable = statement->declaration.type == CONST_VAR ? false : true;
+			}
+			else {
+				variable = _resolve(elimination, assignment->varName);
+			}
+			if (assignment->functionCall == NO_NODE) {
+				_addWrite(elimination, index, variable, !_mayThrow(elimination, assignment->expression));
+				return _addExpressionReads(elimination, index, assignment->expression);
+			}
+			const FunctionCall * functionCall = &abstractSyntaxTree->functionCalls[assignment->functionCall];
+			const boolean pure = functionCall->type == HEIGHT_CALL || functionCall->type == CALCULATE_CALL
+				|| (functionCall->type == INCLUDES_CALL && !_isRedBlackTree(elimination, _resolve(elimination, functionCall->varName)));
+			_addWrite(elimination, index, variable, pure);
+			return _addFunctionCallReads(elimination, index, assignment->functionCall);
+		}
+		case ITERATE_STATEMENT:
+			return _addRead(elimination, index, _resolve(elimination, statement->iterateStatement.varName));
+		default:
+			return true;
+	}
+}
+
+/**
+ * Walks the program in order, with a scope per block (as the parser does), so
+ * every variable is resolved to its declaration. The blocks are pushed to an
+ * explicit stack, so any depth of nesting is supported.
+ */
+static boolean _analyze(Elimination * elimination) {
+	AbstractSyntaxTree * abstractSyntaxTree = elimination->abstractSyntaxTree;
+	NodeStack nodeStack;
+	initializeNodeStack(&nodeStack);
+	boolean succeed = pushNodeFrame(&nodeStack, abstractSyntaxTree->program, 0);
+	while (succeed && !isNodeStackEmpty(&nodeStack)) {
+		NodeFrame * frame = peekNodeFrame(&nodeStack);
+		if (frame->index == NO_NODE) {
+			popNodeFrame(&nodeStack);
+			if (!isNodeStackEmpty(&nodeStack)) {
+				symbolTableExitScope(elimination->symbolTable);
+			}
+			continue;
+		}
+		const StatementIndex index = frame->index;
+		Statement * statement = &abstractSyntaxTree->statements[index];
+		const uint32_t stage = frame->stage++;
+		StatementIndex block = NO_NODE;
+		if (stage == 0) {
+			succeed = _analyzeStatement(elimination, index);
+		}
+		if (statement->type == IF_STATEMENT && stage == 0) {
+			block = statement->ifStatement.blockIf;
+			_adoptBlock(elimination, index, block, false);
+		}
+		else if (statement->type == IF_STATEMENT && stage == 1 && statement->ifStatement.type == IF_ELSE_TYPE) {
+			block = statement->ifStatement.blockElse;
+			_adoptBlock(elimination, index, block, true);
+		}
+		else if (statement->type == FOR_STATEMENT && stage == 0) {
+			block = statement->forStatement.block;
+			_adoptBlock(elimination, index, block, false);
+		}
+		if (block == NO_NODE) {
+			frame->index = statement->next;
+			frame->stage = 0;
+			continue;
+		}
+		symbolTableEnterScope(elimination->symbolTable);
+		if (statement->type == FOR_STATEMENT) {
+			struct key key = {
+				.varname = statement->forStatement.varName
+			};
+			struct value value = {
+				.type = INT_VAR,
+				.declaration = index
+			};
+			symbolTableInsert(elimination->symbolTable, &key, &value);
+		}
+		succeed = succeed && pushNodeFrame(&nodeStack, block, 0);
+	}
+	finalizeNodeStack(&nodeStack);
+	return succeed;
+}
+
+/**
+ * Schedules the removal of every statement of a block.
+ */
+static boolean _removeBlock(Elimination * elimination, const StatementIndex block) {
+	for (StatementIndex index = block; index != NO_NODE; index = elimination->abstractSyntaxTree->statements[index].next) {
+		if (!pushNodeFrame(&elimination->pending, index, 0)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Schedules the removal of a variable, that is, of its declaration and every
+ * write.
+ */
+static boolean _removeVariable(Elimination * elimination, const StatementIndex variable) {
+	for (StatementIndex index = variable; index != NO_NODE; index = elimination->infos[index].nextWrite) {
+		if (!pushNodeFrame(&elimination->pending, index, 0)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Schedules the removal of the variables that are never read, and of the
+ * blocks that never run.
+ */
+static boolean _seed(Elimination * elimination) {
+	AbstractSyntaxTree * abstractSyntaxTree = elimination->abstractSyntaxTree;
+	boolean succeed = true;
+	for (StatementIndex index = 1; succeed && index < abstractSyntaxTree->statementCount; ++index) {
+		const Statement * statement = &abstractSyntaxTree->statements[index];
+		const StatementInfo * info = &elimination->infos[index];
+		if (statement->type == DECLARATION_STATEMENT && info->removable && info->readers == 0) {
+			succeed = _removeVariable(elimination, index);
+		}
+		else if (statement->type == IF_STATEMENT) {
+			const Expression * condition = &abstractSyntaxTree->expressions[statement->ifStatement.condition];
+			if (condition->type == CONSTANT_EXP && condition->constant.type == BOOL_CONSTANT) {
+				succeed = condition->constant.boolValue
+					? _removeBlock(elimination, statement->ifStatement.blockElse)
+					: _removeBlock(elimination, statement->ifStatement.blockIf);
+			}
+		}
+		else if (statement->type == FOR_STATEMENT) {
+			const Expression * from = &abstractSyntaxTree->expressions[statement->forStatement.range.expressionLeft];
+			const Expression * to = &abstractSyntaxTree->expressions[statement->forStatement.range.expressionRight];
+			if (from->type == CONSTANT_EXP && from->constant.type == INT_CONSTANT
+					&& to->type == CONSTANT_EXP && to->constant.type == INT_CONSTANT
+					&& to->constant.intValue <= from->constant.intValue) {
+				succeed = _removeBlock(elimination, statement->forStatement.block);
+			}
+		}
+	}
+	return succeed;
+}
+
+/**
+ * Removes the pending statements, and schedules the removal of every
+ * statement left useless by them: the blocks of a removed statement, the
+ * variables that are no longer read, and the statements whose blocks are now
+ * empty.
+ */
+static boolean _propagate(Elimination * elimination) {
+	AbstractSyntaxTree * abstractSyntaxTree = elimination->abstractSyntaxTree;
+	StatementInfo * infos = elimination->infos;
+	boolean succeed = true;
+	while (succeed && !isNodeStackEmpty(&elimination->pending)) {
+		const StatementIndex index = popNodeFrame(&elimination->pending).index;
+		StatementInfo * info = &infos[index];
+		if (info->removed) {
+			continue;
+		}
+		info->removed = true;
+		for (uint32_t k = 0; succeed && k < info->readCount; ++k) {
+			const StatementIndex variable = elimination->reads[info->firstRead + k];
+			if (--infos[variable].readers == 0 && infos[variable].removable) {
+				succeed = _removeVariable(elimination, variable);
+			}
+		}
+		const Statement * statement = &abstractSyntaxTree->statements[index];
+		if (succeed && statement->type == IF_STATEMENT) {
+			succeed = _removeBlock(elimination, statement->ifStatement.blockIf)
+				&& _removeBlock(elimination, statement->ifStatement.blockElse);
+		}
+		else if (succeed && statement->type == FOR_STATEMENT) {
+			succeed = _removeBlock(elimination, statement->forStatement.block);
+		}
+		if (succeed && info->parent != NO_NODE && !infos[info->parent].removed) {
+			StatementInfo * parent = &infos[info->parent];
+			if (info->inElse) {
+				--parent->liveElseStatements;
+			}
+			else {
+				--parent->liveStatements;
+			}
+			// A statement without live blocks is useless too.
+			if (parent->liveStatements == 0 && parent->liveElseStatements == 0) {
+				succeed = pushNodeFrame(&elimination->pending, info->parent, 0);
+			}
+		}
+	}
+	return succeed;
+}
+
+/**
+ * Returns the first statement still alive of a list, from the specified one.
+ */
+static StatementIndex _firstAlive(Elimination * elimination, StatementIndex index) {
+	while (index != NO_NODE && elimination->infos[index].removed) {
+		index = elimination->abstractSyntaxTree->statements[index].next;
+	}
+	return index;
+}
+
+/**
+ * Prepares the negated condition of every "if" whose first block is empty,
+ * but not the other one, before changing the AST at all.
+ */
+static boolean _negateConditions(Elimination * elimination) {
+	AbstractSyntaxTree * abstractSyntaxTree = elimination->abstractSyntaxTree;
+	for (StatementIndex index = 1; index < abstractSyntaxTree->statementCount; ++index) {
+		const Statement * statement = &abstractSyntaxTree->statements[index];
+		StatementInfo * info = &elimination->infos[index];
+		if (info->removed || statement->type != IF_STATEMENT || 0 < info->liveStatements) {
+			continue;
+		}
+		const Expression * condition = &abstractSyntaxTree->expressions[statement->ifStatement.condition];
+		if (condition->type == CONSTANT_EXP) {
+			const Expression negation = {
+				.type = CONSTANT_EXP,
+				.varType = BOOL_VAR,
+				.constant = { .type = BOOL_CONSTANT, .boolValue = !condition->constant.boolValue }
+			};
+			info->negation = appendExpression(abstractSyntaxTree, negation);
+		}
+		else {
+			const Expression parenthesized = {
+				.type = PARENTHESIZED_EXP,
+				.varType = BOOL_VAR,
+				.expression = statement->ifStatement.condition
+			};
+			const Expression negation = {
+				.type = NOT_EXP,
+				.varType = BOOL_VAR,
+				.leftExpression = appendExpression(abstractSyntaxTree, parenthesized),
+				.rightExpression = NO_NODE
+			};
+			info->negation = negation.leftExpression == NO_NODE ? NO_NODE : appendExpression(abstractSyntaxTree, negation);
+		}
+		if (info->negation == NO_NODE) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Unlinks every removed statement, and reshapes the "if" statements with an
+ * empty block.
+ */
+static void _rewrite(Elimination * elimination) {
+	AbstractSyntaxTree * abstractSyntaxTree = elimination->abstractSyntaxTree;
+	abstractSyntaxTree->program = _firstAlive(elimination, abstractSyntaxTree->program);
+	for (StatementIndex index = 1; index < abstractSyntaxTree->statementCount; ++index) {
+		Statement * statement = &abstractSyntaxTree->statements[index];
+		const StatementInfo * info = &elimination->infos[index];
+		if (info->removed) {
+			continue;
+		}
+		statement->next = _firstAlive(elimination, statement->next);
+		if (statement->type == FOR_STATEMENT) {
+			statement->forStatement.block = _firstAlive(elimination, statement->forStatement.block);
+		}
+		else if (statement->type == IF_STATEMENT) {
+			IfStatement * ifStatement = &statement->ifStatement;
+			ifStatement->blockIf = _firstAlive(elimination, ifStatement->blockIf);
+			ifStatement->blockElse = _firstAlive(elimination, ifStatement->blockElse);
+			if (info->liveStatements == 0) {
+				ifStatement->condition = info->negation;
+				ifStatement->blockIf = ifStatement->blockElse;
+			}
+			if (info->liveStatements == 0 || info->liveElseStatements == 0) {
+				ifStatement->type = IF_TYPE;
+				ifStatement->blockElse = NO_NODE;
+			}
+		}
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+void eliminateDeadCode(AbstractSyntaxTree * abstractSyntaxTree) {
+	if (!_deadCodeElimination) {
+		return;
+	}
+	Elimination elimination = {
+		.abstractSyntaxTree = abstractSyntaxTree,
+		.infos = calloc(abstractSyntaxTree->statementCount, sizeof(StatementInfo)),
+		.symbolTable = symbolTableInit(),
+		.reads = NULL,
+		.readCount = 0,
+		.readCapacity = 0
+	};
+	initializeNodeStack(&elimination.pending);
+	initializeNodeStack(&elimination.expressions);
+	boolean succeed = elimination.infos != NULL && elimination.symbolTable != NULL;
+	for (StatementIndex index = 0; succeed && index < abstractSyntaxTree->statementCount; ++index) {
+		elimination.infos[index].target = NO_NODE;
+		elimination.infos[index].nextWrite = NO_NODE;
+		elimination.infos[index].parent = NO_NODE;
+		elimination.infos[index].negation = NO_NODE;
+	}
+	succeed = succeed
+		&& _analyze(&elimination)
+		&& _seed(&elimination)
+		&& _propagate(&elimination)
+		&& _negateConditions(&elimination);
+	if (succeed) {
+		_rewrite(&elimination);
+	}
+	else {
+		logCritical(_logger, "Cannot allocate the state of the dead-code elimination.");
+	}
+	finalizeNodeStack(&elimination.expressions);
+	finalizeNodeStack(&elimination.pending);
+	symbolTableDestroy(elimination.symbolTable);
+	free(elimination.reads);
+	free(elimination.infos);
+}
@@ -0,0 +1,38 @@
+#ifndef DEAD_CODE_ELIMINATION_HEADER
+#define DEAD_CODE_ELIMINATION_HEADER
+
+#include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../shared/Environment.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "../semantic-analysis/symbolTable.h"
+
+/** Initialize module's internal state. */
+void initializeDeadCodeEliminationModule();
+
+/** Shutdown module's internal state. */
+void shutdownDeadCodeEliminationModule();
+
+/**
+ * Removes the statements of a (folded) AST that cannot change the output of
+ * the program:
+ *
+ *	- The blocks that never run: those of an "if" with a constant condition,
+ *	  and those of a "for" with a constant and empty range.
+ *	- The declarations and assignments of the variables that are never read.
+ *	- The trees that are never queried, iterated or visualized, together with
+ *	  every "insert" and "remove" over them.
+ *
+ * Since an RBT prints a line when a missing element is removed, and throws
+ * when one is looked for, its removals (and the inclusions whose result is
+ * never read) are kept. So are the assignments of a variable that is never
+ * read, if they divide by something other than a nonzero constant.
+ *
+ * Removing a statement may leave other variables unread (or other blocks
+ * empty), so the elimination goes on until nothing else can be removed. It's
+ * disabled with "DEAD_CODE_ELIMINATION=false". If there is no memory left, the
+ * AST is left untouched.
+ */
+void eliminateDeadCode(AbstractSyntaxTree * abstractSyntaxTree);
+
+#endif
@@ -0,0 +1,636 @@
+#include "LoopOptimization.h"
+
+/* MODULE INTERNAL STATE */
+
+// The most instructions of a fused loop, which bounds the cost of each check
+// (and keeps the loop small enough for a Java method).
+#define LOOP_FUSION_MAXIMUM_SIZE 1024
+
+// The most iterations of an unrolled loop, and the most instructions that its
+// copies can take.
+#define LOOP_UNROLLING_MAXIMUM_TRIPS 16
+#define LOOP_UNROLLING_MAXIMUM_SIZE 128
+
+static boolean _boundHoisting = true;
+static boolean _loopFusion = true;
+static boolean _loopUnrolling = true;
+static Logger * _logger = NULL;
+
+void initializeLoopOptimizationModule() {
+	_boundHoisting = getBooleanOrDefault("BOUND_HOISTING", _boundHoisting);
+	_loopFusion = getBooleanOrDefault("LOOP_FUSION", _loopFusion);
+	_loopUnrolling = getBooleanOrDefault("LOOP_UNROLLING", _loopUnrolling);
+	_logger = createLogger("LoopOptimization");
+}
+
+void shutdownLoopOptimizationModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+typedef struct {
+	IntermediateRepresentation * intermediateRepresentation;
+
+	// The previous version of the instructions, and its amount of variables.
+	IrInstruction * instructions;
+	uint32_t count;
+	uint32_t variableCount;
+
+	// The new name of each previous temporary (and variable).
+	IrInstructionIndex * renames;
+	IrVariableIndex * variables;
+
+	// For each marker that opens a block, the one that closes it, and vice
+	// versa (but the opening of a fused loop is the first one of the fusion).
+	IrInstructionIndex * blocks;
+
+	// The instructions that write each variable, in order, starting at its
+	// offset (only if the pass needs them).
+	uint32_t * writeOffsets;
+	IrInstructionIndex * writes;
+
+	// The variables read (and written) by the bodies fused into a loop, marked
+	// with the epoch of that loop, and whether they print (only if the pass
+	// needs them).
+	uint32_t * readMarks;
+	uint32_t * writeMarks;
+	uint32_t epoch;
+	IrInstructionIndex marked;
+	boolean prints;
+
+	// The variables declared before this instruction are renamed.
+	IrInstructionIndex renameUntil;
+
+	// The variable replaced with a constant, if any.
+	IrVariableIndex substituted;
+	int substitute;
+
+	// The loops rewritten so far.
+	uint32_t loops;
+} LoopRewriting;
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _beginRewriting(LoopRewriting * rewriting, IntermediateRepresentation * intermediateRepresentation, const boolean indexing, const boolean marking);
+static void _indexWrites(LoopRewriting * rewriting, const IrInstruction * instructions, const uint32_t count);
+static void _endRewriting(LoopRewriting * rewriting);
+static IrVariableIndex _writtenVariable(const IrInstruction * instruction);
+static boolean _isWrittenWithin(const LoopRewriting * rewriting, const IrVariableIndex variable, const IrInstructionIndex first, const IrInstructionIndex last);
+static boolean _readsWrittenWithin(const LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex last, const IrInstructionIndex loop);
+static IrVariableIndex _renamedVariable(const LoopRewriting * rewriting, const IrVariableIndex variable);
+static void _append(LoopRewriting * rewriting, IrInstruction instruction, const IrInstructionIndex index);
+static void _copy(LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex last);
+static boolean _isSameOperand(const IrOperand * left, const IrInstructionIndex leftStart, const IrOperand * right, const IrInstructionIndex rightStart);
+static boolean _isPrinting(const LoopRewriting * rewriting, const IrInstruction * instruction);
+static boolean _isQuery(const IrOpcode opcode);
+static void _mark(LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex last);
+static boolean _isIndependent(LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex last);
+static boolean _canFuse(LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex firstEnd, const IrInstructionIndex secondStart, const IrInstructionIndex second);
+static boolean _canUnroll(LoopRewriting * rewriting, const IrInstructionIndex loop);
+static void _unroll(LoopRewriting * rewriting, const IrInstructionIndex loop);
+static IrInstructionIndex _boundStart(const IrInstruction * instructions, const IrInstructionIndex start, const IrInstructionIndex loop);
+static boolean _canHoist(LoopRewriting * rewriting, const IrInstructionIndex start, const IrInstructionIndex loop);
+static void _hoist(LoopRewriting * rewriting, const IrInstructionIndex start, const IrInstructionIndex loop);
+
+/**
+ * Takes the instructions out of the IR, and matches its blocks. If the pass
+ * needs them, indexes the writes, and allocates the marks of the variables.
+ * Returns false if there is no memory left (and the IR is left as it is).
+ */
+static boolean _beginRewriting(LoopRewriting * rewriting, IntermediateRepresentation * intermediateRepresentation, const boolean indexing, const boolean marking) {
+	const uint32_t count = intermediateRepresentation->instructionCount;
+	const uint32_t variableCount = intermediateRepresentation->variableCount;
+	*rewriting = (LoopRewriting) {
+		.intermediateRepresentation = intermediateRepresentation,
+		.instructions = NULL,
+		.count = 0,
+		.variableCount = variableCount,
+		.renames = calloc(count + 1, sizeof(IrInstructionIndex)),
+		.variables = malloc((variableCount + 1) * sizeof(IrVariableIndex)),
+		.blocks = malloc((count + 1) * sizeof(IrInstructionIndex)),
+		.writeOffsets = indexing ? calloc(variableCount + 1, sizeof(uint32_t)) : NULL,
+		.writes = indexing ? malloc((count + 1) * sizeof(IrInstructionIndex)) : NULL,
+		.readMarks = marking ? calloc(variableCount + 1, sizeof(uint32_t)) : NULL,
+		.writeMarks = marking ? calloc(variableCount + 1, sizeof(uint32_t)) : NULL,
+		.epoch = 0,
+		.marked = IR_NO_VARIABLE,
+		.prints = false,
+		.renameUntil = 0,
+		.substituted = IR_NO_VARIABLE,
+		.substitute = 0,
+		.loops = 0
+	};
+	IrInstructionIndex * openings = malloc((count + 1) * sizeof(IrInstructionIndex));
+	if (rewriting->renames == NULL || rewriting->variables == NULL || rewriting->blocks == NULL || openings == NULL
+			|| (indexing && (rewriting->writeOffsets == NULL || rewriting->writes == NULL))
+			|| (marking && (rewriting->readMarks == NULL || rewriting->writeMarks == NULL))) {
+		logCritical(_logger, "Cannot allocate the state of the loop optimization.");
+		free(openings);
+		return false;
+	}
+	for (IrVariableIndex k = 0; k < variableCount; ++k) {
+		rewriting->variables[k] = k;
+	}
+	if (indexing) {
+		_indexWrites(rewriting, intermediateRepresentation->instructions, count);
+	}
+	rewriting->instructions = detachIrInstructions(intermediateRepresentation, &rewriting->count);
+	uint32_t depth = 0;
+	for (IrInstructionIndex k = 0; k < rewriting->count; ++k) {
+		switch (rewriting->instructions[k].opcode) {
+			case IR_IF:
+			case IR_FOR:
+				openings[depth++] = k;
+				break;
+			case IR_ELSE:
+				rewriting->blocks[openings[depth - 1]] = k;
+				openings[depth - 1] = k;
+				break;
+			case IR_END_IF:
+			case IR_END_FOR:
+				--depth;
+				rewriting->blocks[openings[depth]] = k;
+				rewriting->blocks[k] = openings[depth];
+				break;
+			default:
+				break;
+		}
+	}
+	free(openings);
+	return true;
+}
+
+/**
+ * Indexes the instructions that write each variable, so a pass can check a
+ * body in logarithmic time: the writes of a variable are sorted, from its
+ * offset up to the offset of the next one.
+ */
+static void _indexWrites(LoopRewriting * rewriting, const IrInstruction * instructions, const uint32_t count) {
+	uint32_t * offsets = rewriting->writeOffsets;
+	for (IrInstructionIndex k = 0; k < count; ++k) {
+		const IrVariableIndex variable = _writtenVariable(&instructions[k]);
+		if (variable != IR_NO_VARIABLE) {
+			++offsets[variable];
+		}
+	}
+	// Each offset is the end of the writes of its variable, until they are
+	// filled backwards (which leaves them sorted).
+	for (IrVariableIndex k = 1; k <= rewriting->variableCount; ++k) {
+		offsets[k] += offsets[k - 1];
+	}
+	for (IrInstructionIndex k = count; 0 < k; --k) {
+		const IrVariableIndex variable = _writtenVariable(&instructions[k - 1]);
+		if (variable != IR_NO_VARIABLE) {
+			rewriting->writes[--offsets[variable]] = k - 1;
+		}
+	}
+}
+
+/**
+ * Releases the state of a pass, and the previous version of the instructions.
+ */
+static void _endRewriting(LoopRewriting * rewriting) {
+	free(rewriting->instructions);
+	free(rewriting->renames);
+	free(rewriting->variables);
+	free(rewriting->blocks);
+	free(rewriting->writeOffsets);
+	free(rewriting->writes);
+	free(rewriting->readMarks);
+	free(rewriting->writeMarks);
+}
+
+/**
+ * Returns the variable (or tree, or list) changed by an instruction, if any.
+ */
+static IrVariableIndex _writtenVariable(const IrInstruction * instruction) {
+	switch (instruction->opcode) {
+		case IR_STORE:
+		case IR_INSERT:
+		case IR_INSERT_ALL:
+		case IR_REMOVE:
+		case IR_CALCULATE:
+		case IR_APPEND:
+			return instruction->variable;
+		default:
+			return IR_NO_VARIABLE;
+	}
+}
+
+/**
+ * Returns true if some instruction in [first, last) writes the variable.
+ */
+static boolean _isWrittenWithin(const LoopRewriting * rewriting, const IrVariableIndex variable, const IrInstructionIndex first, const IrInstructionIndex last) {
+	const uint32_t end = rewriting->writeOffsets[variable + 1];
+	uint32_t low = rewriting->writeOffsets[variable];
+	uint32_t high = end;
+	while (low < high) {
+		const uint32_t middle = low + (high - low) / 2;
+		if (rewriting->writes[middle] < first) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+	return low < end && rewriting->writes[low] < last;
+}
+
+/**
+ * Returns true if some variable read by the instructions [first, last) is
+ * written within the body of the loop.
+ */
+static boolean _readsWrittenWithin(const LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex last, const IrInstructionIndex loop) {
+	for (IrInstructionIndex k = first; k < last; ++k) {
+		for (unsigned int o = 0; o < 2; ++o) {
+			const IrOperand * operand = &rewriting->instructions[k].operands[o];
+			if (operand->kind == IR_VARIABLE_OPERAND && _isWrittenWithin(rewriting, operand->variable, loop + 1, rewriting->blocks[loop])) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * Returns the new name of a variable (the ones made by the pass keep theirs).
+ */
+static IrVariableIndex _renamedVariable(const LoopRewriting * rewriting, const IrVariableIndex variable) {
+	return variable < rewriting->variableCount ? rewriting->variables[variable] : variable;
+}
+
+/**
+ * Appends an instruction of the previous version (at the specified index),
+ * with its temporaries and variables renamed, and the substituted variable
+ * replaced. If it declares a variable within the renamed region, the variable
+ * gets a new name first.
+ */
+static void _append(LoopRewriting * rewriting, IrInstruction instruction, const IrInstructionIndex index) {
+	IntermediateRepresentation * intermediateRepresentation = rewriting->intermediateRepresentation;
+	const boolean declaration = instruction.opcode == IR_DECLARE || instruction.opcode == IR_FOR;
+	if (declaration && index < rewriting->renameUntil) {
+		IrVariable irVariable = intermediateRepresentation->variables[_renamedVariable(rewriting, instruction.variable)];
+		irVariable.synthetic = true;
+		rewriting->variables[instruction.variable] = appendIrVariable(intermediateRepresentation, irVariable);
+	}
+	if (instruction.variable != IR_NO_VARIABLE) {
+		instruction.variable = _renamedVariable(rewriting, instruction.variable);
+	}
+	for (unsigned int o = 0; o < 2; ++o) {
+		IrOperand * operand = &instruction.operands[o];
+		if (operand->kind == IR_VARIABLE_OPERAND && operand->variable == rewriting->substituted) {
+			operand->kind = IR_CONSTANT_OPERAND;
+			operand->constant = rewriting->substitute;
+		}
+		else if (operand->kind == IR_VARIABLE_OPERAND) {
+			operand->variable = _renamedVariable(rewriting, operand->variable);
+		}
+	}
+	rewriting->renames[index] = appendRenamedIrInstruction(intermediateRepresentation, instruction, rewriting->renames);
+}
+
+/**
+ * Appends the instructions [first, last) of the previous version.
+ */
+static void _copy(LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex last) {
+	for (IrInstructionIndex k = first; k < last; ++k) {
+		_append(rewriting, rewriting->instructions[k], k);
+	}
+}
+
+/**
+ * Returns true if two operands are the same, where each temporary is relative
+ * to the start of its statement.
+ */
+static boolean _isSameOperand(const IrOperand * left, const IrInstructionIndex leftStart, const IrOperand * right, const IrInstructionIndex rightStart) {
+	if (left->kind != right->kind || left->type != right->type) {
+		return false;
+	}
+	switch (left->kind) {
+		case IR_CONSTANT_OPERAND: return left->constant == right->constant;
+		case IR_STRING_OPERAND: return strcmp(left->string, right->string) == 0;
+		case IR_TEMPORARY_OPERAND: return left->temporary - leftStart == right->temporary - rightStart;
+		case IR_VARIABLE_OPERAND: return left->variable == right->variable;
+		default:
+			return true;
+	}
+}
+
+/**
+ * Returns true if the instruction prints (or queries a tree, without printing).
+ * Besides the traversals, "depth" prints the depth, and the removal of a
+ * missing element from an RBT prints a line.
+ */
+static boolean _isPrinting(const LoopRewriting * rewriting, const IrInstruction * instruction) {
+	switch (instruction->opcode) {
+		case IR_VISUALIZE:
+		case IR_INORDER:
+		case IR_PREORDER:
+		case IR_POSTORDER:
+		case IR_DEPTH:
+			return true;
+		case IR_REMOVE:
+			return rewriting->intermediateRepresentation->variables[instruction->variable].type == IR_RBT_TREE;
+		default:
+			return false;
+	}
+}
+
+static boolean _isQuery(const IrOpcode opcode) {
+	return opcode == IR_INCLUDES || opcode == IR_HEIGHT;
+}
+
+/**
+ * Marks the variables (and trees) read and written by the body [first, last),
+ * with the current epoch.
+ */
+static void _mark(LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex last) {
+	for (IrInstructionIndex k = first; k < last; ++k) {
+		const IrInstruction * instruction = &rewriting->instructions[k];
+		const IrVariableIndex written = _writtenVariable(instruction);
+		if (written != IR_NO_VARIABLE) {
+			rewriting->writeMarks[written] = rewriting->epoch;
+		}
+		if (_isPrinting(rewriting, instruction) || _isQuery(instruction->opcode)) {
+			rewriting->readMarks[instruction->variable] = rewriting->epoch;
+		}
+		for (unsigned int o = 0; o < 2; ++o) {
+			if (instruction->operands[o].kind == IR_VARIABLE_OPERAND) {
+				rewriting->readMarks[instruction->operands[o].variable] = rewriting->epoch;
+			}
+		}
+		rewriting->prints = rewriting->prints || _isPrinting(rewriting, instruction);
+	}
+}
+
+/**
+ * Returns true if the body [first, last) neither reads nor writes the marked
+ * writes, nor writes the marked reads. Both cannot print, either.
+ */
+static boolean _isIndependent(LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex last) {
+	const uint32_t epoch = rewriting->epoch;
+	for (IrInstructionIndex k = first; k < last; ++k) {
+		const IrInstruction * instruction = &rewriting->instructions[k];
+		const IrVariableIndex written = _writtenVariable(instruction);
+		if (_isPrinting(rewriting, instruction) && rewriting->prints) {
+			return false;
+		}
+		if (written != IR_NO_VARIABLE && (rewriting->readMarks[written] == epoch || rewriting->writeMarks[written] == epoch)) {
+			return false;
+		}
+		if ((_isPrinting(rewriting, instruction) || _isQuery(instruction->opcode)) && rewriting->writeMarks[instruction->variable] == epoch) {
+			return false;
+		}
+		for (unsigned int o = 0; o < 2; ++o) {
+			if (instruction->operands[o].kind == IR_VARIABLE_OPERAND && rewriting->writeMarks[instruction->operands[o].variable] == epoch) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * Returns true if the loop that closes at "firstEnd" (opened at "first"), can
+ * be fused with the next one (whose range starts at "secondStart").
+ */
+static boolean _canFuse(LoopRewriting * rewriting, const IrInstructionIndex first, const IrInstructionIndex firstEnd, const IrInstructionIndex secondStart, const IrInstructionIndex second) {
+	const IrInstruction * instructions = rewriting->instructions;
+	const IrInstructionIndex firstStart = irStatementStart(instructions, first);
+	const IrInstructionIndex secondEnd = rewriting->blocks[second];
+	if (LOOP_FUSION_MAXIMUM_SIZE < secondEnd - first || second - secondStart != first - firstStart) {
+		return false;
+	}
+	// Both ranges must compute the same operations, over the same operands.
+	for (IrInstructionIndex k = 0; k <= first - firstStart; ++k) {
+		const IrInstruction * left = &instructions[firstStart + k];
+		const IrInstruction * right = &instructions[secondStart + k];
+		if (firstStart + k < first && (!isIrOperation(left->opcode) || left->opcode != right->opcode)) {
+			return false;
+		}
+		for (unsigned int o = 0; o < 2; ++o) {
+			if (!_isSameOperand(&left->operands[o], firstStart, &right->operands[o], secondStart)) {
+				return false;
+			}
+		}
+	}
+	// Neither the range, nor the variables of the loops, can change.
+	if (_isWrittenWithin(rewriting, instructions[first].variable, first + 1, secondEnd)
+			|| _isWrittenWithin(rewriting, instructions[second].variable, first + 1, secondEnd)) {
+		return false;
+	}
+	for (IrInstructionIndex k = firstStart; k <= first; ++k) {
+		for (unsigned int o = 0; o < 2; ++o) {
+			const IrOperand * operand = &instructions[k].operands[o];
+			if (operand->kind == IR_VARIABLE_OPERAND && _isWrittenWithin(rewriting, operand->variable, first + 1, secondEnd)) {
+				return false;
+			}
+		}
+	}
+	// The bodies fused so far are marked once, and each next body is added.
+	if (rewriting->marked != first) {
+		++rewriting->epoch;
+		rewriting->marked = first;
+		rewriting->prints = false;
+		_mark(rewriting, first + 1, firstEnd);
+	}
+	return _isIndependent(rewriting, second + 1, secondEnd);
+}
+
+/**
+ * Returns true if the loop is an innermost one, over a constant range that is
+ * either empty or small enough, and its body doesn't write its variable.
+ */
+static boolean _canUnroll(LoopRewriting * rewriting, const IrInstructionIndex loop) {
+	const IrInstruction * instruction = &rewriting->instructions[loop];
+	if (instruction->operands[0].kind != IR_CONSTANT_OPERAND || instruction->operands[1].kind != IR_CONSTANT_OPERAND) {
+		return false;
+	}
+	const int64_t trips = (int64_t) instruction->operands[1].constant - instruction->operands[0].constant;
+	const IrInstructionIndex loopEnd = rewriting->blocks[loop];
+	if (trips <= 0) {
+		return true;
+	}
+	if (LOOP_UNROLLING_MAXIMUM_TRIPS < trips || LOOP_UNROLLING_MAXIMUM_SIZE < trips * (loopEnd - loop - 1)) {
+		return false;
+	}
+	for (IrInstructionIndex k = loop + 1; k < loopEnd; ++k) {
+		if (rewriting->instructions[k].opcode == IR_FOR || _writtenVariable(&rewriting->instructions[k]) == instruction->variable) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Appends a copy of the body of the loop per iteration, where the variable of
+ * the loop is the constant of that iteration.
+ */
+static void _unroll(LoopRewriting * rewriting, const IrInstructionIndex loop) {
+	const IrInstruction * instruction = &rewriting->instructions[loop];
+	const IrInstructionIndex loopEnd = rewriting->blocks[loop];
+	rewriting->renameUntil = loopEnd;
+	rewriting->substituted = instruction->variable;
+	for (int value = instruction->operands[0].constant; value < instruction->operands[1].constant; ++value) {
+		rewriting->substitute = value;
+		_copy(rewriting, loop + 1, loopEnd);
+	}
+	rewriting->substituted = IR_NO_VARIABLE;
+	++rewriting->loops;
+}
+
+/**
+ * Returns the first instruction of the end of the range of a loop (whose
+ * statement starts at "start"), which follows the start of the range.
+ */
+static IrInstructionIndex _boundStart(const IrInstruction * instructions, const IrInstructionIndex start, const IrInstructionIndex loop) {
+	const IrOperand * from = &instructions[loop].operands[0];
+	return from->kind == IR_TEMPORARY_OPERAND ? from->temporary + 1 : start;
+}
+
+/**
+ * Returns true if the end of the range of the loop is computed by operations
+ * over variables that its body doesn't write.
+ */
+static boolean _canHoist(LoopRewriting * rewriting, const IrInstructionIndex start, const IrInstructionIndex loop) {
+	const IrOperand * bound = &rewriting->instructions[loop].operands[1];
+	if (bound->kind != IR_TEMPORARY_OPERAND) {
+		return false;
+	}
+	const IrInstructionIndex boundStart = _boundStart(rewriting->instructions, start, loop);
+	for (IrInstructionIndex k = boundStart; k <= bound->temporary; ++k) {
+		if (!isIrOperation(rewriting->instructions[k].opcode)) {
+			return false;
+		}
+	}
+	return !_readsWrittenWithin(rewriting, boundStart, bound->temporary + 1, loop);
+}
+
+/**
+ * Stores the end of the range of the loop into a new variable, before the
+ * loop, which iterates up to that variable instead.
+ */
+static void _hoist(LoopRewriting * rewriting, const IrInstructionIndex start, const IrInstructionIndex loop) {
+	IntermediateRepresentation * intermediateRepresentation = rewriting->intermediateRepresentation;
+	IrInstruction instruction = rewriting->instructions[loop];
+	const IrInstructionIndex boundStart = _boundStart(rewriting->instructions, start, loop);
+	const IrVariable irVariable = {
+		.name = "bound",
+		.type = IR_INTEGER,
+		.synthetic = true
+	};
+	const IrVariableIndex bound = appendIrVariable(intermediateRepresentation, irVariable);
+	const IrInstruction declaration = {
+		.opcode = IR_DECLARE,
+		.type = IR_VOID,
+		.variable = bound,
+		.operands = { { .kind = IR_NO_OPERAND }, { .kind = IR_NO_OPERAND } }
+	};
+	const IrInstruction store = {
+		.opcode = IR_STORE,
+		.type = IR_VOID,
+		.variable = bound,
+		.operands = { instruction.operands[1], { .kind = IR_NO_OPERAND } }
+	};
+	appendIrInstruction(intermediateRepresentation, declaration);
+	_copy(rewriting, boundStart, instruction.operands[1].temporary + 1);
+	appendRenamedIrInstruction(intermediateRepresentation, store, rewriting->renames);
+	_copy(rewriting, start, boundStart);
+	instruction.operands[1] = (IrOperand) {
+		.kind = IR_VARIABLE_OPERAND,
+		.type = IR_INTEGER,
+		.variable = bound
+	};
+	_append(rewriting, instruction, loop);
+	++rewriting->loops;
+}
+
+/* PUBLIC FUNCTIONS */
+
+boolean fuseLoops(IntermediateRepresentation * intermediateRepresentation) {
+	if (!_loopFusion) {
+		return true;
+	}
+	LoopRewriting rewriting;
+	if (!_beginRewriting(&rewriting, intermediateRepresentation, true, true)) {
+		_endRewriting(&rewriting);
+		return false;
+	}
+	for (IrInstructionIndex k = 0; k < rewriting.count && !intermediateRepresentation->exhausted; ++k) {
+		const IrInstructionIndex end = irStatementEnd(rewriting.instructions, rewriting.count, k);
+		if (end < rewriting.count && rewriting.instructions[end].opcode == IR_END_FOR) {
+			const IrInstructionIndex first = rewriting.blocks[end];
+			const IrInstructionIndex second = irStatementEnd(rewriting.instructions, rewriting.count, end + 1);
+			if (second < rewriting.count && rewriting.instructions[second].opcode == IR_FOR
+					&& _canFuse(&rewriting, first, end, end + 1, second)) {
+				// The second body continues the first one: its loop variable is
+				// the first one, and its declarations get new names.
+				const IrInstructionIndex secondEnd = rewriting.blocks[second];
+				_mark(&rewriting, second + 1, secondEnd);
+				rewriting.variables[rewriting.instructions[second].variable] = _renamedVariable(&rewriting, rewriting.instructions[first].variable);
+				rewriting.blocks[secondEnd] = first;
+				if (rewriting.renameUntil < secondEnd) {
+					rewriting.renameUntil = secondEnd;
+				}
+				++rewriting.loops;
+				k = second;
+				continue;
+			}
+		}
+		_copy(&rewriting, k, end < rewriting.count ? end + 1 : end);
+		k = end;
+	}
+	logDebugging(_logger, "%u loop(s) are fused.", rewriting.loops);
+	_endRewriting(&rewriting);
+	return !intermediateRepresentation->exhausted;
+}
+
+boolean unrollLoops(IntermediateRepresentation * intermediateRepresentation) {
+	if (!_loopUnrolling) {
+		return true;
+	}
+	LoopRewriting rewriting;
+	if (!_beginRewriting(&rewriting, intermediateRepresentation, false, false)) {
+		_endRewriting(&rewriting);
+		return false;
+	}
+	for (IrInstructionIndex k = 0; k < rewriting.count && !intermediateRepresentation->exhausted; ++k) {
+		const IrInstructionIndex end = irStatementEnd(rewriting.instructions, rewriting.count, k);
+		if (k == end && end < rewriting.count && rewriting.instructions[end].opcode == IR_FOR && _canUnroll(&rewriting, end)) {
+			_unroll(&rewriting, end);
+			k = rewriting.blocks[end];
+		}
+		else {
+			_copy(&rewriting, k, end < rewriting.count ? end + 1 : end);
+			k = end;
+		}
+	}
+	logDebugging(_logger, "%u loop(s) are unrolled.", rewriting.loops);
+	_endRewriting(&rewriting);
+	return !intermediateRepresentation->exhausted;
+}
+
+boolean hoistLoopBounds(IntermediateRepresentation * intermediateRepresentation) {
+	if (!_boundHoisting) {
+		return true;
+	}
+	LoopRewriting rewriting;
+	if (!_beginRewriting(&rewriting, intermediateRepresentation, true, false)) {
+		_endRewriting(&rewriting);
+		return false;
+	}
+	for (IrInstructionIndex k = 0; k < rewriting.count && !intermediateRepresentation->exhausted; ++k) {
+		const IrInstructionIndex end = irStatementEnd(rewriting.instructions, rewriting.count, k);
+		if (end < rewriting.count && rewriting.instructions[end].opcode == IR_FOR && _canHoist(&rewriting, k, end)) {
+			_hoist(&rewriting, k, end);
+		}
+		else {
+			_copy(&rewriting, k, end < rewriting.count ? end + 1 : end);
+		}
+		k = end;
+	}
+	logDebugging(_logger, "%u loop bound(s) are hoisted.", rewriting.loops);
+	_endRewriting(&rewriting);
+	return !intermediateRepresentation->exhausted;
+}
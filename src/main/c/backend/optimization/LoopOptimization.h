@@ -0,0 +1,41 @@
+#ifndef LOOP_OPTIMIZATION_HEADER
+#define LOOP_OPTIMIZATION_HEADER
+
+#include "../../shared/Environment.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "../intermediate-representation/IntermediateRepresentation.h"
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeLoopOptimizationModule();
+
+/** Shutdown module's internal state. */
+void shutdownLoopOptimizationModule();
+
+/**
+ * Fuses a loop with the next one, if both iterate over the same range (which
+ * neither body changes), and the second body neither reads nor writes what
+ * the first one writes (nor writes what it reads). The variables declared by
+ * the second body are renamed, since both bodies share a block. It's disabled
+ * with "LOOP_FUSION=false". Returns false if there is no memory left.
+ */
+boolean fuseLoops(IntermediateRepresentation * intermediateRepresentation);
+
+/**
+ * Replaces an innermost loop over a small constant range with a copy of its
+ * body per iteration, where the variable of the loop is a constant, and the
+ * variables declared by the body are renamed. A loop over an empty range is
+ * removed. It's disabled with "LOOP_UNROLLING=false". Returns false if there
+ * is no memory left.
+ */
+boolean unrollLoops(IntermediateRepresentation * intermediateRepresentation);
+
+/**
+ * Evaluates the end of the range of a loop once, into a new variable declared
+ * before the loop, if the body cannot change it. It's disabled with
+ * "BOUND_HOISTING=false". Returns false if there is no memory left.
+ */
+boolean hoistLoopBounds(IntermediateRepresentation * intermediateRepresentation);
+
+#endif
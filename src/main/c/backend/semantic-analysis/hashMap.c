@@ -4,174 +4,345 @@
 #include <stdbool.h>
 #include <string.h>
 
-typedef struct entry{
-    tAny key;
-    tAny value;
-    uint8_t status;
-} entry;
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HASH_MAP_SSE2
+#endif
+
+/*
+ * An open-addressing table in the style of SwissTable. Every slot has a
+ * control byte: EMPTY, DELETED (a tombstone), or the lowest 7 bits of the hash
+ * of its key (H2) if it's full. Lookups start at the slot selected by the rest
+ * of the hash (H1), and compare the H2 of 16 control bytes at once (a group),
+ * so the keys are only compared when their H2 matches.
+ *
+ * Keys and values are stored inline, in a single array of slots, so inserting
+ * an entry never allocates memory (unless the table grows).
+ *
+ * @see https://abseil.io/about/design/swisstables
+ */
+
+#define GROUP_WIDTH 16
+#define INITIAL_CAPACITY 16
+
+// The alignment of keys and values inside the slots, so the functions of the
+// user can read them in place (e.g., a pointer, or a 64-bit integer).
+#define SLOT_ALIGNMENT 8
+#define ALIGN(size) (((size) + SLOT_ALIGNMENT - 1) & ~(uint64_t) (SLOT_ALIGNMENT - 1))
+
+#define CTRL_EMPTY ((int8_t) -128)
+#define CTRL_DELETED ((int8_t) -2)
+
+// One bit per slot of a group (the lowest bit is the first slot).
+typedef uint32_t bitMask;
 
 typedef struct hashMapCDT {
-    uint64_t totalSize;
+    // capacity + GROUP_WIDTH control bytes (the first group is cloned at the
+    // end, so a group can start at any slot without wrapping around).
+    int8_t * ctrl;
+    // capacity slots, each one a key followed by its value (both aligned).
+    uint8_t * slots;
+    // Always a power of 2.
+    uint64_t capacity;
     uint64_t usedSize;
-    double threshold;
+    uint64_t tombstones;
+    // How many EMPTY slots can still be filled before the table is rehashed
+    // (it keeps the load factor under 7/8).
+    uint64_t growthLeft;
     hashFp prehash;
     keyEqualsFp keyEquals;
-    entry * lookup;
-    uint64_t lookupSize;
     uint64_t keySize;
     uint64_t valueSize;
+    uint64_t valueOffset;
+    uint64_t slotSize;
 } hashMapCDT;
 
-#define INITIAL_SIZE 20
-typedef enum {FREE = 0, USED, BRIDGE} status;
-
-hashMapADT hashMapInit(uint64_t keySize, uint64_t valueSize, hashFp prehash, keyEqualsFp keyEquals) {
-    hashMapADT new = malloc(sizeof(hashMapCDT));
-    if(new == NULL || (new->lookup = calloc(INITIAL_SIZE, sizeof(entry))) == NULL) {
-        free(new);
-        return NULL;
+static int countTrailingZeros(bitMask mask) {
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int count = 0;
+    for(; (mask & 1) == 0; mask >>= 1) {
+        count++;
     }
-    new->totalSize = 0;
-    new->usedSize = 0;
-    new->threshold = 0.75;
-    new->prehash = prehash;
-    new->keyEquals = keyEquals;
-    new->lookupSize = INITIAL_SIZE;
-    new->keySize = keySize;
-    new->valueSize = valueSize;
-    return new;
+    return count;
+#endif
 }
 
-static uint64_t hash(hashMapADT hm, tAny key) {
-    return hm->prehash(key) % hm->lookupSize;
+// The number of leading zeros of a group mask (i.e., of its 16 lowest bits).
+static int countLeadingZeros(bitMask mask) {
+#if defined(__GNUC__)
+    return __builtin_clz(mask) - (32 - GROUP_WIDTH);
+#else
+    int count = 0;
+    for(bitMask bit = 1u << (GROUP_WIDTH - 1); (mask & bit) == 0; bit >>= 1) {
+        count++;
+    }
+    return count;
+#endif
 }
 
-static void resize(hashMapADT hm) {
-    entry * oldTable = hm->lookup;
-    hm->lookup = calloc(hm->lookupSize*2, sizeof(entry));
-    if(hm->lookup == NULL){
-        hm->lookup = oldTable;
-        return;
+// The slots of the group whose control byte is exactly "value".
+static bitMask groupMatch(const int8_t * group, int8_t value) {
+#ifdef HASH_MAP_SSE2
+    __m128i ctrl = _mm_loadu_si128((const __m128i *) group);
+    return (bitMask) _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#else
+    bitMask mask = 0;
+    for(int i = 0; i < GROUP_WIDTH; i++) {
+        mask |= (bitMask) (group[i] == value) << i;
     }
-    uint64_t oldSize = hm->lookupSize;
-    hm->lookupSize *= 2;
-    hm->totalSize = 0;
-    hm->usedSize = 0;
-    for(uint64_t i = 0; i < oldSize; i++) {
-        if(oldTable[i].status == USED) {
-            hashMapInsertOrUpdate(hm, oldTable[i].key, oldTable[i].value);
-            free(oldTable[i].key);
-            free(oldTable[i].value);
-        }
-    }
-    free(oldTable);
+    return mask;
+#endif
 }
 
-void hashMapInsertOrUpdate(hashMapADT hm, tAny key, tAny value) {
-    if(hm == NULL || key == NULL || value == NULL) {
-        return;
+// The slots of the group that are EMPTY or DELETED (the only negative bytes).
+static bitMask groupMatchEmptyOrDeleted(const int8_t * group) {
+#ifdef HASH_MAP_SSE2
+    return (bitMask) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) group));
+#else
+    bitMask mask = 0;
+    for(int i = 0; i < GROUP_WIDTH; i++) {
+        mask |= (bitMask) (group[i] < 0) << i;
     }
+    return mask;
+#endif
+}
 
-    bool updated = hashMapRemove(hm, key);
+// Spreads the entropy of the hash, so H1 and H2 are independent even if the
+// given hash function is weak in some bits.
+static uint64_t hash(hashMapADT hm, tAny key) {
+    uint64_t h = hm->prehash(key) * 0x9e3779b97f4a7c15;
+    return h ^ (h >> 32);
+}
 
-    // ===== CREATE NEW ENTRY =====
-    entry newEntry;
+static uint64_t h1(uint64_t h) {
+    return h >> 7;
+}
 
-    newEntry.key = malloc(hm->keySize);
-    memcpy(newEntry.key, key, hm->keySize);
+static int8_t h2(uint64_t h) {
+    return (int8_t) (h & 0x7f);
+}
 
-    newEntry.value = malloc(hm->valueSize);
-    memcpy(newEntry.value, value, hm->valueSize);
+static uint8_t * slotAt(hashMapADT hm, uint64_t index) {
+    return hm->slots + index * hm->slotSize;
+}
 
-    newEntry.status = USED;
-    // =====
+static void setCtrl(hashMapADT hm, uint64_t index, int8_t value) {
+    hm->ctrl[index] = value;
+    if(index < GROUP_WIDTH) {
+        hm->ctrl[hm->capacity + index] = value;
+    }
+}
 
-    uint64_t pos = hash(hm, key);
-    bool found = false;
-    if(hm->lookup[pos].status == USED) {
-        for(uint64_t i = 1; i < hm->lookupSize && !found; i++) {
-            uint64_t index = (pos+i) % hm->lookupSize;
-            if(hm->lookup[index].status != USED) {
-                pos = index;
-                found = true;
+static bool keyEquals(hashMapADT hm, tAny key1, tAny key2) {
+    if(hm->keyEquals != NULL) {
+        return hm->keyEquals(key1, key2);
+    }
+    return memcmp(key1, key2, hm->keySize) == 0;
+}
+
+/*
+ * Probes group after group (quadratically, so every group is visited once),
+ * until the key is found, or a group with an EMPTY slot proves it's absent.
+ */
+static bool findIndex(hashMapADT hm, tAny key, uint64_t h, uint64_t * index) {
+    uint64_t mask = hm->capacity - 1;
+    uint64_t pos = h1(h) & mask;
+    for(uint64_t step = GROUP_WIDTH; ; step += GROUP_WIDTH) {
+        const int8_t * group = hm->ctrl + pos;
+        for(bitMask match = groupMatch(group, h2(h)); match != 0; match &= match - 1) {
+            uint64_t candidate = (pos + countTrailingZeros(match)) & mask;
+            if(keyEquals(hm, slotAt(hm, candidate), key)) {
+                *index = candidate;
+                return true;
             }
         }
+        if(groupMatch(group, CTRL_EMPTY) != 0) {
+            return false;
+        }
+        pos = (pos + step) & mask;
     }
-    hm->usedSize++;
-    if(!updated) {
-        hm->totalSize++;
+}
+
+// The first EMPTY or DELETED slot of the probe sequence of a hash.
+static uint64_t findInsertIndex(hashMapADT hm, uint64_t h) {
+    uint64_t mask = hm->capacity - 1;
+    uint64_t pos = h1(h) & mask;
+    for(uint64_t step = GROUP_WIDTH; ; step += GROUP_WIDTH) {
+        bitMask match = groupMatchEmptyOrDeleted(hm->ctrl + pos);
+        if(match != 0) {
+            return (pos + countTrailingZeros(match)) & mask;
+        }
+        pos = (pos + step) & mask;
     }
-    hm->lookup[pos] = newEntry;
-    bool mustResize = ((double)hm->usedSize/hm->lookupSize) > hm->threshold;
-    if(mustResize) {
-        resize(hm);
+}
+
+static bool allocateTable(hashMapADT hm, uint64_t capacity) {
+    int8_t * ctrl = malloc(capacity + GROUP_WIDTH);
+    uint8_t * slots = malloc(capacity * hm->slotSize);
+    if(ctrl == NULL || slots == NULL) {
+        free(ctrl);
+        free(slots);
+        return false;
     }
+    memset(ctrl, CTRL_EMPTY, capacity + GROUP_WIDTH);
+    hm->ctrl = ctrl;
+    hm->slots = slots;
+    hm->capacity = capacity;
+    hm->tombstones = 0;
+    hm->growthLeft = capacity - capacity / 8 - hm->usedSize;
+    return true;
 }
 
-static bool keyEquals(hashMapADT hm, tAny key1, tAny key2) {
-    if(hm->keyEquals != NULL) {
-        return hm->keyEquals(key1, key2);
+/*
+ * Moves every entry to a new table, which drops every tombstone. If most of
+ * the slots that are not EMPTY are tombstones, the capacity is kept (it's a
+ * compaction), otherwise it's doubled.
+ */
+static bool rehash(hashMapADT hm) {
+    int8_t * oldCtrl = hm->ctrl;
+    uint8_t * oldSlots = hm->slots;
+    uint64_t oldCapacity = hm->capacity;
+    uint64_t capacity = hm->usedSize <= (oldCapacity - oldCapacity / 8) / 2 ? oldCapacity : 2 * oldCapacity;
+    if(!allocateTable(hm, capacity)) {
+        return false;
     }
-    return memcmp(key1, key2, hm->keySize) == 0;
+    for(uint64_t i = 0; i < oldCapacity; i++) {
+        if(oldCtrl[i] >= 0) {
+            uint8_t * oldSlot = oldSlots + i * hm->slotSize;
+            uint64_t h = hash(hm, oldSlot);
+            uint64_t index = findInsertIndex(hm, h);
+            setCtrl(hm, index, h2(h));
+            memcpy(slotAt(hm, index), oldSlot, hm->slotSize);
+        }
+    }
+    free(oldCtrl);
+    free(oldSlots);
+    return true;
+}
+
+hashMapADT hashMapInit(uint64_t keySize, uint64_t valueSize, hashFp prehash, keyEqualsFp keyEquals) {
+    hashMapADT new = malloc(sizeof(hashMapCDT));
+    if(new == NULL) {
+        return NULL;
+    }
+    new->usedSize = 0;
+    new->prehash = prehash;
+    new->keyEquals = keyEquals;
+    new->keySize = keySize;
+    new->valueSize = valueSize;
+    new->valueOffset = ALIGN(keySize);
+    new->slotSize = ALIGN(new->valueOffset + valueSize);
+    if(!allocateTable(new, INITIAL_CAPACITY)) {
+        free(new);
+        return NULL;
+    }
+    return new;
+}
+
+void hashMapInsertOrUpdate(hashMapADT hm, tAny key, tAny value) {
+    if(hm == NULL || key == NULL || value == NULL) {
+        return;
+    }
+
+    uint64_t h = hash(hm, key);
+    uint64_t index;
+    if(findIndex(hm, key, h, &index)) {
+        memcpy(slotAt(hm, index) + hm->valueOffset, value, hm->valueSize);
+        return;
+    }
+
+    index = findInsertIndex(hm, h);
+    if(hm->growthLeft == 0 && hm->ctrl[index] == CTRL_EMPTY) {
+        // If the table cannot be rehashed, it can go beyond its load factor,
+        // but an EMPTY slot must remain, or the probes would never end.
+        if(!rehash(hm) && hm->usedSize + hm->tombstones + 1 >= hm->capacity) {
+            return;
+        }
+        index = findInsertIndex(hm, h);
+    }
+    if(hm->ctrl[index] == CTRL_DELETED) {
+        hm->tombstones--;
+    }
+    else if(hm->growthLeft > 0) {
+        hm->growthLeft--;
+    }
+    setCtrl(hm, index, h2(h));
+    memcpy(slotAt(hm, index), key, hm->keySize);
+    memcpy(slotAt(hm, index) + hm->valueOffset, value, hm->valueSize);
+    hm->usedSize++;
 }
 
 bool hashMapRemove(hashMapADT hm, tAny key) {
     if(key == NULL) return false;
 
-    uint64_t pos = hash(hm, key);
-    for(uint64_t i = 0; i < hm->lookupSize; i++) {
-        uint64_t index = (pos + i) % hm->lookupSize;
-        entry * aux = &hm->lookup[index];
-        if(aux->status == FREE) {
-            return false;
-        }
-        if(aux->status == USED && keyEquals(hm, aux->key, key)) {
-            if(hm->lookup[(index+1) % hm->lookupSize].status == FREE) {
-                aux->status = FREE;
-                hm->totalSize--;
-            } else {
-                aux->status = BRIDGE;
-            }
-            free(aux->key);
-            free(aux->value);
-            hm->usedSize--;
-            return true;
-        }
+    uint64_t index;
+    if(!findIndex(hm, key, hash(hm, key), &index)) {
+        return false;
     }
-    return false;
+    // If every window of 16 slots around this one has an EMPTY slot, no probe
+    // ever went past it, so it can be EMPTY again (instead of a tombstone).
+    uint64_t before = (index - GROUP_WIDTH) & (hm->capacity - 1);
+    bitMask emptyAfter = groupMatch(hm->ctrl + index, CTRL_EMPTY);
+    bitMask emptyBefore = groupMatch(hm->ctrl + before, CTRL_EMPTY);
+    int fullAfter = emptyAfter == 0 ? GROUP_WIDTH : countTrailingZeros(emptyAfter);
+    int fullBefore = emptyBefore == 0 ? GROUP_WIDTH : countLeadingZeros(emptyBefore);
+    if(fullAfter + fullBefore < GROUP_WIDTH) {
+        setCtrl(hm, index, CTRL_EMPTY);
+        hm->growthLeft++;
+    }
+    else {
+        setCtrl(hm, index, CTRL_DELETED);
+        hm->tombstones++;
+    }
+    hm->usedSize--;
+    return true;
 }
 
 bool hashMapFind(hashMapADT hm, tAny key, tAny value) {
     if(key == NULL) return false;
 
-    uint64_t pos = hash(hm, key);
-    for(uint64_t i = 0; i < hm->lookupSize; i++) {
-        uint64_t index = (pos + i) % hm->lookupSize;
-        entry * aux = &hm->lookup[index];
-        if(aux->status == FREE) return false;
-        if(aux->status == USED && keyEquals(hm, aux->key, key)) {
-            if(value != NULL) {
-                memcpy(value, aux->value, hm->valueSize);
-            }
-            return true;
-        }
+    uint64_t index;
+    if(!findIndex(hm, key, hash(hm, key), &index)) {
+        return false;
+    }
+    if(value != NULL) {
+        memcpy(value, slotAt(hm, index) + hm->valueOffset, hm->valueSize);
     }
-    return false;
+    return true;
 }
 
 uint64_t hashMapSize(hashMapADT hm) {
     return hm->usedSize;
 }
 
-void hashMapDestroy(hashMapADT hm) {
-    for(uint64_t i = 0; i < hm->lookupSize; i++) {
-        entry * aux = &hm->lookup[i];
-        if(aux->status == USED) {
-            free(aux->key);
-            free(aux->value);
+void hashMapStatistics(hashMapADT hm, hashMapStats * stats) {
+    uint64_t mask = hm->capacity - 1;
+    stats->size = hm->usedSize;
+    stats->capacity = hm->capacity;
+    stats->tombstones = hm->tombstones;
+    stats->totalProbeLength = 0;
+    stats->maximumProbeLength = 0;
+    for(uint64_t i = 0; i < hm->capacity; i++) {
+        if(hm->ctrl[i] >= 0) {
+            // Replays the probe sequence of the key, until a group covers it.
+            uint64_t pos = h1(hash(hm, slotAt(hm, i))) & mask;
+            uint64_t groups = 1;
+            for(uint64_t step = GROUP_WIDTH; ((i - pos) & mask) >= GROUP_WIDTH; step += GROUP_WIDTH) {
+                pos = (pos + step) & mask;
+                groups++;
+            }
+            stats->totalProbeLength += groups;
+            if(stats->maximumProbeLength < groups) {
+                stats->maximumProbeLength = groups;
+            }
         }
     }
-    free(hm->lookup);
-    free(hm);
 }
 
+void hashMapDestroy(hashMapADT hm) {
+    free(hm->ctrl);
+    free(hm->slots);
+    free(hm);
+}
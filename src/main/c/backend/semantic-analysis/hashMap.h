@@ -22,6 +22,18 @@ bool hashMapFind(hashMapADT hm, tAny key, tAny value);
 
 uint64_t hashMapSize(hashMapADT hm);
 
+// The shape of the table, to measure the quality of a hash function. The
+// length of a probe is the number of groups (of 16 slots) visited to find a key.
+typedef struct {
+    uint64_t size;
+    uint64_t capacity;
+    uint64_t tombstones;
+    uint64_t totalProbeLength;
+    uint64_t maximumProbeLength;
+} hashMapStats;
+
+void hashMapStatistics(hashMapADT hm, hashMapStats * stats);
+
 void hashMapDestroy(hashMapADT hm);
 
 #endif
\ No newline at end of file
@@ -1,51 +1,146 @@
+// Before "stdbool.h", which defines "true" and "false" as macros.
+#include "../../shared/InternTable.h"
 #include "symbolTable.h"
 #include "hashMap.h"
 #include <stdint.h>
 #include <string.h>
 
-#define SEED 0x13572468
+#define NO_BINDING UINT32_MAX
+#define INITIAL_CAPACITY 64
 
-static hashMapADT table = NULL;
+/*
+ * A declaration of a name, in some scope. If an enclosing scope declared the
+ * same name, this binding shadows it until its own scope is left.
+ */
+struct binding {
+    struct key key;
+    struct value value;
+    uint32_t shadowed;
+};
 
-// MurmurOAAT_32_Modified
-static uint64_t symbolHashFunction(tAny key) {
+/*
+ * The bindings are kept in a stack, in order of declaration, so they are also
+ * the undo log of the scopes: leaving a scope pops the bindings declared since
+ * it was entered, and restores the ones they shadowed. The hash map only maps
+ * every visible name to its innermost binding, so lookups never depend on the
+ * depth of the scopes.
+ */
+struct symbolTableCDT {
+    hashMapADT table;
+    struct binding * bindings;
+    uint32_t bindingCount;
+    uint32_t bindingCapacity;
+    // The number of bindings when each open scope was entered.
+    uint32_t * scopes;
+    uint32_t scopeCount;
+    uint32_t scopeCapacity;
+};
 
-    uint64_t h = SEED;
+// Every name is interned, so its hash was computed once, by the intern table.
+static uint64_t symbolHashFunction(tAny key) {
     struct key aux = *(struct key*) key;
-
-    const char * str = aux.varname;
-    // One-byte-at-a-time hash based on Murmur's mix
-    // Source: https://github.com/aappleby/smhasher/blob/master/src/Hashes.cpp
-    for (; *str; ++str) {
-        h ^= *str;
-        h *= 0x5bd1e995;
-        h ^= h >> 15;
-    }
-    return h;
+    return internedStringHash(aux.varname);
 }
 
+// Every name is interned, so equal names are the same pointer.
 static bool symbolKeyEquals(tAny key1, tAny key2) {
     struct key aux1 = *(struct key *) key1;
     struct key aux2 = *(struct key *) key2;
-    return strcmp(aux1.varname, aux2.varname) == 0;
+    return aux1.varname == aux2.varname;
 }
 
-void symbolTableInit() {
-    if(table != NULL) {
-        symbolTableDestroy();
+// Doubles the capacity of an array, if it's full.
+static bool reserve(void ** array, uint32_t count, uint32_t * capacity, size_t size) {
+    if (count < *capacity) {
+        return true;
     }
-    table = hashMapInit(sizeof(struct key), sizeof(struct value), symbolHashFunction, symbolKeyEquals);
+    uint32_t newCapacity = *capacity == 0 ? INITIAL_CAPACITY : 2 * *capacity;
+    void * newArray = newCapacity < *capacity ? NULL : realloc(*array, newCapacity * size);
+    if (newArray == NULL) {
+        return false;
+    }
+    *array = newArray;
+    *capacity = newCapacity;
+    return true;
+}
+
+// The index of the innermost binding of a name, or NO_BINDING.
+static uint32_t findBinding(symbolTableADT symbolTable, struct key * key) {
+    uint32_t index;
+    return hashMapFind(symbolTable->table, key, &index) ? index : NO_BINDING;
 }
 
-bool symbolTableFind(struct key * key, struct value * value) {
-    return hashMapFind(table, key, value);
+symbolTableADT symbolTableInit() {
+    symbolTableADT symbolTable = calloc(1, sizeof(struct symbolTableCDT));
+    symbolTable->table = hashMapInit(sizeof(struct key), sizeof(uint32_t), symbolHashFunction, symbolKeyEquals);
+    return symbolTable;
 }
 
-void symbolTableInsert(struct key * key, struct value * value) {
-    hashMapInsertOrUpdate(table, key, value);
+bool symbolTableFind(symbolTableADT symbolTable, struct key * key, struct value * value) {
+    uint32_t index = findBinding(symbolTable, key);
+    if (index == NO_BINDING) {
+        return false;
+    }
+    if (value != NULL) {
+        *value = symbolTable->bindings[index].value;
+    }
+    return true;
+}
+
+void symbolTableInsert(symbolTableADT symbolTable, struct key * key, struct value * value) {
+    uint32_t index = findBinding(symbolTable, key);
+    uint32_t scope = symbolTable->scopeCount == 0 ? 0 : symbolTable->scopes[symbolTable->scopeCount - 1];
+    if (index != NO_BINDING && scope <= index) {
+        symbolTable->bindings[index].value = *value;
+        return;
+    }
+    if (!reserve((void **) &symbolTable->bindings, symbolTable->bindingCount, &symbolTable->bindingCapacity, sizeof(struct binding))) {
+        return;
+    }
+    struct binding * binding = &symbolTable->bindings[symbolTable->bindingCount];
+    binding->key = *key;
+    binding->value = *value;
+    binding->shadowed = index;
+    hashMapInsertOrUpdate(symbolTable->table, key, &symbolTable->bindingCount);
+    symbolTable->bindingCount++;
 }
 
-void symbolTableDestroy() {
-    hashMapDestroy(table);
-    table = NULL;
-}
\ No newline at end of file
+bool symbolTableUpdate(symbolTableADT symbolTable, struct key * key, struct value * value) {
+    uint32_t index = findBinding(symbolTable, key);
+    if (index == NO_BINDING) {
+        return false;
+    }
+    symbolTable->bindings[index].value = *value;
+    return true;
+}
+
+void symbolTableEnterScope(symbolTableADT symbolTable) {
+    if (reserve((void **) &symbolTable->scopes, symbolTable->scopeCount, &symbolTable->scopeCapacity, sizeof(uint32_t))) {
+        symbolTable->scopes[symbolTable->scopeCount++] = symbolTable->bindingCount;
+    }
+}
+
+void symbolTableExitScope(symbolTableADT symbolTable) {
+    if (symbolTable->scopeCount == 0) {
+        return;
+    }
+    uint32_t scope = symbolTable->scopes[--symbolTable->scopeCount];
+    while (scope < symbolTable->bindingCount) {
+        struct binding * binding = &symbolTable->bindings[--symbolTable->bindingCount];
+        if (binding->shadowed == NO_BINDING) {
+            hashMapRemove(symbolTable->table, &binding->key);
+        }
+        else {
+            hashMapInsertOrUpdate(symbolTable->table, &binding->key, &binding->shadowed);
+        }
+    }
+}
+
+void symbolTableDestroy(symbolTableADT symbolTable) {
+    if (symbolTable != NULL) {
+        hashMapDestroy(symbolTable->table);
+        free(symbolTable->bindings);
+        free(symbolTable->scopes);
+        free(symbolTable);
+    }
+}
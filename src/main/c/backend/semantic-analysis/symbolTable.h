@@ -10,9 +10,12 @@ typedef enum VarType {
     INT_VAR,
     BOOL_VAR,
 	CONST_VAR,
+	// The type of an expression that is not well-typed.
+	INVALID_VAR = -1
 } VarType;
 
 struct key {
+    // Must be interned (see "InternTable.h").
     char * varname;
 };
 
@@ -23,14 +26,33 @@ struct metadata {
 struct value {
     VarType type;
     struct metadata metadata;
+    // The index of the declaring statement, once the AST is complete (the
+    // parser leaves it as 0).
+    uint32_t declaration;
 };
 
-void symbolTableInit();
+typedef struct symbolTableCDT * symbolTableADT;
 
-bool symbolTableFind(struct key * key, struct value * value);
+symbolTableADT symbolTableInit();
 
-void symbolTableInsert(struct key * key, struct value * value);
+// Finds the innermost visible declaration of a name.
+bool symbolTableFind(symbolTableADT symbolTable, struct key * key, struct value * value);
 
-void symbolTableDestroy();
+// Declares a name in the current scope (shadowing any enclosing declaration),
+// or updates it if the current scope already declared it.
+void symbolTableInsert(symbolTableADT symbolTable, struct key * key, struct value * value);
+
+// Updates the innermost visible declaration of a name, in whichever scope it
+// lives. Returns false if the name is not visible.
+bool symbolTableUpdate(symbolTableADT symbolTable, struct key * key, struct value * value);
+
+// Opens a nested scope, in constant time.
+void symbolTableEnterScope(symbolTableADT symbolTable);
+
+// Closes the current scope, dropping its declarations, in time proportional to
+// their number. The outermost (global) scope cannot be closed.
+void symbolTableExitScope(symbolTableADT symbolTable);
+
+void symbolTableDestroy(symbolTableADT symbolTable);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,455 @@
+#include "BatchCompilation.h"
+#include "../backend/semantic-analysis/hashMap.h"
+#include <ctype.h>
+#include <errno.h>
+#include <time.h>
+
+#if defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
+#define BATCH_COMPILATION_THREADS
+#include <dirent.h>
+#include <pthread.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializeBatchCompilationModule() {
+	_logger = createLogger("BatchCompilation");
+}
+
+void shutdownBatchCompilationModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * Names that a generated class cannot take: the Java keywords, the classes of
+ * the runtime, and the classes referenced by the generated code.
+ */
+static const char * _reservedClassNames[] = {
+	"abstract", "assert", "boolean", "break", "byte", "case", "catch", "char",
+	"class", "const", "continue", "default", "do", "double", "else", "enum",
+	"extends", "false", "final", "finally", "float", "for", "goto", "if",
+	"implements", "import", "instanceof", "int", "interface", "long", "native",
+	"new", "null", "package", "private", "protected", "public", "record",
+	"return", "short", "static", "strictfp", "super", "switch", "synchronized",
+	"this", "throw", "throws", "transient", "true", "try", "var", "void",
+	"volatile", "while", "yield",
+	"AVL", "BST", "EXP", "IOException", "IntAVL", "IntBST", "IntNode",
+	"IntRBT", "IntTree", "Integer", "Node", "Object", "PooledAVL", "PooledRBT",
+	"PooledTree", "RBT", "String", "System", "Tree",
+	NULL
+};
+
+/* PRIVATE FUNCTIONS */
+
+/**
+ * A program of the batch, and the result of its compilation.
+ */
+typedef struct {
+	char * inputPath;
+	char * className;
+	char * outputPath;
+	char * irPath;
+	long long size;
+	CompilationStatus status;
+	double seconds;
+} BatchProgram;
+
+/**
+ * The programs of the batch, and the index of the next one to compile in the
+ * schedule (shared by every worker).
+ */
+typedef struct {
+	BatchProgram * programs;
+	size_t count;
+	size_t capacity;
+	BatchProgram ** schedule;
+	size_t next;
+	CompilationTarget target;
+#ifdef BATCH_COMPILATION_THREADS
+	pthread_mutex_t mutex;
+#endif
+} Batch;
+
+static void _addProgram(Batch * batch, const char * inputPath);
+static int _compareBySizeDescending(const void * left, const void * right);
+static int _compareStrings(const void * left, const void * right);
+static char * _className(const char * inputPath);
+static uint64_t _classNameHash(tAny key);
+static bool _classNameEquals(tAny left, tAny right);
+static double _currentSeconds(void);
+static void _destroyBatch(Batch * batch);
+static boolean _hasExtension(const char * name, const char * extension);
+static boolean _loadDirectory(Batch * batch, const char * path);
+static boolean _loadList(Batch * batch, const char * path);
+static boolean _loadBatch(Batch * batch, const char * path);
+static void _nameClasses(Batch * batch, const char * outputDirectory, const CompilationTarget target, const boolean dumpIntermediateRepresentation);
+static void _printSummary(const Batch * batch, const unsigned int workers, const double seconds);
+static void * _work(void * batch);
+
+/**
+ * Appends a program to the batch.
+ */
+static void _addProgram(Batch * batch, const char * inputPath) {
+	if (batch->count == batch->capacity) {
+		batch->capacity = batch->capacity == 0 ? 64 : 2 * batch->capacity;
+		batch->programs = realloc(batch->programs, batch->capacity * sizeof(BatchProgram));
+	}
+	BatchProgram * program = &batch->programs[batch->count++];
+	program->inputPath = concatenate(1, inputPath);
+	program->className = NULL;
+	program->outputPath = NULL;
+	program->irPath = NULL;
+	program->size = 0;
+	program->status = FAILED;
+	program->seconds = 0;
+#ifdef BATCH_COMPILATION_THREADS
+	struct stat status;
+	if (stat(inputPath, &status) == 0) {
+		program->size = (long long) status.st_size;
+	}
+#endif
+}
+
+/**
+ * Orders the schedule so the biggest programs are compiled first, which keeps
+ * the workers busy until the very end of the batch.
+ */
+static int _compareBySizeDescending(const void * left, const void * right) {
+	const BatchProgram * leftProgram = *(BatchProgram * const *) left;
+	const BatchProgram * rightProgram = *(BatchProgram * const *) right;
+	if (leftProgram->size != rightProgram->size) {
+		return leftProgram->size < rightProgram->size ? 1 : -1;
+	}
+	return leftProgram < rightProgram ? -1 : 1;
+}
+
+/**
+ * Orders the paths of a directory alphabetically.
+ */
+static int _compareStrings(const void * left, const void * right) {
+	return strcmp(*(char * const *) left, *(char * const *) right);
+}
+
+/**
+ * Derives the name of the Java class from the name of the file: the directory
+ * and the extension are dropped, and every character that cannot be part of a
+ * Java identifier is replaced with an underscore.
+ */
+static char * _className(const char * inputPath) {
+	const char * name = strrchr(inputPath, '/');
+	name = name == NULL ? inputPath : name + 1;
+	const char * extension = strrchr(name, '.');
+	size_t length = (extension == NULL || extension == name) ? strlen(name) : (size_t) (extension - name);
+	char * className = calloc(length + 3, sizeof(char));
+	size_t k = 0;
+	if (length == 0 || isdigit((unsigned char) name[0])) {
+		className[k++] = '_';
+	}
+	for (size_t j = 0; j < length; ++j) {
+		const char character = name[j];
+		className[k++] = (isalnum((unsigned char) character) || character == '_' || character == '$') ? character : '_';
+	}
+	if (strcmp(className, "_") == 0) {
+		className[k++] = '_';
+	}
+	for (unsigned int j = 0; _reservedClassNames[j] != NULL; ++j) {
+		if (strcmp(className, _reservedClassNames[j]) == 0) {
+			className[k++] = '_';
+			break;
+		}
+	}
+	return className;
+}
+
+/**
+ * The classes are compared regardless of the case, because the file-system
+ * where they are written could be case-insensitive.
+ */
+static uint64_t _classNameHash(tAny key) {
+	uint64_t hash = 0xcbf29ce484222325;
+	for (const char * character = *(char **) key; *character != '\0'; ++character) {
+		hash ^= (uint64_t) tolower((unsigned char) *character);
+		hash *= 0x100000001b3;
+	}
+	return hash;
+}
+
+static bool _classNameEquals(tAny left, tAny right) {
+	return strcasecmp(*(char **) left, *(char **) right) == 0;
+}
+
+/**
+ * The current time, in seconds, from an arbitrary (but fixed) point.
+ */
+static double _currentSeconds(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * Releases the batch and its programs.
+ */
+static void _destroyBatch(Batch * batch) {
+	for (size_t k = 0; k < batch->count; ++k) {
+		free(batch->programs[k].inputPath);
+		free(batch->programs[k].className);
+		free(batch->programs[k].outputPath);
+		free(batch->programs[k].irPath);
+	}
+	free(batch->programs);
+	free(batch->schedule);
+}
+
+static boolean _hasExtension(const char * name, const char * extension) {
+	const size_t nameLength = strlen(name);
+	const size_t extensionLength = strlen(extension);
+	return extensionLength < nameLength && strcmp(name + nameLength - extensionLength, extension) == 0;
+}
+
+/**
+ * Adds every ".tla" program of the directory (but not of its subdirectories),
+ * in alphabetical order.
+ */
+static boolean _loadDirectory(Batch * batch, const char * path) {
+#ifdef BATCH_COMPILATION_THREADS
+	DIR * directory = opendir(path);
+	if (directory == NULL) {
+		logError(_logger, "The directory cannot be opened: \"%s\" (%s)", path, strerror(errno));
+		return false;
+	}
+	char ** paths = NULL;
+	size_t count = 0;
+	size_t capacity = 0;
+	for (struct dirent * entry = readdir(directory); entry != NULL; entry = readdir(directory)) {
+		if (!_hasExtension(entry->d_name, ".tla")) {
+			continue;
+		}
+		char * entryPath = concatenate(3, path, "/", entry->d_name);
+		struct stat status;
+		if (stat(entryPath, &status) != 0 || !S_ISREG(status.st_mode)) {
+			free(entryPath);
+			continue;
+		}
+		if (count == capacity) {
+			capacity = capacity == 0 ? 64 : 2 * capacity;
+			paths = realloc(paths, capacity * sizeof(char *));
+		}
+		paths[count++] = entryPath;
+	}
+	closedir(directory);
+	qsort(paths, count, sizeof(char *), _compareStrings);
+	for (size_t k = 0; k < count; ++k) {
+		_addProgram(batch, paths[k]);
+		free(paths[k]);
+	}
+	free(paths);
+	return true;
+#else
+	logError(_logger, "Directories are not supported on this platform (use a list instead): \"%s\"", path);
+	return false;
+#endif
+}
+
+/**
+ * Adds every program listed in the file, one path per line. Blank lines, and
+ * lines that start with '#', are ignored.
+ */
+static boolean _loadList(Batch * batch, const char * path) {
+	FILE * list = fopen(path, "r");
+	if (list == NULL) {
+		logError(_logger, "The list cannot be opened: \"%s\" (%s)", path, strerror(errno));
+		return false;
+	}
+	char line[4096];
+	while (fgets(line, sizeof(line), list) != NULL) {
+		size_t length = strlen(line);
+		while (0 < length && isspace((unsigned char) line[length - 1])) {
+			line[--length] = '\0';
+		}
+		const char * start = line;
+		while (isspace((unsigned char) *start)) {
+			++start;
+		}
+		if (*start != '\0' && *start != '#') {
+			_addProgram(batch, start);
+		}
+	}
+	fclose(list);
+	return true;
+}
+
+/**
+ * Loads the programs of the batch, either from a directory or from a list.
+ */
+static boolean _loadBatch(Batch * batch, const char * path) {
+#ifdef BATCH_COMPILATION_THREADS
+	struct stat status;
+	if (stat(path, &status) == 0 && S_ISDIR(status.st_mode)) {
+		return _loadDirectory(batch, path);
+	}
+#endif
+	return _loadList(batch, path);
+}
+
+/**
+ * Assigns a unique class (and output file) to every program. If two programs
+ * derive the same class, the later ones get a numeric suffix. The IR listing,
+ * if it's dumped, takes the name of the class.
+ */
+static void _nameClasses(Batch * batch, const char * outputDirectory, const CompilationTarget target, const boolean dumpIntermediateRepresentation) {
+	hashMapADT classNames = hashMapInit(sizeof(char *), sizeof(size_t), _classNameHash, _classNameEquals);
+	for (size_t k = 0; k < batch->count; ++k) {
+		BatchProgram * program = &batch->programs[k];
+		char * className = _className(program->inputPath);
+		char suffix[24];
+		for (unsigned int n = 2; hashMapFind(classNames, &className, NULL); ++n) {
+			sprintf(suffix, "_%u", n);
+			char * baseName = _className(program->inputPath);
+			free(className);
+			className = concatenate(2, baseName, suffix);
+			free(baseName);
+		}
+		hashMapInsertOrUpdate(classNames, &className, &k);
+		program->className = className;
+		program->outputPath = concatenate(4, outputDirectory, "/", className, targetExtension(target));
+		if (dumpIntermediateRepresentation) {
+			program->irPath = concatenate(4, outputDirectory, "/", className, ".ir");
+		}
+	}
+	hashMapDestroy(classNames);
+}
+
+/**
+ * Prints the status and the time of every program (in the order of the batch),
+ * and the totals.
+ */
+static void _printSummary(const Batch * batch, const unsigned int workers, const double seconds) {
+	size_t succeeded = 0;
+	double compilationSeconds = 0;
+	printf("%-8s %12s  %s\n", "Status", "Time (ms)", "Program");
+	for (size_t k = 0; k < batch->count; ++k) {
+		const BatchProgram * program = &batch->programs[k];
+		compilationSeconds += program->seconds;
+		if (program->status == SUCCEED) {
+			++succeeded;
+			printf("%-8s %12.3f  %s -> %s\n", "SUCCEED", 1000 * program->seconds, program->inputPath, program->outputPath);
+		}
+		else {
+			printf("%-8s %12.3f  %s\n", "FAILED", 1000 * program->seconds, program->inputPath);
+		}
+	}
+	printf("\n%zu program(s): %zu succeeded, %zu failed.\n", batch->count, succeeded, batch->count - succeeded);
+	printf("Done in %.3f ms with %u worker(s), for %.3f ms of compilation (%.2fx).\n",
+		1000 * seconds,
+		workers,
+		1000 * compilationSeconds,
+		0 < seconds ? compilationSeconds / seconds : 0);
+}
+
+/**
+ * A worker, which compiles the next program in the schedule until there are
+ * no programs left.
+ */
+static void * _work(void * argument) {
+	Batch * batch = argument;
+	while (true) {
+#ifdef BATCH_COMPILATION_THREADS
+		pthread_mutex_lock(&batch->mutex);
+		const size_t next = batch->next++;
+		pthread_mutex_unlock(&batch->mutex);
+#else
+		const size_t next = batch->next++;
+#endif
+		if (batch->count <= next) {
+			return NULL;
+		}
+		BatchProgram * program = batch->schedule[next];
+		const double start = _currentSeconds();
+		program->status = compile(program->inputPath, program->outputPath, program->className, program->irPath, batch->target);
+		program->seconds = _currentSeconds() - start;
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+CompilationStatus compileBatch(const Configuration * configuration) {
+	Batch batch = {
+		.programs = NULL,
+		.count = 0,
+		.capacity = 0,
+		.schedule = NULL,
+		.next = 0,
+		.target = configuration->target
+	};
+	if (!_loadBatch(&batch, configuration->batch)) {
+		_destroyBatch(&batch);
+		return FAILED;
+	}
+	if (batch.count == 0) {
+		logWarning(_logger, "The batch is empty: \"%s\"", configuration->batch);
+		_destroyBatch(&batch);
+		return SUCCEED;
+	}
+	_nameClasses(&batch, configuration->outputDirectory, configuration->target, configuration->dumpIntermediateRepresentation);
+	batch.schedule = calloc(batch.count, sizeof(BatchProgram *));
+	for (size_t k = 0; k < batch.count; ++k) {
+		batch.schedule[k] = &batch.programs[k];
+	}
+	qsort(batch.schedule, batch.count, sizeof(BatchProgram *), _compareBySizeDescending);
+
+	unsigned int workers = configuration->jobs;
+#ifdef BATCH_COMPILATION_THREADS
+	if (workers == 0) {
+		const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+		workers = processors < 1 ? 1 : (unsigned int) processors;
+	}
+#else
+	workers = 1;
+#endif
+	if (batch.count < workers) {
+		workers = (unsigned int) batch.count;
+	}
+	logDebugging(_logger, "Compiling %zu program(s) with %u worker(s)...", batch.count, workers);
+
+	const double start = _currentSeconds();
+#ifdef BATCH_COMPILATION_THREADS
+	pthread_mutex_init(&batch.mutex, NULL);
+	pthread_t * threads = calloc(workers, sizeof(pthread_t));
+	unsigned int threadCount = 0;
+	// The current thread is a worker too.
+	for (; threadCount + 1 < workers; ++threadCount) {
+		if (pthread_create(&threads[threadCount], NULL, _work, &batch) != 0) {
+			logWarning(_logger, "Cannot start more than %u worker(s).", threadCount + 1);
+			break;
+		}
+	}
+	_work(&batch);
+	for (unsigned int k = 0; k < threadCount; ++k) {
+		pthread_join(threads[k], NULL);
+	}
+	free(threads);
+	pthread_mutex_destroy(&batch.mutex);
+	workers = threadCount + 1;
+#else
+	_work(&batch);
+#endif
+	const double seconds = _currentSeconds() - start;
+
+	_printSummary(&batch, workers, seconds);
+	CompilationStatus compilationStatus = SUCCEED;
+	for (size_t k = 0; k < batch.count; ++k) {
+		if (batch.programs[k].status != SUCCEED) {
+			compilationStatus = FAILED;
+		}
+	}
+	_destroyBatch(&batch);
+	return compilationStatus;
+}
@@ -0,0 +1,29 @@
+#ifndef BATCH_COMPILATION_HEADER
+#define BATCH_COMPILATION_HEADER
+
+#include "../shared/CompilerState.h"
+#include "../shared/Configuration.h"
+#include "../shared/Logger.h"
+#include "../shared/String.h"
+#include "../shared/Type.h"
+#include "Compilation.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeBatchCompilationModule();
+
+/** Shutdown module's internal state. */
+void shutdownBatchCompilationModule();
+
+/**
+ * Compiles every program of the batch (a directory with ".tla" programs, or a
+ * file with one path per line) with a pool of workers. Each program produces
+ * its own Java class (as source or bytecode, or a C program), named after the
+ * file, in the output directory. When every program is done, prints a summary
+ * with the status and the time of each one. Fails if any program fails.
+ */
+CompilationStatus compileBatch(const Configuration * configuration);
+
+#endif
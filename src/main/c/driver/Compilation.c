@@ -0,0 +1,201 @@
+#include "Compilation.h"
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializeCompilationModule() {
+	_logger = createLogger("Compilation");
+}
+
+void shutdownCompilationModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/* PRIVATE FUNCTIONS */
+
+static CompilationStatus _analyze(CompilerState * compilerState, const char * irPath);
+static CompilationStatus _process(const char * inputPath, const char * className, const char * irPath, CompilationStatus (*backend)(CompilerState *, const void *), const void * argument);
+static CompilationStatus _generate(CompilerState * compilerState, const void * outputPath);
+static CompilationStatus _generateC(CompilerState * compilerState, const void * outputPath);
+static CompilationStatus _generateClass(CompilerState * compilerState, const void * outputPath);
+static CompilationStatus _interpret(CompilerState * compilerState, const void * output);
+
+/**
+ * Runs every phase of the frontend, and of the backend up to the optimized IR
+ * (which is also written at the IR path, if it's not NULL).
+ */
+static CompilationStatus _analyze(CompilerState * compilerState, const char * irPath) {
+	const SyntacticAnalysisStatus syntacticAnalysisStatus = parse(compilerState);
+	if (syntacticAnalysisStatus != ACCEPT) {
+		logError(_logger, "The syntactic-analysis phase rejects the input program.");
+		return FAILED;
+	}
+	logDebugging(_logger, "Folding constant expressions...");
+	const unsigned int divisionsByZero = foldConstants(compilerState->abstractSyntaxtTree);
+	if (0 < divisionsByZero) {
+		logError(_logger, "The constant-folding phase rejects the input program (%u division(s) by zero).", divisionsByZero);
+		return FAILED;
+	}
+	logDebugging(_logger, "Eliminating dead code...");
+	eliminateDeadCode(compilerState->abstractSyntaxtTree);
+	logDebugging(_logger, "Lowering the AST into the IR...");
+	compilerState->intermediateRepresentation = lowerAbstractSyntaxTree(compilerState->abstractSyntaxtTree, compilerState->arena);
+	if (compilerState->intermediateRepresentation == NULL || !runPasses(compilerState->intermediateRepresentation)) {
+		logError(_logger, "The IR of the program cannot be optimized.");
+		return FAILED;
+	}
+	if (irPath != NULL) {
+		FILE * irFile = fopen(irPath, "w");
+		if (irFile == NULL) {
+			logError(_logger, "The IR file cannot be opened: \"%s\"", irPath);
+			return FAILED;
+		}
+		dumpIntermediateRepresentation(compilerState->intermediateRepresentation, irFile);
+		fclose(irFile);
+	}
+	return SUCCEED;
+}
+
+/**
+ * Analyzes a single program, read from the specified path (or from the
+ * standard input, if the path is NULL), and hands its optimized IR to the
+ * backend. Every compilation owns its entire state.
+ */
+static CompilationStatus _process(const char * inputPath, const char * className, const char * irPath, CompilationStatus (*backend)(CompilerState *, const void *), const void * argument) {
+	// Load the program in memory, if it's not piped through standard input.
+	SourceCode * sourceCode = NULL;
+	if (inputPath != NULL) {
+		sourceCode = openSourceCode(inputPath);
+		if (sourceCode == NULL) {
+			logError(_logger, "The program cannot be loaded.");
+			return FAILED;
+		}
+	}
+
+	// Begin compilation process.
+	CompilerState compilerState = {
+		.abstractSyntaxtTree = NULL,
+		.arena = createArena(),
+		.internTable = NULL,
+		.intermediateRepresentation = NULL,
+		.succeed = false,
+		.className = className,
+		.outputFile = NULL,
+		.outputBuffer = NULL,
+		.scanner = NULL,
+		.semanticErrors = 0,
+		.sourceCode = sourceCode,
+		.symbolTable = NULL,
+		.usedSymbols = NULL,
+		.value = 0
+	};
+	CompilationStatus compilationStatus = _analyze(&compilerState, irPath);
+	if (compilationStatus == SUCCEED) {
+		compilationStatus = backend(&compilerState, argument);
+	}
+	logDebugging(_logger, "Releasing AST resources...");
+	destroyIntermediateRepresentation(compilerState.intermediateRepresentation);
+	destroyAbstractSyntaxTree(compilerState.abstractSyntaxtTree);
+	destroyInternTable(compilerState.internTable);
+	destroyArena(compilerState.arena);
+	closeSourceCode(sourceCode);
+	return compilationStatus;
+}
+
+/**
+ * Generates the Java class of the program at the output path, which is
+ * removed if the class cannot be generated.
+ */
+static CompilationStatus _generate(CompilerState * compilerState, const void * outputPath) {
+	compilerState->outputFile = fopen(outputPath, "w");
+	if (compilerState->outputFile == NULL) {
+		logError(_logger, "The output file cannot be opened: \"%s\"", (const char *) outputPath);
+		return FAILED;
+	}
+	const boolean succeed = generate(compilerState);
+	if (fclose(compilerState->outputFile) != 0 || !succeed) {
+		remove(outputPath);
+		return FAILED;
+	}
+
+	// system("mvn -f ./src/main/c/backend/domain-specific/pom.xml clean compile");
+
+	// // Run the generated file
+	// system("mvn -f ./src/main/c/backend/domain-specific/pom.xml exec:java -Dexec.mainClass=\"Main\"");
+	return SUCCEED;
+}
+
+/**
+ * Generates the C program at the output path, which is removed if the
+ * program cannot be generated.
+ */
+static CompilationStatus _generateC(CompilerState * compilerState, const void * outputPath) {
+	compilerState->outputFile = fopen(outputPath, "w");
+	if (compilerState->outputFile == NULL) {
+		logError(_logger, "The output file cannot be opened: \"%s\"", (const char *) outputPath);
+		return FAILED;
+	}
+	const boolean succeed = generateC(compilerState);
+	if (fclose(compilerState->outputFile) != 0 || !succeed) {
+		remove(outputPath);
+		return FAILED;
+	}
+	return SUCCEED;
+}
+
+/**
+ * Generates the bytecode of the Java class at the output path, which is
+ * removed if the class cannot be generated.
+ */
+static CompilationStatus _generateClass(CompilerState * compilerState, const void * outputPath) {
+	compilerState->outputFile = fopen(outputPath, "wb");
+	if (compilerState->outputFile == NULL) {
+		logError(_logger, "The output file cannot be opened: \"%s\"", (const char *) outputPath);
+		return FAILED;
+	}
+	const boolean succeed = generateClass(compilerState);
+	if (fclose(compilerState->outputFile) != 0 || !succeed) {
+		remove(outputPath);
+		return FAILED;
+	}
+	return SUCCEED;
+}
+
+/**
+ * Runs the program with the interpreter, which writes to the output.
+ */
+static CompilationStatus _interpret(CompilerState * compilerState, const void * output) {
+	logDebugging(_logger, "Running the program...");
+	return interpret(compilerState->intermediateRepresentation, (FILE *) output) ? SUCCEED : FAILED;
+}
+
+/* PUBLIC FUNCTIONS */
+
+CompilationStatus compile(const char * inputPath, const char * outputPath, const char * className, const char * irPath, const CompilationTarget target) {
+	switch (target) {
+		case C_TARGET:
+			return _process(inputPath, className, irPath, _generateC, outputPath);
+		case JAVA_CLASS_TARGET:
+			return _process(inputPath, className, irPath, _generateClass, outputPath);
+		default:
+			return _process(inputPath, className, irPath, _generate, outputPath);
+	}
+}
+
+CompilationStatus run(const char * inputPath, const char * irPath, FILE * output) {
+	return _process(inputPath, "Main", irPath, _interpret, output);
+}
+
+const char * targetExtension(const CompilationTarget target) {
+	switch (target) {
+		case C_TARGET:
+			return ".c";
+		case JAVA_CLASS_TARGET:
+			return ".class";
+		default:
+			return ".java";
+	}
+}
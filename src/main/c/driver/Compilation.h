@@ -0,0 +1,48 @@
+#ifndef COMPILATION_HEADER
+#define COMPILATION_HEADER
+
+#include "../backend/code-generation/CGenerator.h"
+#include "../backend/code-generation/ClassGenerator.h"
+#include "../backend/code-generation/Generator.h"
+#include "../backend/domain-specific/Calculator.h"
+#include "../backend/intermediate-representation/IntermediateRepresentation.h"
+#include "../backend/intermediate-representation/Lowering.h"
+#include "../backend/intermediate-representation/PassManager.h"
+#include "../backend/interpretation/Interpreter.h"
+#include "../backend/optimization/DeadCodeElimination.h"
+#include "../frontend/lexical-analysis/SourceCode.h"
+#include "../frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../frontend/syntactic-analysis/SyntacticAnalyzer.h"
+#include "../shared/CompilerState.h"
+#include "../shared/Logger.h"
+#include <stdio.h>
+
+/** Initialize module's internal state. */
+void initializeCompilationModule();
+
+/** Shutdown module's internal state. */
+void shutdownCompilationModule();
+
+/**
+ * Compiles a single program, read from the specified path (or from the
+ * standard input, if the path is NULL), into a Java class with the specified
+ * name (as source or bytecode, or into a C program, depending on the target),
+ * written at the output
+ * path. If the IR path is not NULL, the IR is also written there, after every
+ * pass. Every compilation owns its entire state, so several of them can run
+ * concurrently.
+ */
+CompilationStatus compile(const char * inputPath, const char * outputPath, const char * className, const char * irPath, const CompilationTarget target);
+
+/**
+ * Runs a single program, read as "compile" does, with the interpreter instead
+ * of generating Java: what the program prints is written to the output.
+ */
+CompilationStatus run(const char * inputPath, const char * irPath, FILE * output);
+
+/**
+ * The extension of the files generated for the target (e.g., ".java").
+ */
+const char * targetExtension(const CompilationTarget target);
+
+#endif
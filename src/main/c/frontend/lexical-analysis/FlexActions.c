@@ -21,16 +21,21 @@ void shutdownFlexActionsModule() {
 static void _logLexicalAnalyzerContext(const char * functionName, LexicalAnalyzerContext * lexicalAnalyzerContext);
 
 /**
- * Logs a lexical-analyzer context in DEBUGGING level.
+ * Logs a lexical-analyzer context in DEBUGGING level. The lexeme is only
+ * escaped (i.e., copied) if that level is enabled.
  */
 static void _logLexicalAnalyzerContext(const char * functionName, LexicalAnalyzerContext * lexicalAnalyzerContext) {
+	if (!isLoggingLevelEnabled(_logger, DEBUGGING)) {
+		return;
+	}
 	char * escapedLexeme = escape(lexicalAnalyzerContext->lexeme);
-	logDebugging(_logger, "%s: %s (context = %d, length = %d, line = %d)",
+	logDebugging(_logger, "%s: %s (context = %d, length = %d, line = %d, offset = %d)",
 		functionName,
 		escapedLexeme,
 		lexicalAnalyzerContext->currentContext,
 		lexicalAnalyzerContext->length,
-		lexicalAnalyzerContext->line);
+		lexicalAnalyzerContext->line,
+		lexicalAnalyzerContext->offset);
 	free(escapedLexeme);
 }
 
@@ -298,9 +303,7 @@ Token UnknownLexemeAction(LexicalAnalyzerContext * lexicalAnalyzerContext) {
 
 Token DeclarationLexemeAction(LexicalAnalyzerContext * lexicalAnalyzerContext) {
 	_logLexicalAnalyzerContext(__FUNCTION__, lexicalAnalyzerContext);
-    char * varName = (char*) malloc(lexicalAnalyzerContext->length + 1);
-    strncpy(varName, lexicalAnalyzerContext->lexeme, lexicalAnalyzerContext->length);
-    varName[lexicalAnalyzerContext->length] = '\0';
-	lexicalAnalyzerContext->semanticValue->varname = varName;
+	lexicalAnalyzerContext->semanticValue->varname = internString(lexicalAnalyzerContext->compilerState->internTable,
+		lexicalAnalyzerContext->lexeme, lexicalAnalyzerContext->length);
     return DECLARATION;
 }
\ No newline at end of file
@@ -4,10 +4,39 @@
 /**
  * Hook that allows to export a static function or variable from the inside of
  * Flex infrastructure, in this case, the current context (a.k.a. start
- * condition).
+ * condition) of a scanner.
  */
-unsigned int flexCurrentContext(void) {
+unsigned int flexCurrentContext(void * scanner) {
+	struct yyguts_t * yyg = (struct yyguts_t *) scanner;
 	return YY_START;
 }
 
+/**
+ * Hook that creates a new reentrant scanner with the specified state. If a
+ * buffer is provided, Flex scans it in place (i.e., without copying it),
+ * instead of reading from "yyin". The size includes the two null characters
+ * that must be at the end of the buffer.
+ *
+ * @see https://westes.github.io/flex/manual/Init-and-Destroy-Functions.html
+ * @see https://westes.github.io/flex/manual/Multiple-Input-Buffers.html
+ */
+void * flexCreateScanner(LexicalAnalyzerState * lexicalAnalyzerState, char * buffer, const size_t size) {
+	yyscan_t scanner;
+	if (yylex_init_extra(lexicalAnalyzerState, &scanner) != 0) {
+		return NULL;
+	}
+	if (buffer != NULL && yy_scan_buffer(buffer, size, scanner) == NULL) {
+		yylex_destroy(scanner);
+		return NULL;
+	}
+	return scanner;
+}
+
+/**
+ * Hook that releases a scanner and its buffers, but not their content.
+ */
+void flexDestroyScanner(void * scanner) {
+	yylex_destroy(scanner);
+}
+
 #endif
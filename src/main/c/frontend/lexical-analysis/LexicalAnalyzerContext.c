@@ -1,41 +1,67 @@
 #include "LexicalAnalyzerContext.h"
 
+/* MODULE INTERNAL STATE */
+
+static boolean _zeroCopyLexemes = true;
+
+void initializeLexicalAnalyzerContextModule() {
+	_zeroCopyLexemes = getBooleanOrDefault("ZERO_COPY_LEXEMES", _zeroCopyLexemes);
+}
+
+void shutdownLexicalAnalyzerContextModule() {
+}
+
 /**
- * Flex exported variables and functions.
+ * Flex exported functions.
  *
- * @see https://westes.github.io/flex/manual/User-Values.html
+ * @see https://westes.github.io/flex/manual/Reentrant-Functions.html
  */
 
-// The wrapper of "yy_top_state" function (provided by Flex).
-extern unsigned int flexCurrentContext(void);
+// The wrapper of "YY_START" macro (provided by Flex).
+extern unsigned int flexCurrentContext(void * scanner);
+
+// The state of the scanner (provided by Flex).
+extern LexicalAnalyzerState * yyget_extra(void * scanner);
 
 // The lexeme length in characters (provided by Flex).
-extern int yyleng;
+extern int yyget_leng(void * scanner);
 
 // The line number (provided by Flex).
-extern int yylineno;
+extern int yyget_lineno(void * scanner);
 
-// The semantic value of the lookahead symbol (provided by Bison).
-extern union SemanticValue yylval;
+// The semantic value of the lookahead symbol (provided by Bison, through Flex).
+extern union SemanticValue * yyget_lval(void * scanner);
 
 // The current lexeme (provided by Flex).
-extern char * yytext;
+extern char * yyget_text(void * scanner);
 
 /* PUBLIC FUNCTIONS */
 
-LexicalAnalyzerContext * createLexicalAnalyzerContext() {
-	LexicalAnalyzerContext * lexicalAnalyzerContext = calloc(1, sizeof(LexicalAnalyzerContext));
-	lexicalAnalyzerContext->length = yyleng;
-	lexicalAnalyzerContext->lexeme = calloc(1 + yyleng, sizeof(char));
-	lexicalAnalyzerContext->line = yylineno;
-	lexicalAnalyzerContext->semanticValue = &yylval;
-	lexicalAnalyzerContext->currentContext = flexCurrentContext();
-	strncpy(lexicalAnalyzerContext->lexeme, yytext, yyleng);
+LexicalAnalyzerContext * createLexicalAnalyzerContext(void * scanner) {
+	LexicalAnalyzerState * lexicalAnalyzerState = yyget_extra(scanner);
+	LexicalAnalyzerContext * lexicalAnalyzerContext = &lexicalAnalyzerState->lexemeSlice;
+	if (!_zeroCopyLexemes) {
+		lexicalAnalyzerContext = calloc(1, sizeof(LexicalAnalyzerContext));
+	}
+	lexicalAnalyzerContext->compilerState = lexicalAnalyzerState->compilerState;
+	lexicalAnalyzerContext->currentContext = flexCurrentContext(scanner);
+	lexicalAnalyzerContext->length = yyget_leng(scanner);
+	lexicalAnalyzerContext->line = yyget_lineno(scanner);
+	lexicalAnalyzerContext->offset = lexicalAnalyzerState->lexemeOffset;
+	lexicalAnalyzerContext->semanticValue = yyget_lval(scanner);
+	if (_zeroCopyLexemes) {
+		// Flex null-terminates "yytext" while the action runs.
+		lexicalAnalyzerContext->lexeme = yyget_text(scanner);
+	}
+	else {
+		lexicalAnalyzerContext->lexeme = calloc(1 + lexicalAnalyzerContext->length, sizeof(char));
+		strncpy(lexicalAnalyzerContext->lexeme, yyget_text(scanner), lexicalAnalyzerContext->length);
+	}
 	return lexicalAnalyzerContext;
 }
 
 void destroyLexicalAnalyzerContext(LexicalAnalyzerContext * lexicalAnalyzerContext) {
-	if (lexicalAnalyzerContext != NULL) {
+	if (lexicalAnalyzerContext != NULL && !_zeroCopyLexemes) {
 		if (lexicalAnalyzerContext->lexeme != NULL) {
 			free(lexicalAnalyzerContext->lexeme);
 		}
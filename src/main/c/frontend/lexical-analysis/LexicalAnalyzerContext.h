@@ -1,26 +1,53 @@
 #ifndef LEXICAL_ANALYZER_CONTEXT_HEADER
 #define LEXICAL_ANALYZER_CONTEXT_HEADER
 
+#include "../../shared/CompilerState.h"
+#include "../../shared/Environment.h"
+#include "../../shared/Type.h"
 #include <stdlib.h>
 #include <string.h>
 
+/** Initialize module's internal state. */
+void initializeLexicalAnalyzerContextModule();
+
+/** Shutdown module's internal state. */
+void shutdownLexicalAnalyzerContextModule();
+
 /**
- * The state of a lexical-analyzer context.
+ * The state of a lexical-analyzer context. The lexeme is a slice of the input
+ * which starts at "offset" (in bytes), and has "length" characters.
  */
 typedef struct {
+	CompilerState * compilerState;
 	unsigned int currentContext;
 	unsigned int length;
 	char * lexeme;
 	unsigned int line;
+	unsigned int offset;
 	union SemanticValue * semanticValue;
 } LexicalAnalyzerContext;
 
 /**
- * Creates a new context with the current state of the lexical-analyzer over
- * the lexeme just consumed. The lexeme is a deep-copy of the original,
- * allocated in heap-memory.
+ * The state of a reentrant scanner, shared with Flex as its "extra" data. It
+ * belongs to a single compilation, so no two scanners share anything.
+ */
+typedef struct {
+	CompilerState * compilerState;
+	LexicalAnalyzerContext lexemeSlice;
+	unsigned int lexemeOffset;
+	unsigned int nextLexemeOffset;
+} LexicalAnalyzerState;
+
+/**
+ * Creates a new context with the current state of the scanner over the lexeme
+ * just consumed.
+ *
+ * If "ZERO_COPY_LEXEMES" is enabled, the context is a view over the Flex
+ * buffer that gets overwritten on every call, so it's only valid during the
+ * execution of the current action. Otherwise, the lexeme is a deep-copy of
+ * the original, allocated in heap-memory.
  */
-LexicalAnalyzerContext * createLexicalAnalyzerContext();
+LexicalAnalyzerContext * createLexicalAnalyzerContext(void * scanner);
 
 /**
  * Destroy a lexical-analyzer context and its resources.
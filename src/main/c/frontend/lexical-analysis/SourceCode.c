@@ -0,0 +1,154 @@
+#include "SourceCode.h"
+#include <errno.h>
+#include <string.h>
+
+#if defined (__unix__) || (defined (__APPLE__) && defined (__MACH__))
+#define SOURCE_CODE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializeSourceCodeModule() {
+	_logger = createLogger("SourceCode");
+}
+
+void shutdownSourceCodeModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/* PRIVATE FUNCTIONS */
+
+static SourceCode * _mapSourceCode(const char * path);
+static SourceCode * _readSourceCode(const char * path);
+
+#ifdef SOURCE_CODE_MMAP
+
+/**
+ * Maps the file right before an anonymous (i.e., zero-filled) region, so the
+ * two null characters required by Flex are always available, even if the
+ * size of the file is a multiple of the page size. The mapping is private,
+ * because Flex writes a null character after every lexeme while its action
+ * runs: only the touched pages get copied, and never to the file.
+ */
+static SourceCode * _mapSourceCode(const char * path) {
+	const int descriptor = open(path, O_RDONLY);
+	if (descriptor < 0) {
+		logError(_logger, "Cannot open \"%s\": %s", path, strerror(errno));
+		return NULL;
+	}
+	struct stat status;
+	if (fstat(descriptor, &status) < 0) {
+		logError(_logger, "Cannot inspect \"%s\": %s", path, strerror(errno));
+		close(descriptor);
+		return NULL;
+	}
+	if (!S_ISREG(status.st_mode)) {
+		// Pipes and devices cannot be mapped.
+		close(descriptor);
+		return _readSourceCode(path);
+	}
+	const size_t length = status.st_size;
+	const size_t pageSize = sysconf(_SC_PAGESIZE);
+	const size_t capacity = ((length + 2 + pageSize - 1) / pageSize) * pageSize;
+	char * content = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (content == MAP_FAILED) {
+		logError(_logger, "Cannot reserve %zu bytes for \"%s\": %s", capacity, path, strerror(errno));
+		close(descriptor);
+		return NULL;
+	}
+	if (0 < length && mmap(content, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, descriptor, 0) == MAP_FAILED) {
+		logError(_logger, "Cannot map \"%s\": %s", path, strerror(errno));
+		munmap(content, capacity);
+		close(descriptor);
+		return NULL;
+	}
+	close(descriptor);
+	madvise(content, capacity, MADV_SEQUENTIAL);
+	SourceCode * sourceCode = calloc(1, sizeof(SourceCode));
+	sourceCode->content = content;
+	sourceCode->length = length;
+	sourceCode->capacity = capacity;
+	sourceCode->mapped = true;
+	return sourceCode;
+}
+
+#else
+
+static SourceCode * _mapSourceCode(const char * path) {
+	return _readSourceCode(path);
+}
+
+#endif
+
+/**
+ * Reads the whole file into heap-memory, growing the buffer geometrically
+ * since the size of a pipe is unknown beforehand. Used on platforms without
+ * "mmap", or for files that cannot be mapped.
+ */
+static SourceCode * _readSourceCode(const char * path) {
+	FILE * file = fopen(path, "rb");
+	if (file == NULL) {
+		logError(_logger, "Cannot open \"%s\": %s", path, strerror(errno));
+		return NULL;
+	}
+	size_t capacity = 65536;
+	size_t length = 0;
+	char * content = malloc(capacity);
+	size_t read;
+	while (0 < (read = fread(content + length, sizeof(char), capacity - length - 2, file))) {
+		length += read;
+		if (capacity - length - 2 == 0) {
+			capacity *= 2;
+			content = realloc(content, capacity);
+		}
+	}
+	if (ferror(file)) {
+		logError(_logger, "Cannot read \"%s\".", path);
+		free(content);
+		fclose(file);
+		return NULL;
+	}
+	fclose(file);
+	content[length] = '\0';
+	content[length + 1] = '\0';
+	SourceCode * sourceCode = calloc(1, sizeof(SourceCode));
+	sourceCode->content = content;
+	sourceCode->length = length;
+	sourceCode->capacity = capacity;
+	sourceCode->mapped = false;
+	return sourceCode;
+}
+
+/* PUBLIC FUNCTIONS */
+
+SourceCode * openSourceCode(const char * path) {
+	SourceCode * sourceCode = _mapSourceCode(path);
+	if (sourceCode != NULL) {
+		logDebugging(_logger, "Loaded \"%s\" (%zu bytes, %s).", path, sourceCode->length, sourceCode->mapped ? "memory-mapped" : "heap-memory");
+	}
+	return sourceCode;
+}
+
+void closeSourceCode(SourceCode * sourceCode) {
+	if (sourceCode != NULL) {
+#ifdef SOURCE_CODE_MMAP
+		if (sourceCode->mapped) {
+			munmap(sourceCode->content, sourceCode->capacity);
+		}
+		else {
+			free(sourceCode->content);
+		}
+#else
+		free(sourceCode->content);
+#endif
+		free(sourceCode);
+	}
+}
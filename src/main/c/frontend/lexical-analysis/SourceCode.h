@@ -0,0 +1,39 @@
+#ifndef SOURCE_CODE_HEADER
+#define SOURCE_CODE_HEADER
+
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Initialize module's internal state. */
+void initializeSourceCodeModule();
+
+/** Shutdown module's internal state. */
+void shutdownSourceCodeModule();
+
+/**
+ * A program loaded in memory, ready to be scanned in place by Flex. The
+ * content is followed by two null characters (as required by
+ * "yy_scan_buffer"), which are not included in the length.
+ */
+typedef struct {
+	char * content;
+	size_t length;
+	size_t capacity;
+	boolean mapped;
+} SourceCode;
+
+/**
+ * Loads the program stored at the specified path. On POSIX systems the file
+ * is memory-mapped, so it's never read through an intermediate buffer.
+ * Returns NULL if the file cannot be loaded.
+ */
+SourceCode * openSourceCode(const char * path);
+
+/**
+ * Releases the source-code. No scanner can be using it anymore.
+ */
+void closeSourceCode(SourceCode * sourceCode);
+
+#endif
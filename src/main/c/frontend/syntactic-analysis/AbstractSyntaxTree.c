@@ -2,6 +2,9 @@
 
 /* MODULE INTERNAL STATE */
 
+// The initial capacity of every array of nodes.
+#define INITIAL_NODE_CAPACITY 256
+
 static Logger * _logger = NULL;
 
 void initializeAbstractSyntaxTreeModule() {
@@ -14,219 +17,142 @@ void shutdownAbstractSyntaxTreeModule() {
 	}
 }
 
-/** PUBLIC FUNCTIONS */
-
-/*
-void releaseConstant(Constant * constant) {
-	logDebugging(_logger, "Executing destructor: %s", __FUNCTION__);
-	if (constant != NULL) {
-		free(constant);
-	}
-}
-
-void releaseExpression(Expression * expression) {
-	logDebugging(_logger, "Executing destructor: %s", __FUNCTION__);
-	if (expression != NULL) {
-		switch (expression->type) {
-			case ADDITION_EXP:
-			case DIVISION_EXP:
-			case MULTIPLICATION_EXP:
-			case SUBTRACTION_EXP:
-				releaseExpression(expression->leftExpression);
-				releaseExpression(expression->rightExpression);
-				break;
-			case FACTOR_EXP:
-				releaseFactor(expression->factor);
-				break;
+/* PRIVATE FUNCTIONS */
+
+static boolean _reserveNode(AbstractSyntaxTree * abstractSyntaxTree, void ** nodes, uint32_t * count, uint32_t * capacity, const size_t size, uint32_t * index);
+
+/**
+ * Reserves a slot at the end of an array of nodes, doubling its capacity if
+ * it's full. Returns false if there is no memory left.
+ */
+static boolean _reserveNode(AbstractSyntaxTree * abstractSyntaxTree, void ** nodes, uint32_t * count, uint32_t * capacity, const size_t size, uint32_t * index) {
+	if (*count == *capacity) {
+		const uint32_t newCapacity = *capacity == 0 ? INITIAL_NODE_CAPACITY : 2 * *capacity;
+		void * newNodes = newCapacity < *capacity ? NULL : realloc(*nodes, newCapacity * size);
+		if (newNodes == NULL) {
+			if (!abstractSyntaxTree->exhausted) {
+				logCritical(_logger, "Cannot allocate %u nodes of %zu bytes.", newCapacity, size);
+			}
+			abstractSyntaxTree->exhausted = true;
+			return false;
 		}
-		free(expression);
+		*nodes = newNodes;
+		*capacity = newCapacity;
 	}
+	*index = (*count)++;
+	return true;
 }
 
-void releaseFactor(Factor * factor) {
-	logDebugging(_logger, "Executing destructor: %s", __FUNCTION__);
-	if (factor != NULL) {
-		switch (factor->type) {
-			case CONSTANT_FACTOR:
-				releaseConstant(factor->constant);
-				break;
-			case EXPRESSION_FACTOR:
-				releaseExpression(factor->expression);
-				break;
-		}
-		free(factor);
-	}
-}
-*/
-
-void releaseProgram(Program *program) {
-    if (program == NULL) {
-        return;
-    }
-
-    releaseStatementList(program->statements);
-    free(program);
-}
-
-void releaseStatementList(StatementList statementList) {
-    if (statementList == NULL) {
-        return;
-    }
-
-    releaseStatementList(statementList->next);
-
-    releaseStatement(statementList->statement);
-    free(statementList);
-}
-
-void releaseStatement(Statement *statement) {
-    if (statement == NULL) {
-        return;
-    }
-
-    switch (statement->type) {
-        case IF_STATEMENT:
-            releaseIfStatement(statement->ifStatement);
-            break;
-        case FOR_STATEMENT:
-            releaseForStatement(statement->forStatement);
-            break;
-        case FUNCTION_CALL_STATEMENT:
-            releaseFunctionCall(statement->functionCall);
-            break;
-        case DECLARATION_STATEMENT:
-            releaseDeclaration(statement->declaration);
-            break;
-        case ASSIGNMENT_STATEMENT:
-            releaseAssignment(statement->assignment);
-            break;
-        default:
-            break;
-    }
-    free(statement);
-}
-
-void releaseAssignment(Assignment *assignment) {
-    if (assignment == NULL) {
-        return;
-    }
+/* PUBLIC FUNCTIONS */
 
-    releaseExpression(assignment->expression);
-    releaseVariable(assignment->varName);
-    releaseFunctionCall(assignment->functionCall);
-    free(assignment);
+AbstractSyntaxTree * createAbstractSyntaxTree() {
+	AbstractSyntaxTree * abstractSyntaxTree = calloc(1, sizeof(AbstractSyntaxTree));
+	if (abstractSyntaxTree == NULL) {
+		logCritical(_logger, "Cannot allocate the AST.");
+		return NULL;
+	}
+	// Occupy the slot of NO_NODE, with harmless nodes.
+	const Expression expression = {
+		.type = CONSTANT_EXP,
+		.varType = INT_VAR,
+		.constant = { .type = INT_CONSTANT, .intValue = 0 }
+	};
+	const FunctionCall functionCall = { .varName = "", .type = HEIGHT_CALL, .expression = NO_NODE };
+	const Statement statement = { .type = FUNCTION_CALL_STATEMENT, .next = NO_NODE, .functionCall = NO_NODE };
+	appendExpression(abstractSyntaxTree, expression);
+	appendFunctionCall(abstractSyntaxTree, functionCall);
+	appendStatement(abstractSyntaxTree, statement);
+	if (abstractSyntaxTree->exhausted) {
+		destroyAbstractSyntaxTree(abstractSyntaxTree);
+		return NULL;
+	}
+	abstractSyntaxTree->program = NO_NODE;
+	return abstractSyntaxTree;
 }
 
-void releaseFunctionCall(FunctionCall *functionCall) {
-    if (functionCall == NULL) {
-        return;
-    }
-
-    releaseExpression(functionCall->expression);
-    releaseVariable(functionCall->varName);
-    releaseDeclaration(functionCall->declaration);
-    free(functionCall);
+ExpressionIndex appendExpression(AbstractSyntaxTree * abstractSyntaxTree, const Expression expression) {
+	ExpressionIndex index = NO_NODE;
+	if (_reserveNode(abstractSyntaxTree, (void **) &abstractSyntaxTree->expressions,
+			&abstractSyntaxTree->expressionCount, &abstractSyntaxTree->expressionCapacity, sizeof(Expression), &index)) {
+		abstractSyntaxTree->expressions[index] = expression;
+	}
+	return index;
 }
 
-void releaseDeclaration(Declaration *declaration) {
-    if (declaration == NULL) {
-        return;
-    }
-
-    releaseVariable(declaration->varName);
-    free(declaration);
+FunctionCallIndex appendFunctionCall(AbstractSyntaxTree * abstractSyntaxTree, const FunctionCall functionCall) {
+	FunctionCallIndex index = NO_NODE;
+	if (_reserveNode(abstractSyntaxTree, (void **) &abstractSyntaxTree->functionCalls,
+			&abstractSyntaxTree->functionCallCount, &abstractSyntaxTree->functionCallCapacity, sizeof(FunctionCall), &index)) {
+		abstractSyntaxTree->functionCalls[index] = functionCall;
+	}
+	return index;
 }
 
-
-void releaseForStatement(ForStatement *forStatement) {
-    if (forStatement == NULL) {
-        return;
-    }
-
-    releaseRangeExpression(forStatement->range);
-    releaseBlock(forStatement->block);
-    free(forStatement);
+StatementIndex appendStatement(AbstractSyntaxTree * abstractSyntaxTree, const Statement statement) {
+	StatementIndex index = NO_NODE;
+	if (_reserveNode(abstractSyntaxTree, (void **) &abstractSyntaxTree->statements,
+			&abstractSyntaxTree->statementCount, &abstractSyntaxTree->statementCapacity, sizeof(Statement), &index)) {
+		abstractSyntaxTree->statements[index] = statement;
+	}
+	return index;
 }
 
-void releaseRangeExpression(RangeExpression *rangeExpression) {
-    if (rangeExpression == NULL) {
-        return;
-    }
-
-    releaseExpression(rangeExpression->expressionLeft);
-    releaseExpression(rangeExpression->expressionRight);
-    free(rangeExpression);
+void destroyAbstractSyntaxTree(AbstractSyntaxTree * abstractSyntaxTree) {
+	if (abstractSyntaxTree != NULL) {
+		free(abstractSyntaxTree->expressions);
+		free(abstractSyntaxTree->functionCalls);
+		free(abstractSyntaxTree->statements);
+		free(abstractSyntaxTree);
+	}
 }
 
-void releaseIfStatement(IfStatement *ifStatement) {
-    if (ifStatement == NULL) {
-        return;
-    }
-
-    releaseExpression(ifStatement->condition);
-    releaseBlock(ifStatement->blockIf);
-
-    if (ifStatement->type == IF_ELSE_TYPE) {
-        releaseBlock(ifStatement->blockElse);
-    }
-    free(ifStatement);
+void initializeNodeStack(NodeStack * nodeStack) {
+	nodeStack->frames = nodeStack->buffer;
+	nodeStack->count = 0;
+	nodeStack->capacity = NODE_STACK_BUFFER_SIZE;
 }
 
-void releaseBlock(Block *block) {
-    if (block == NULL) {
-        return;
-    }
-
-    releaseStatementList(block->statements);
-    free(block);
+boolean pushNodeFrame(NodeStack * nodeStack, const uint32_t index, const uint32_t stage) {
+	if (nodeStack->count == nodeStack->capacity) {
+		const uint32_t newCapacity = 2 * nodeStack->capacity;
+		NodeFrame * frames = newCapacity < nodeStack->capacity
+			? NULL
+			: nodeStack->frames == nodeStack->buffer
+				? malloc(newCapacity * sizeof(NodeFrame))
+				: realloc(nodeStack->frames, newCapacity * sizeof(NodeFrame));
+		if (frames == NULL) {
+			logCritical(_logger, "Cannot allocate a node stack of %u frames.", newCapacity);
+			return false;
+		}
+		if (nodeStack->frames == nodeStack->buffer) {
+			memcpy(frames, nodeStack->buffer, sizeof(nodeStack->buffer));
+		}
+		nodeStack->frames = frames;
+		nodeStack->capacity = newCapacity;
+	}
+	const NodeFrame frame = {
+		.index = index,
+		.stage = stage
+	};
+	nodeStack->frames[nodeStack->count++] = frame;
+	return true;
 }
 
-void releaseExpression(Expression *expression) {
-    if (expression == NULL) {
-        return;
-    }
-
-    if (expression->type == EXPRESSION_FACTOR) {
-        releaseFactor(expression->factor);
-    } else {
-        releaseExpression(expression->leftExpression);
-        releaseExpression(expression->rightExpression);
-    }
-
-    free(expression);
+NodeFrame * peekNodeFrame(NodeStack * nodeStack) {
+	return &nodeStack->frames[nodeStack->count - 1];
 }
 
-void releaseFactor(Factor *factor) {
-    if (factor == NULL) {
-        return;
-    }
-
-    switch (factor->type) {
-        case EXPRESSION_FACTOR:
-            releaseExpression(factor->expression);
-            break;
-        case DECLARATION_FACTOR:
-            releaseVariable(factor->varName);
-            break;
-        case CONSTANT_FACTOR:
-            releaseConstant(factor->constant);
-            break;
-    }
-
-    free(factor);
+NodeFrame popNodeFrame(NodeStack * nodeStack) {
+	return nodeStack->frames[--nodeStack->count];
 }
 
-void releaseConstant(Constant *constant) {
-    if (constant == NULL) {
-        return;
-    }
-
-    free(constant);
+boolean isNodeStackEmpty(NodeStack * nodeStack) {
+	return nodeStack->count == 0;
 }
 
-void releaseVariable(char *varName) {
-    if (varName == NULL) {
-        return;
-    }
-    free(varName);
+void finalizeNodeStack(NodeStack * nodeStack) {
+	if (nodeStack->frames != nodeStack->buffer) {
+		free(nodeStack->frames);
+	}
+	initializeNodeStack(nodeStack);
 }
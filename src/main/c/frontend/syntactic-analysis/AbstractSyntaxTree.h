@@ -2,8 +2,11 @@
 #define ABSTRACT_SYNTAX_TREE_HEADER
 
 #include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include "../../backend/semantic-analysis/symbolTable.h"
 
 /** Initialize module's internal state. */
@@ -13,19 +16,24 @@ void initializeAbstractSyntaxTreeModule();
 void shutdownAbstractSyntaxTreeModule();
 
 /**
- * This typedefs allows self-referencing types.
+ * Every node of the Abstract Syntax Tree (AST) lives in a contiguous array of
+ * its kind (expressions, statements and function calls), and nodes refer to
+ * each other with 32-bit indices over those arrays, instead of pointers. The
+ * index 0 is never used by a real node, so "NO_NODE" plays the role of NULL.
+ *
+ * Since Bison reduces bottom-up, the children of a node always have a lower
+ * index than the node itself, so a single forward pass over an array visits
+ * every subtree before its parent.
+ *
+ * The identifiers are still pointers, to strings interned in the arena of the
+ * compilation, so equal identifiers are the same pointer.
  */
 
-typedef enum ExpressionType ExpressionType;
+#define NO_NODE 0
 
-typedef struct Expression Expression;
-typedef struct Factor Factor;
-typedef struct Program Program;
-typedef struct StatementNode * StatementList;
-
-/**
- * Node types for the Abstract Syntax Tree (AST).
- */
+typedef uint32_t ExpressionIndex;
+typedef uint32_t FunctionCallIndex;
+typedef uint32_t StatementIndex;
 
 typedef enum {
     INT_CONSTANT,
@@ -33,35 +41,16 @@ typedef enum {
 } ConstantType;
 
 typedef struct {
-		int intValue;
-    	bool boolValue;
 	ConstantType type;
+	union {
+		int intValue;
+		bool boolValue;
+	};
 } Constant;
 
 typedef enum {
-	EXPRESSION_FACTOR,
-	CONSTANT_FACTOR,
-	DECLARATION_FACTOR,
-} FactorType;
-
-typedef struct {
-	VarType type;
-	char * varName;
-    struct Assignment * assignment;
-} Declaration;
-
-struct Factor {
-		Constant * constant;
-		Expression * expression;
-		Declaration * declaration;
-	FactorType type;
-	char * varName;
-};
-
-enum ExpressionType {
 	ADDITION_EXP,
 	DIVISION_EXP,
-	FACTOR_EXP,
 	MULTIPLICATION_EXP,
 	SUBTRACTION_EXP,
 	MODULE_EXP,
@@ -73,21 +62,29 @@ enum ExpressionType {
 	LESS_EQUAL_EXP,
 	OR_EXP,
 	AND_EXP,
-	NOT_EXP
-};
+	NOT_EXP,
+	// Factors.
+	CONSTANT_EXP,
+	PARENTHESIZED_EXP,
+	VARIABLE_EXP
+} ExpressionType;
 
-struct Expression {
-		Factor * factor;
+typedef struct {
+	ExpressionType type;
+	// The inferred type, resolved once when the node is built (it fits in the
+	// padding before the union, so the node is still 16 bytes long).
+	VarType varType;
+	union {
+		// Operations ("NOT_EXP" has a left expression only).
 		struct {
-			Expression * leftExpression;
-			Expression * rightExpression;
+			ExpressionIndex leftExpression;
+			ExpressionIndex rightExpression;
 		};
-	ExpressionType type;
-};
-
-typedef struct {
-	StatementList statements;
-} Block;
+		Constant constant;
+		ExpressionIndex expression;
+		char * varName;
+	};
+} Expression;
 
 typedef enum {
 	IF_ELSE_TYPE,
@@ -96,20 +93,20 @@ typedef enum {
 
 typedef struct {
 	IfStatementType type;
-	Expression * condition;
-	Block * blockIf;
-	Block * blockElse;
+	ExpressionIndex condition;
+	StatementIndex blockIf;
+	StatementIndex blockElse;
 } IfStatement;
 
 typedef struct {
-	Expression * expressionLeft;
-	Expression * expressionRight;
+	ExpressionIndex expressionLeft;
+	ExpressionIndex expressionRight;
 } RangeExpression;
 
 typedef struct {
 	char * varName;
-	RangeExpression * range;
-	Block * block;
+	RangeExpression range;
+	StatementIndex block;
 } ForStatement;
 
 typedef enum {
@@ -131,7 +128,6 @@ typedef enum{
 typedef struct {
 	char * varName;
 	IteratorType type;
-	Block * block;
 } IterateStatement;
 
 typedef enum {
@@ -148,17 +144,23 @@ typedef enum {
 
 typedef struct {
 	char * varName;
-	Expression * expression;
-	Declaration * declaration;
 	FunctionCallType type;
+	ExpressionIndex expression;
 } FunctionCall;
 
-typedef struct Assignment {
+typedef struct {
 	char * varName;
-	Expression * expression;
-    FunctionCall * functionCall;
+	ExpressionIndex expression;
+	FunctionCallIndex functionCall;
 } Assignment;
 
+typedef struct {
+	// The assignment holds the name, even if there is no initial value.
+	Assignment assignment;
+	VarType type;
+	bool hasAssignment;
+} Declaration;
+
 typedef enum {
 	IF_STATEMENT,
 	FOR_STATEMENT,
@@ -168,41 +170,121 @@ typedef enum {
 	ITERATE_STATEMENT
 } StatementType;
 
+/**
+ * The statements of a block (or program), linked through "next". The last one
+ * is tracked too, so the parser appends each statement in constant time.
+ */
+typedef struct {
+	StatementIndex first;
+	StatementIndex last;
+} StatementList;
+
 typedef struct {
-		IfStatement * ifStatement;
-		ForStatement * forStatement;
-		FunctionCall * functionCall;
-		Declaration * declaration;
-		Assignment * assignment;
-		IterateStatement * iterateStatement;
 	StatementType type;
+	// The next statement of the same block (or program).
+	StatementIndex next;
+	union {
+		IfStatement ifStatement;
+		ForStatement forStatement;
+		FunctionCallIndex functionCall;
+		Declaration declaration;
+		Assignment assignment;
+		IterateStatement iterateStatement;
+	};
 } Statement;
 
-struct StatementNode {
-	Statement * statement;
-	StatementList next;
-};
+typedef struct {
+	Expression * expressions;
+	uint32_t expressionCount;
+	uint32_t expressionCapacity;
+
+	FunctionCall * functionCalls;
+	uint32_t functionCallCount;
+	uint32_t functionCallCapacity;
+
+	Statement * statements;
+	uint32_t statementCount;
+	uint32_t statementCapacity;
+
+	// The first statement of the program.
+	StatementIndex program;
+
+	// True if some node could not be allocated.
+	boolean exhausted;
+} AbstractSyntaxTree;
 
-struct Program {
-	StatementList statements;
-};
+// The number of frames of a node stack that never leave the C stack.
+#define NODE_STACK_BUFFER_SIZE 32
+
+/**
+ * A frame of an explicit stack, used to walk the AST without recursion: the
+ * index of a node (or any other value), and how much of it was visited.
+ */
+typedef struct {
+	uint32_t index;
+	uint32_t stage;
+} NodeFrame;
+
+/**
+ * An explicit stack of frames, so the depth of the AST never limits the depth
+ * of the C stack. The first frames live in an inline buffer, and only deeper
+ * trees spill to heap-memory.
+ */
+typedef struct {
+	NodeFrame * frames;
+	uint32_t count;
+	uint32_t capacity;
+	NodeFrame buffer[NODE_STACK_BUFFER_SIZE];
+} NodeStack;
+
+/**
+ * Creates an empty AST. Returns NULL if there is no memory left.
+ */
+AbstractSyntaxTree * createAbstractSyntaxTree();
+
+/**
+ * Appends a node to the proper array, and returns its index. If there is no
+ * memory left, the AST is marked as exhausted, and NO_NODE is returned.
+ */
+ExpressionIndex appendExpression(AbstractSyntaxTree * abstractSyntaxTree, const Expression expression);
+FunctionCallIndex appendFunctionCall(AbstractSyntaxTree * abstractSyntaxTree, const FunctionCall functionCall);
+StatementIndex appendStatement(AbstractSyntaxTree * abstractSyntaxTree, const Statement statement);
+
+/**
+ * Releases every node of the AST, and the AST itself.
+ */
+void destroyAbstractSyntaxTree(AbstractSyntaxTree * abstractSyntaxTree);
+
+/**
+ * Prepares an empty node stack. It cannot be moved (or copied) afterwards.
+ */
+void initializeNodeStack(NodeStack * nodeStack);
+
+/**
+ * Pushes a new frame. Returns false if there is no memory left.
+ */
+boolean pushNodeFrame(NodeStack * nodeStack, const uint32_t index, const uint32_t stage);
+
+/**
+ * Returns the frame on top of the stack, which is invalidated by the next
+ * push. The stack cannot be empty.
+ */
+NodeFrame * peekNodeFrame(NodeStack * nodeStack);
+
+/**
+ * Removes the frame on top of the stack, and returns it. The stack cannot be
+ * empty.
+ */
+NodeFrame popNodeFrame(NodeStack * nodeStack);
+
+/**
+ * Returns true if the stack has no frames.
+ */
+boolean isNodeStackEmpty(NodeStack * nodeStack);
 
 /**
- * Node recursive destructors.
+ * Releases the heap-memory of the stack, if any.
  */
-void releaseProgram(Program * program);
-void releaseStatementList(StatementList statementList);
-void releaseStatement(Statement * statement);
-void releaseAssignment(Assignment * assignment);
-void releaseFunctionCall(FunctionCall * functionCall);
-void releaseDeclaration(Declaration * declaration);
-void releaseForStatement(ForStatement * forStatement);
-void releaseRangeExpression(RangeExpression * rangeExpression);
-void releaseIfStatement(IfStatement * ifStatement);
-void releaseBlock(Block * block);
-void releaseExpression(Expression * expression);
-void releaseFactor(Factor * factor);
-void releaseConstant(Constant *constant);
-void releaseVariable(char * variable);
+void finalizeNodeStack(NodeStack * nodeStack);
 
 #endif
@@ -1,5 +1,7 @@
 #include "BisonActions.h"
+#include "../../backend/semantic-analysis/hashMap.h"
 #include "../../backend/semantic-analysis/symbolTable.h"
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -20,11 +22,46 @@ void shutdownBisonActionsModule() {
 
 /** IMPORTED FUNCTIONS */
 
-extern unsigned int flexCurrentContext(void);
+extern unsigned int flexCurrentContext(void * scanner);
 
 /* PRIVATE FUNCTIONS */
 
+/**
+ * The symbols used in the expressions of a compilation, with the type each
+ * one is expected to have. They are validated when the scope in which they
+ * were used ends (or when the program ends, at the global scope), so each
+ * scope keeps the number of symbols used before it began. The index of every
+ * symbol is hashed too, so each use is checked in constant time.
+ */
+typedef struct {
+	struct key * symbols;
+	VarType * expectedTypes;
+	int count;
+	int capacity;
+	hashMapADT indices;
+	int * scopes;
+	int scopeCount;
+	int scopeCapacity;
+} UsedSymbols;
+
+static uint64_t _usedSymbolHash(tAny key);
+static bool _usedSymbolEquals(tAny key1, tAny key2);
 static void _logSyntacticAnalyzerAction(const char * functionName);
+static void _semanticError(CompilerState * compilerState, const char * const format, ...);
+static void _beginScope(CompilerState * compilerState);
+static void _endScope(CompilerState * compilerState);
+
+/**
+ * Every symbol is interned, so its hash is already computed, and equal
+ * symbols are the same pointer.
+ */
+static uint64_t _usedSymbolHash(tAny key) {
+	return internedStringHash(((struct key *) key)->varname);
+}
+
+static bool _usedSymbolEquals(tAny key1, tAny key2) {
+	return ((struct key *) key1)->varname == ((struct key *) key2)->varname;
+}
 
 /**
  * Logs a syntactic-analyzer action in DEBUGGING level.
@@ -33,36 +70,104 @@ static void _logSyntacticAnalyzerAction(const char * functionName) {
 	logDebugging(_logger, "%s", functionName);
 }
 
+/**
+ * Logs a semantic error, and marks the compilation as failed. The parsing
+ * goes on, so every other error in the program gets reported too.
+ */
+static void _semanticError(CompilerState * compilerState, const char * const format, ...) {
+	char message[256];
+	va_list arguments;
+	va_start(arguments, format);
+	vsnprintf(message, sizeof(message), format, arguments);
+	va_end(arguments);
+	logError(_logger, "%s", message);
+	++compilerState->semanticErrors;
+}
+
+/**
+ * Opens a nested scope, in the symbol table and in the used symbols.
+ */
+static void _beginScope(CompilerState * compilerState) {
+	UsedSymbols * usedSymbols = compilerState->usedSymbols;
+	if (usedSymbols->scopeCount == usedSymbols->scopeCapacity) {
+		const int scopeCapacity = usedSymbols->scopeCapacity == 0 ? 16 : 2 * usedSymbols->scopeCapacity;
+		int * scopes = realloc(usedSymbols->scopes, sizeof(int) * scopeCapacity);
+		if (scopes == NULL) {
+			logCritical(_logger, "Cannot allocate %d nested scopes.", scopeCapacity);
+			return;
+		}
+		usedSymbols->scopes = scopes;
+		usedSymbols->scopeCapacity = scopeCapacity;
+	}
+	usedSymbols->scopes[usedSymbols->scopeCount++] = usedSymbols->count;
+	symbolTableEnterScope(compilerState->symbolTable);
+}
+
+/**
+ * Validates the symbols used in the current scope, while its declarations are
+ * still visible, and closes it.
+ */
+static void _endScope(CompilerState * compilerState) {
+	UsedSymbols * usedSymbols = compilerState->usedSymbols;
+	if (usedSymbols->scopeCount == 0) {
+		return;
+	}
+	validateUsedSymbols(compilerState, usedSymbols->scopes[--usedSymbols->scopeCount]);
+	symbolTableExitScope(compilerState->symbolTable);
+}
+
 /* PUBLIC FUNCTIONS */
 
-static struct key *usedSymbols;
-static VarType *usedSymbolsExpectedType;
-static int usedSymbolsCount = 0;
+void beginSemanticAnalysis(CompilerState * compilerState) {
+	compilerState->semanticErrors = 0;
+	compilerState->symbolTable = symbolTableInit();
+	UsedSymbols * usedSymbols = calloc(1, sizeof(UsedSymbols));
+	usedSymbols->indices = hashMapInit(sizeof(struct key), sizeof(int), _usedSymbolHash, _usedSymbolEquals);
+	compilerState->usedSymbols = usedSymbols;
+}
+
+void endSemanticAnalysis(CompilerState * compilerState) {
+	UsedSymbols * usedSymbols = compilerState->usedSymbols;
+	if (usedSymbols != NULL) {
+		free(usedSymbols->symbols);
+		free(usedSymbols->expectedTypes);
+		free(usedSymbols->scopes);
+		hashMapDestroy(usedSymbols->indices);
+		free(usedSymbols);
+		compilerState->usedSymbols = NULL;
+	}
+	symbolTableDestroy(compilerState->symbolTable);
+	compilerState->symbolTable = NULL;
+}
 
-Constant * IntegerConstantSemanticAction(const int value) {
+ExpressionIndex IntegerConstantSemanticAction(CompilerState * compilerState, const int value) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	Constant * constant = malloc(sizeof(Constant));
-	constant->intValue = value;
-	constant->type = INT_CONSTANT;
-	return constant;
+	const Expression expression = {
+		.type = CONSTANT_EXP,
+		.varType = INT_VAR,
+		.constant = { .type = INT_CONSTANT, .intValue = value }
+	};
+	return appendExpression(compilerState->abstractSyntaxtTree, expression);
 }
 
-Constant * BooleanConstantSemanticAction(const bool value) {
+ExpressionIndex BooleanConstantSemanticAction(CompilerState * compilerState, const bool value) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	Constant * constant = malloc(sizeof(Constant));
-	constant->boolValue = value;
-	constant->type = BOOL_CONSTANT;
-	return constant;
+	const Expression expression = {
+		.type = CONSTANT_EXP,
+		.varType = BOOL_VAR,
+		.constant = { .type = BOOL_CONSTANT, .boolValue = value }
+	};
+	return appendExpression(compilerState->abstractSyntaxtTree, expression);
 }
 
-Expression * ArithmeticExpressionSemanticAction(Expression * leftExpression, Expression * rightExpression, ExpressionType type) {
+ExpressionIndex ArithmeticExpressionSemanticAction(CompilerState * compilerState, ExpressionIndex leftExpression, ExpressionIndex rightExpression, ExpressionType type) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
+	AbstractSyntaxTree * abstractSyntaxTree = compilerState->abstractSyntaxtTree;
 
 	VarType leftType, rightType;
 
-	if(leftExpression != NULL && rightExpression != NULL && (leftType = getExpressionType(leftExpression)) != (rightType = getExpressionType(rightExpression))){
-		logError(_logger, "Incompatible parameters");
-		exit(1);
+	if(leftExpression != NO_NODE && rightExpression != NO_NODE && (leftType = getExpressionType(compilerState, leftExpression)) != (rightType = getExpressionType(compilerState, rightExpression))){
+		_semanticError(compilerState, "Incompatible parameters");
 	}
 
 	VarType factorType;
@@ -74,157 +179,177 @@ Expression * ArithmeticExpressionSemanticAction(Expression * leftExpression, Exp
 		factorType = INT_VAR;
 	}
 
-	if(leftExpression != NULL && leftExpression->type == FACTOR_EXP && leftExpression->factor->type == DECLARATION_FACTOR){
-		AddUsedSymbol(leftExpression->factor->varName, factorType);
+	if(leftExpression != NO_NODE && abstractSyntaxTree->expressions[leftExpression].type == VARIABLE_EXP){
+		AddUsedSymbol(compilerState, abstractSyntaxTree->expressions[leftExpression].varName, factorType);
 	}
 
-	if(rightExpression != NULL && rightExpression->type == FACTOR_EXP && rightExpression->factor->type == DECLARATION_FACTOR){
-		AddUsedSymbol(rightExpression->factor->varName, factorType);
+	if(rightExpression != NO_NODE && abstractSyntaxTree->expressions[rightExpression].type == VARIABLE_EXP){
+		AddUsedSymbol(compilerState, abstractSyntaxTree->expressions[rightExpression].varName, factorType);
 	}
 
-	Expression * expression = malloc(sizeof(Expression));
-	expression->leftExpression = leftExpression;
-	expression->rightExpression = rightExpression;
-	expression->type = type;
-	expression->factor = NULL;
-	return expression;
+	const Expression expression = {
+		.type = type,
+		.varType = _inferOperationType(compilerState, leftExpression, rightExpression, type),
+		.leftExpression = leftExpression,
+		.rightExpression = rightExpression
+	};
+	return appendExpression(abstractSyntaxTree, expression);
 }
 
-Expression * FactorExpressionSemanticAction(Factor * factor) {
+ExpressionIndex ExpressionFactorSemanticAction(CompilerState * compilerState, ExpressionIndex expression) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	Expression * expression = malloc(sizeof(Expression));
-	expression->factor = factor;
-	expression->leftExpression = NULL;
-	expression->rightExpression = NULL;
-	expression->type = FACTOR_EXP;
-	return expression;
+	const Expression factor = {
+		.type = PARENTHESIZED_EXP,
+		.varType = getExpressionType(compilerState, expression),
+		.expression = expression
+	};
+	return appendExpression(compilerState->abstractSyntaxtTree, factor);
 }
 
-Factor * ConstantFactorSemanticAction(Constant * constant) {
+ExpressionIndex DeclarationFactorSemanticAction(CompilerState * compilerState, char * varName) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	Factor * factor = malloc(sizeof(Factor));
-	factor->constant = constant;
-	factor->expression = NULL;
-	factor->varName = NULL;
-	factor->type = CONSTANT_FACTOR;
-	return factor;
+	// An undeclared variable is reported later, but it's typed as an integer.
+	struct key key = {
+		.varname = varName
+	};
+	struct value value;
+	const Expression factor = {
+		.type = VARIABLE_EXP,
+		.varType = symbolTableFind(compilerState->symbolTable, &key, &value) ? value.type : INT_VAR,
+		.varName = varName
+	};
+	return appendExpression(compilerState->abstractSyntaxtTree, factor);
 }
 
-Factor * ExpressionFactorSemanticAction(Expression * expression) {
+void ProgramSemanticAction(CompilerState * compilerState, StatementIndex statementList) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	Factor * factor = malloc(sizeof(Factor));
-	factor->expression = expression;
-	factor->constant = NULL;
-	factor->varName = NULL;
-	factor->type = EXPRESSION_FACTOR;
-	return factor;
+	validateUsedSymbols(compilerState, 0);
+	AbstractSyntaxTree * abstractSyntaxTree = compilerState->abstractSyntaxtTree;
+	abstractSyntaxTree->program = statementList;
+	if (0 < flexCurrentContext(compilerState->scanner)) {
+		logError(_logger, "The final context is not the default (0): %d", flexCurrentContext(compilerState->scanner));
+		compilerState->succeed = false;
+	}
+	else if (abstractSyntaxTree->exhausted) {
+		logError(_logger, "The AST is incomplete, because there is no memory left.");
+		compilerState->succeed = false;
+	}
+	else if (0 < compilerState->semanticErrors) {
+		logError(_logger, "The program has %u semantic error(s).", compilerState->semanticErrors);
+		compilerState->succeed = false;
+	}
+	else {
+		compilerState->succeed = true;
+	}
 }
 
-Factor * DeclarationFactorSemanticAction(char * varName) {
+StatementList StatementListSemanticAction(CompilerState * compilerState, StatementIndex statement) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	Factor * factor = malloc(sizeof(Factor));
-	factor->varName = varName;
-	factor->expression = NULL;
-	factor->constant = NULL;
-	factor->type = DECLARATION_FACTOR;
-	return factor;
+	const StatementList statementList = {
+		.first = statement,
+		.last = statement
+	};
+	return statementList;
 }
 
-Program * ProgramSemanticAction(CompilerState * compilerState, StatementList statementList) {
+StatementList AppendStatementSemanticAction(CompilerState * compilerState, StatementList statementList, StatementIndex statement) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	validateUsedSymbols();
-	free(usedSymbols);
-	free(usedSymbolsExpectedType);
-	Program * program = malloc(sizeof(Program));
-	program->statements = statementList;
-	compilerState->abstractSyntaxtTree = program;
-	if (0 < flexCurrentContext()) {
-		logError(_logger, "The final context is not the default (0): %d", flexCurrentContext());
-		compilerState->succeed = false;
-	}
-	else {
-		compilerState->succeed = true;
+	AbstractSyntaxTree * abstractSyntaxTree = compilerState->abstractSyntaxtTree;
+	if (statement != NO_NODE) {
+		if (statementList.first == NO_NODE) {
+			statementList.first = statement;
+		}
+		else {
+			abstractSyntaxTree->statements[statementList.last].next = statement;
+		}
+		statementList.last = statement;
 	}
-	return program;
+	return statementList;
 }
 
-StatementList StatementListSemanticAction(Statement *statement, StatementList next) {
+void BeginScopeSemanticAction(CompilerState * compilerState) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-    StatementList new = malloc(sizeof(struct StatementNode));
-    new->statement = statement;
-    new->next = next;
-    return new;
+	_beginScope(compilerState);
 }
 
-Statement * StatementSemanticAction(void *statement, StatementType type) {
+StatementIndex BlockSemanticAction(CompilerState * compilerState, StatementList statementList) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	Statement * new = calloc(1, sizeof(Statement));
-	new->type = type;
-    switch (type) {
-        case IF_STATEMENT: new->ifStatement = statement; break;
-        case FOR_STATEMENT: new->forStatement = statement; break;
-        case ASSIGNMENT_STATEMENT: new->assignment = statement; break;
-        case DECLARATION_STATEMENT: new->declaration = statement; break;
-        case FUNCTION_CALL_STATEMENT: new->functionCall = statement; break;
-		case ITERATE_STATEMENT: new->iterateStatement = statement; break;
-    }
+	_endScope(compilerState);
+	return statementList.first;
+}
 
-    return new;
+StatementIndex FunctionCallStatementSemanticAction(CompilerState * compilerState, FunctionCallIndex functionCall) {
+	_logSyntacticAnalyzerAction(__FUNCTION__);
+	const Statement statement = {
+		.type = FUNCTION_CALL_STATEMENT,
+		.next = NO_NODE,
+		.functionCall = functionCall
+	};
+	return appendStatement(compilerState->abstractSyntaxtTree, statement);
 }
 
-IfStatement *IfStatementSemanticAction(Expression *cond, Block *if_block, Block *else_block) {
+StatementIndex IfStatementSemanticAction(CompilerState * compilerState, ExpressionIndex cond, StatementIndex if_block, StatementIndex else_block) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
 
-	if(getExpressionType(cond) != BOOL_VAR){
-		logError(_logger, "Condition must be a boolean expression");
-		exit(1);
+	if(getExpressionType(compilerState, cond) != BOOL_VAR){
+		_semanticError(compilerState, "Condition must be a boolean expression");
 	}
 
     IfStatementType type = IF_ELSE_TYPE;
-    if (else_block == NULL) {
+    if (else_block == NO_NODE) {
         type = IF_TYPE;
     }
 
-    IfStatement * new = malloc(sizeof(IfStatement));
-    new->type = type;
-    new->condition = cond;
-    new->blockIf = if_block;
-    new->blockElse = else_block;
-    return new;
+	const Statement statement = {
+		.type = IF_STATEMENT,
+		.next = NO_NODE,
+		.ifStatement = {
+			.type = type,
+			.condition = cond,
+			.blockIf = if_block,
+			.blockElse = else_block
+		}
+	};
+	return appendStatement(compilerState->abstractSyntaxtTree, statement);
 }
 
-ForStatement *ForStatementSemanticAction(char *varName, RangeExpression *range, Block *block) {
+void ForHeaderSemanticAction(CompilerState * compilerState, char *varName) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	SymbolTableDeclareAux(varName, INT_DECLARATION, true);
-	ForStatement * new = malloc(sizeof(ForStatement));
-	new->varName = varName;
-	new->range = range;
-	new->block = block;
-	return new;
+	// The variable of the loop lives in its own scope, around the block.
+	_beginScope(compilerState);
+	SymbolTableDeclareAux(compilerState, varName, INT_DECLARATION, true);
 }
 
-RangeExpression *RangeExpressionSemanticAction(Expression *start, Expression *end) {
+StatementIndex ForStatementSemanticAction(CompilerState * compilerState, char *varName, RangeExpression range, StatementIndex block) {
+	_logSyntacticAnalyzerAction(__FUNCTION__);
+	_endScope(compilerState);
+	const Statement statement = {
+		.type = FOR_STATEMENT,
+		.next = NO_NODE,
+		.forStatement = {
+			.varName = varName,
+			.range = range,
+			.block = block
+		}
+	};
+	return appendStatement(compilerState->abstractSyntaxtTree, statement);
+}
+
+RangeExpression RangeExpressionSemanticAction(CompilerState * compilerState, ExpressionIndex start, ExpressionIndex end) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);	
 
-	if((start != NULL && getExpressionType(start) != INT_VAR) || (end && getExpressionType(end) != INT_VAR)){
-		logError(_logger, "Invalid parameters type");
-		exit(1);
+	if((start != NO_NODE && getExpressionType(compilerState, start) != INT_VAR) || (end != NO_NODE && getExpressionType(compilerState, end) != INT_VAR)){
+		_semanticError(compilerState, "Invalid parameters type");
 	}
 
-	RangeExpression * new = malloc(sizeof(RangeExpression));
-	new->expressionLeft = start;
-	new->expressionRight = end;
-	return new;
-}
-
-Block *BlockSemanticAction(StatementList statementList) {
-	_logSyntacticAnalyzerAction(__FUNCTION__);
-	Block * new = malloc(sizeof(Block));
-	new->statements = statementList;
-	return new;
+	const RangeExpression range = {
+		.expressionLeft = start,
+		.expressionRight = end
+	};
+	return range;
 }
 
-Assignment *AssignmentSemanticAction(char *varName, Expression *expression, FunctionCall *functionCall) {
+StatementIndex AssignmentSemanticAction(CompilerState * compilerState, char *varName, ExpressionIndex expression, FunctionCallIndex functionCall) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
 
 	struct key key = {
@@ -233,103 +358,103 @@ Assignment *AssignmentSemanticAction(char *varName, Expression *expression, Func
 
 	struct value value;
 
-	if(!symbolTableFind(&key, &value)){
-		logError(_logger, "Variable %s undeclared", varName);
-		exit(1);
+	if(!symbolTableFind(compilerState->symbolTable, &key, &value)){
+		_semanticError(compilerState, "Variable %s undeclared", varName);
 	}
-
-	if(value.type != INT_VAR && value.type != BOOL_VAR && value.type != EXP_VAR && value.type != AVL_VAR){
-		logError(_logger, "Variable %s is not an integer or boolean data type", varName);
-		exit(1);
+	else if(value.type != INT_VAR && value.type != BOOL_VAR && value.type != EXP_VAR && value.type != AVL_VAR){
+		_semanticError(compilerState, "Variable %s is not an integer or boolean data type", varName);
 	}
-
-	if(functionCall != NULL && getFunctionCallType(functionCall) != value.type){
-		logError(_logger, "Function return cannot be assigned to %s", varName);
-		exit(1);
+	else if(functionCall != NO_NODE && getFunctionCallType(compilerState, functionCall) != value.type){
+		_semanticError(compilerState, "Function return cannot be assigned to %s", varName);
 	}
-
 	//muere aca
-	if(expression != NULL && getExpressionType(expression) != value.type && value.type != EXP_VAR && value.type != AVL_VAR){
-		logError(_logger, "Expression cannot be assigned to %s", varName);
-		exit(1);
+	else if(expression != NO_NODE && getExpressionType(compilerState, expression) != value.type && value.type != EXP_VAR && value.type != AVL_VAR){
+		_semanticError(compilerState, "Expression cannot be assigned to %s", varName);
+	}
+	else {
+		value.metadata.hasValue = true;
+		symbolTableUpdate(compilerState->symbolTable, &key, &value);
 	}
 
-	value.metadata.hasValue = true;													// no esta funcionando creo
-	symbolTableInsert(&key, &value);
-	value.metadata.hasValue = true;
-
-	Assignment * new = malloc(sizeof(Assignment));
-	new->varName = varName;
-	new->expression = expression;
-	new->functionCall = functionCall;
-	return new;
+	const Statement statement = {
+		.type = ASSIGNMENT_STATEMENT,
+		.next = NO_NODE,
+		.assignment = {
+			.varName = varName,
+			.expression = expression,
+			.functionCall = functionCall
+		}
+	};
+	return appendStatement(compilerState->abstractSyntaxtTree, statement);
 }
 
-Declaration *DeclarationSemanticAction(char *varName, DeclarationType declarationType) {
+StatementIndex DeclarationSemanticAction(CompilerState * compilerState, char *varName, DeclarationType declarationType) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
-	VarType varType = SymbolTableDeclareAux(varName, declarationType, false);
-
-	Declaration * new = malloc(sizeof(Declaration));
-	new->varName = varName;
-	new->assignment = NULL;
-	new->type = varType;
-	return new;
+	VarType varType = SymbolTableDeclareAux(compilerState, varName, declarationType, false);
+
+	const Statement statement = {
+		.type = DECLARATION_STATEMENT,
+		.next = NO_NODE,
+		.declaration = {
+			.assignment = { .varName = varName, .expression = NO_NODE, .functionCall = NO_NODE },
+			.type = varType,
+			.hasAssignment = false
+		}
+	};
+	return appendStatement(compilerState->abstractSyntaxtTree, statement);
 }
 
-Declaration *BooleanDeclarationWithAssignmentSemanticAction(char *varName, Expression *expression, FunctionCall *functionCall){
+StatementIndex BooleanDeclarationWithAssignmentSemanticAction(CompilerState * compilerState, char *varName, ExpressionIndex expression, FunctionCallIndex functionCall){
 	_logSyntacticAnalyzerAction(__FUNCTION__);
 
-	VarType varType = SymbolTableDeclareAux(varName, BOOL_DECLARATION, true);
+	VarType varType = SymbolTableDeclareAux(compilerState, varName, BOOL_DECLARATION, true);
 
-	if(functionCall != NULL && getFunctionCallType(functionCall) != BOOL_VAR){
-		logError(_logger, "Function can not be assigned to %s", varName);
-		exit(1);	
+	if(functionCall != NO_NODE && getFunctionCallType(compilerState, functionCall) != BOOL_VAR){
+		_semanticError(compilerState, "Function can not be assigned to %s", varName);
 	}
 
-	if(expression != NULL && getExpressionType(expression) != BOOL_VAR){
-		logError(_logger, "Expression can not be assigned to %s", varName);
-		exit(1);
+	if(expression != NO_NODE && getExpressionType(compilerState, expression) != BOOL_VAR){
+		_semanticError(compilerState, "Expression can not be assigned to %s", varName);
 	}
 
-	Assignment * assignment = malloc(sizeof(Assignment));
-	assignment->varName = varName;
-	assignment->expression = expression;
-	assignment->functionCall = functionCall;
-
-	Declaration * new = malloc(sizeof(Declaration));
-	new->varName = varName;
-	new->assignment = assignment;
-	return new;
+	const Statement statement = {
+		.type = DECLARATION_STATEMENT,
+		.next = NO_NODE,
+		.declaration = {
+			.assignment = { .varName = varName, .expression = expression, .functionCall = functionCall },
+			.type = varType,
+			.hasAssignment = true
+		}
+	};
+	return appendStatement(compilerState->abstractSyntaxtTree, statement);
 }
 
-Declaration *IntegerDeclarationWithAssignmentSemanticAction(char *varName, Expression *expression, FunctionCall *functionCall) {
+StatementIndex IntegerDeclarationWithAssignmentSemanticAction(CompilerState * compilerState, char *varName, ExpressionIndex expression, FunctionCallIndex functionCall) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
 
-	VarType varType = SymbolTableDeclareAux(varName, INT_DECLARATION, true);
+	VarType varType = SymbolTableDeclareAux(compilerState, varName, INT_DECLARATION, true);
 
-	if(functionCall != NULL && getFunctionCallType(functionCall) != INT_VAR){
-		logError(_logger, "Function can not be assigned to %s", varName);
-		exit(1);
+	if(functionCall != NO_NODE && getFunctionCallType(compilerState, functionCall) != INT_VAR){
+		_semanticError(compilerState, "Function can not be assigned to %s", varName);
 	}
 
-	if(expression != NULL && getExpressionType(expression) != INT_VAR){
-		logError(_logger, "Expression can not be assigned to %s", varName);
-		exit(1);
+	if(expression != NO_NODE && getExpressionType(compilerState, expression) != INT_VAR){
+		_semanticError(compilerState, "Expression can not be assigned to %s", varName);
 	}
 
-	Assignment * assignment = malloc(sizeof(Assignment));
-	assignment->varName = varName;
-	assignment->expression = expression;
-	assignment->functionCall = functionCall;
-
-	Declaration * new = malloc(sizeof(Declaration));
-	new->varName = varName;
-	new->assignment = assignment;
-	new->type = varType;
-	return new;
+	const Statement statement = {
+		.type = DECLARATION_STATEMENT,
+		.next = NO_NODE,
+		.declaration = {
+			.assignment = { .varName = varName, .expression = expression, .functionCall = functionCall },
+			.type = varType,
+			.hasAssignment = true
+		}
+	};
+	return appendStatement(compilerState->abstractSyntaxtTree, statement);
 }
 
-FunctionCall *FunctionCallSemanticAction(char *varName, Expression *expression, FunctionCallType type) {
+FunctionCallIndex FunctionCallSemanticAction(CompilerState * compilerState, char *varName, ExpressionIndex expression, FunctionCallType type) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
 
 	struct key key = {
@@ -338,22 +463,17 @@ FunctionCall *FunctionCallSemanticAction(char *varName, Expression *expression,
 
 	struct value value;
 
-	if(!symbolTableFind(&key, &value)){
-		logError(_logger, "Variable %s undeclared", varName);
-		exit(1);
+	if(!symbolTableFind(compilerState->symbolTable, &key, &value)){
+		_semanticError(compilerState, "Variable %s undeclared", varName);
 	}
-
-	if (value.type != RBT_VAR && value.type != AVL_VAR && value.type != BST_VAR && value.type != EXP_VAR) {
-        logError(_logger, "Variable %s is not a tree type", varName);
-        exit(1);
+	else if (value.type != RBT_VAR && value.type != AVL_VAR && value.type != BST_VAR && value.type != EXP_VAR) {
+        _semanticError(compilerState, "Variable %s is not a tree type", varName);
     } else {
 		if (value.type == EXP_VAR && type != CALCULATE_CALL){
-			logError(_logger, "Variable %s is not a valid tree type", varName);
-        	exit(1);
+			_semanticError(compilerState, "Variable %s is not a valid tree type", varName);
 		}
 		if (value.type != EXP_VAR && type == CALCULATE_CALL){
-			logError(_logger, "Variable %s is not an expression tree type", varName);
-        	exit(1);
+			_semanticError(compilerState, "Variable %s is not an expression tree type", varName);
 		}
 
 		// if(value.metadata.hasValue == false && type != BST_VAR && type != ){
@@ -362,15 +482,15 @@ FunctionCall *FunctionCallSemanticAction(char *varName, Expression *expression,
 		// }
 	}
 
-	FunctionCall * new = malloc(sizeof(FunctionCall));
-    new->type = type;
-    new->varName = varName;
-    new->expression = expression;
-    new->declaration = NULL;
-    return new;
+	const FunctionCall functionCall = {
+		.varName = varName,
+		.type = type,
+		.expression = expression
+	};
+	return appendFunctionCall(compilerState->abstractSyntaxtTree, functionCall);
 }
 
-IterateStatement *IterateSemanticAction(char *varName, IteratorType type) {
+StatementIndex IterateSemanticAction(CompilerState * compilerState, char *varName, IteratorType type) {
 	_logSyntacticAnalyzerAction(__FUNCTION__);
 
 	struct key key = {
@@ -379,29 +499,30 @@ IterateStatement *IterateSemanticAction(char *varName, IteratorType type) {
 
 	struct value value;
 
-	if(!symbolTableFind(&key, &value)){
-		logError(_logger, "Variable %s undeclared", varName);
-		exit(1);
+	if(!symbolTableFind(compilerState->symbolTable, &key, &value)){
+		_semanticError(compilerState, "Variable %s undeclared", varName);
 	}
-
-	if (value.type != RBT_VAR && value.type != AVL_VAR && value.type != BST_VAR) {
-        logError(_logger, "Variable %s is not a tree type", varName);
-        exit(1);
+	else if (value.type != RBT_VAR && value.type != AVL_VAR && value.type != BST_VAR) {
+        _semanticError(compilerState, "Variable %s is not a tree type", varName);
     }
 
 	if(type != INORDER && type != POSTORDER && type != PREORDER){
-		logError(_logger, "Invalid order type");
-		exit(1);
+		_semanticError(compilerState, "Invalid order type");
 	}
 
 
-	IterateStatement * new = malloc(sizeof(IterateStatement));
-	new->varName = varName;
-	new->type = type;
-	return new;
+	const Statement statement = {
+		.type = ITERATE_STATEMENT,
+		.next = NO_NODE,
+		.iterateStatement = {
+			.varName = varName,
+			.type = type
+		}
+	};
+	return appendStatement(compilerState->abstractSyntaxtTree, statement);
 }
 
-static VarType SymbolTableDeclareAux(char *varname, DeclarationType type, bool hasValue){
+static VarType SymbolTableDeclareAux(CompilerState * compilerState, char *varname, DeclarationType type, bool hasValue){
 	VarType varType;
 	struct metadata metadata = {
 		.hasValue = hasValue
@@ -428,9 +549,9 @@ static VarType SymbolTableDeclareAux(char *varname, DeclarationType type, bool h
 		.varname = varname
 	};
 
-	if(symbolTableFind(&key, NULL)){
-		logError(_logger, "Invalid redeclaration of variable");
-		exit(1);
+	if(symbolTableFind(compilerState->symbolTable, &key, NULL)){
+		_semanticError(compilerState, "Invalid redeclaration of variable");
+		return varType;
 	}
 
 	struct value value = {
@@ -438,12 +559,13 @@ static VarType SymbolTableDeclareAux(char *varname, DeclarationType type, bool h
 		.metadata = metadata
 	};
 	
-	symbolTableInsert(&key, &value);
+	symbolTableInsert(compilerState->symbolTable, &key, &value);
 	return varType;
 }
 
-static int getFunctionCallType(FunctionCall *functionCall){
-	switch(functionCall->type){
+static int getFunctionCallType(CompilerState * compilerState, FunctionCallIndex functionCall){
+	AbstractSyntaxTree * abstractSyntaxTree = compilerState->abstractSyntaxtTree;
+	switch(abstractSyntaxTree->functionCalls[functionCall].type){
 		case HEIGHT_CALL:
 		case DEPTH_CALL:
 			return INT_VAR;
@@ -454,87 +576,93 @@ static int getFunctionCallType(FunctionCall *functionCall){
 	}
 }
 
-static int getExpressionType(Expression *expression){
-	struct key key;
-	struct value value;
-	switch (expression->type){
+/**
+ * Returns the type of an expression, resolved when its node was built.
+ */
+static VarType getExpressionType(CompilerState * compilerState, ExpressionIndex index){
+	AbstractSyntaxTree * abstractSyntaxTree = compilerState->abstractSyntaxtTree;
+	return abstractSyntaxTree->expressions[index].varType;
+}
+
+/**
+ * Infers the type of an operation from the types of its operands, which are
+ * already resolved, so it takes constant time (instead of walking the whole
+ * subtree).
+ */
+static VarType _inferOperationType(CompilerState * compilerState, ExpressionIndex leftExpression, ExpressionIndex rightExpression, ExpressionType type){
+	VarType leftType = getExpressionType(compilerState, leftExpression);
+	VarType rightType = getExpressionType(compilerState, rightExpression);
+	switch (type){
 		case ADDITION_EXP:
 		case SUBTRACTION_EXP:
 		case MULTIPLICATION_EXP:
 		case DIVISION_EXP:
 		case MODULE_EXP:
-			return (getExpressionType(expression->leftExpression) == INT_VAR && getExpressionType(expression->rightExpression) == INT_VAR) ? INT_VAR : -1;
+			return (leftType == INT_VAR && rightType == INT_VAR) ? INT_VAR : INVALID_VAR;
 		case AND_EXP:
-		case OR_EXP:	
-			return (getExpressionType(expression->leftExpression) == BOOL_VAR && getExpressionType(expression->rightExpression) == BOOL_VAR) ? BOOL_VAR : -1;
+		case OR_EXP:
+			return (leftType == BOOL_VAR && rightType == BOOL_VAR) ? BOOL_VAR : INVALID_VAR;
 		case NOT_EXP:
-			return getExpressionType(expression->leftExpression) == BOOL_VAR ? BOOL_VAR : -1;
+			return leftType == BOOL_VAR ? BOOL_VAR : INVALID_VAR;
 		case EQUAL_EXP:
 		case NOT_EQUAL_EXP:
 		case LESS_EQUAL_EXP:
 		case LESS_EXP:
 		case GREATER_EQUAL_EXP:
 		case GREATER_EXP:
-			return (getExpressionType(expression->leftExpression) == getExpressionType(expression->rightExpression)) ? BOOL_VAR : -1;
-		case FACTOR_EXP:
-			switch(expression->factor->type){
-				case CONSTANT_FACTOR:
-					return expression->factor->constant->type == INT_CONSTANT ? INT_VAR : BOOL_VAR;
-				case EXPRESSION_FACTOR: 
-					return getExpressionType(expression->factor->expression);
-				case DECLARATION_FACTOR:
-					key.varname = expression->factor->varName;
-					if(!symbolTableFind(&key, &value)){
-						return INT_VAR;
-					}
-					return value.type;
-				default:
-					logError(_logger, "Invalid factor type");
-					exit(1);
-			}
-		default: 
-			logError(_logger, "Invalid expression type");
-			exit(1);
-	}
-}
-
-static void AddUsedSymbol(char *varname, VarType expectedType){
-	struct key key = {.varname = varname};
-
-    for (int i = 0; i < usedSymbolsCount; i++) {
-        if (strcmp(usedSymbols[i].varname, varname) == 0) {
-            if (usedSymbolsExpectedType[i] != expectedType) {
-                logError(_logger, "Variable %s conflicting types", varname);
-                exit(1);
-            }
-            return;
-        }
-    }
+			return (leftType == rightType) ? BOOL_VAR : INVALID_VAR;
+		default:
+			_semanticError(compilerState, "Invalid expression type");
+			return INVALID_VAR;
+	}
+}
 
-    if (usedSymbolsCount == 0) {
-        usedSymbols = malloc(sizeof(struct key));
-        usedSymbolsExpectedType = malloc(sizeof(VarType));
-    } else if (usedSymbolsCount % 10 == 0) {
-        usedSymbols = realloc(usedSymbols, sizeof(struct key) * (usedSymbolsCount + 10));
-        usedSymbolsExpectedType = realloc(usedSymbolsExpectedType, sizeof(VarType) * (usedSymbolsCount + 10));
-    }
+static void AddUsedSymbol(CompilerState * compilerState, char *varname, VarType expectedType){
+	UsedSymbols * usedSymbols = compilerState->usedSymbols;
+	struct key key = {.varname = varname};
 
-    printf("Adding %s\n", varname);
+	int index;
+	if (hashMapFind(usedSymbols->indices, &key, &index)) {
+		if (usedSymbols->expectedTypes[index] != expectedType) {
+			_semanticError(compilerState, "Variable %s conflicting types", varname);
+		}
+		return;
+	}
 
-    usedSymbols[usedSymbolsCount] = key;
-    usedSymbolsExpectedType[usedSymbolsCount++] = expectedType;
+	if (usedSymbols->count == usedSymbols->capacity) {
+		const int capacity = usedSymbols->capacity == 0 ? 64 : 2 * usedSymbols->capacity;
+		struct key * symbols = realloc(usedSymbols->symbols, sizeof(struct key) * capacity);
+		if (symbols != NULL) {
+			usedSymbols->symbols = symbols;
+		}
+		VarType * expectedTypes = realloc(usedSymbols->expectedTypes, sizeof(VarType) * capacity);
+		if (expectedTypes != NULL) {
+			usedSymbols->expectedTypes = expectedTypes;
+		}
+		if (symbols == NULL || expectedTypes == NULL) {
+			logCritical(_logger, "Cannot allocate %d used symbols.", capacity);
+			return;
+		}
+		usedSymbols->capacity = capacity;
+	}
 
-    printf("Added %s\n", usedSymbols[usedSymbolsCount - 1].varname);
+	usedSymbols->symbols[usedSymbols->count] = key;
+	usedSymbols->expectedTypes[usedSymbols->count] = expectedType;
+	hashMapInsertOrUpdate(usedSymbols->indices, &key, &usedSymbols->count);
+	usedSymbols->count++;
 }
 
-static void validateUsedSymbols() {
-	int found = 0;
-    for (int i = 0; i < usedSymbolsCount; i++) {
-        struct key key = usedSymbols[i];
-        struct value value;
-        if (!symbolTableFind(&key, &value)) {
-            logError(_logger, "Variable %s undeclared", key.varname);
-            exit(1);
-        }
-    }
-}
\ No newline at end of file
+/**
+ * Validates the symbols used since the given one, and forgets them.
+ */
+static void validateUsedSymbols(CompilerState * compilerState, int first) {
+	UsedSymbols * usedSymbols = compilerState->usedSymbols;
+	for (int i = first; i < usedSymbols->count; i++) {
+		struct key key = usedSymbols->symbols[i];
+		if (!symbolTableFind(compilerState->symbolTable, &key, NULL)) {
+			_semanticError(compilerState, "Variable %s undeclared", key.varname);
+		}
+		hashMapRemove(usedSymbols->indices, &key);
+	}
+	usedSymbols->count = first;
+}
@@ -15,35 +15,48 @@ void initializeBisonActionsModule();
 /** Shutdown module's internal state. */
 void shutdownBisonActionsModule();
 
+/**
+ * Creates the per-compilation state of the semantic actions (i.e., the symbol
+ * table and the used symbols), which must exist during the whole parsing.
+ */
+void beginSemanticAnalysis(CompilerState * compilerState);
+
+/**
+ * Releases the per-compilation state of the semantic actions.
+ */
+void endSemanticAnalysis(CompilerState * compilerState);
+
 /**
  * Bison semantic actions.
  */
 
-Constant * IntegerConstantSemanticAction(const int value);
-Constant * BooleanConstantSemanticAction(const bool value);
-Expression * ArithmeticExpressionSemanticAction(Expression * leftExpression, Expression * rightExpression, ExpressionType type);
-Expression * FactorExpressionSemanticAction(Factor * factor);
-Factor * ConstantFactorSemanticAction(Constant * constant);
-Factor * ExpressionFactorSemanticAction(Expression * expression);
-Factor * DeclarationFactorSemanticAction(char * varname);
-Program * ProgramSemanticAction(CompilerState * compilerState, StatementList statementList);
-StatementList StatementListSemanticAction(Statement *statement, StatementList next);
-Statement * StatementSemanticAction(void *statement, StatementType type);
-IfStatement *IfStatementSemanticAction(Expression *cond, Block *if_block, Block *else_block);
-ForStatement *ForStatementSemanticAction(char *varName, RangeExpression *range, Block *block);
-RangeExpression *RangeExpressionSemanticAction(Expression *start, Expression *end);
-Block *BlockSemanticAction(StatementList statementList);
-Assignment *AssignmentSemanticAction(char *varName, Expression *expression, FunctionCall *functionCall);
-Declaration *DeclarationSemanticAction(char *varName, DeclarationType declarationType);
-Declaration *IntegerDeclarationWithAssignmentSemanticAction(char *varName, Expression *expression, FunctionCall *functionCall);
-Declaration *BooleanDeclarationWithAssignmentSemanticAction(char *varName, Expression *expression, FunctionCall *functionCall);
-FunctionCall *FunctionCallSemanticAction(char *varName, Expression *expression, FunctionCallType type);
-IterateStatement *IterateSemanticAction(char *varName, IteratorType type);
-
-static VarType SymbolTableDeclareAux(char *varname, DeclarationType type, bool hasValue);
-static int getExpressionType(Expression *expression);
-static int getFunctionCallType(FunctionCall *functionCall);
-static void AddUsedSymbol(char *varname, VarType expectedType);
-static void validateUsedSymbols();
+ExpressionIndex IntegerConstantSemanticAction(CompilerState * compilerState, const int value);
+ExpressionIndex BooleanConstantSemanticAction(CompilerState * compilerState, const bool value);
+ExpressionIndex ArithmeticExpressionSemanticAction(CompilerState * compilerState, ExpressionIndex leftExpression, ExpressionIndex rightExpression, ExpressionType type);
+ExpressionIndex ExpressionFactorSemanticAction(CompilerState * compilerState, ExpressionIndex expression);
+ExpressionIndex DeclarationFactorSemanticAction(CompilerState * compilerState, char * varname);
+void ProgramSemanticAction(CompilerState * compilerState, StatementIndex statementList);
+StatementList StatementListSemanticAction(CompilerState * compilerState, StatementIndex statement);
+StatementList AppendStatementSemanticAction(CompilerState * compilerState, StatementList statementList, StatementIndex statement);
+void BeginScopeSemanticAction(CompilerState * compilerState);
+StatementIndex BlockSemanticAction(CompilerState * compilerState, StatementList statementList);
+StatementIndex FunctionCallStatementSemanticAction(CompilerState * compilerState, FunctionCallIndex functionCall);
+StatementIndex IfStatementSemanticAction(CompilerState * compilerState, ExpressionIndex cond, StatementIndex if_block, StatementIndex else_block);
+void ForHeaderSemanticAction(CompilerState * compilerState, char *varName);
+StatementIndex ForStatementSemanticAction(CompilerState * compilerState, char *varName, RangeExpression range, StatementIndex block);
+RangeExpression RangeExpressionSemanticAction(CompilerState * compilerState, ExpressionIndex start, ExpressionIndex end);
+StatementIndex AssignmentSemanticAction(CompilerState * compilerState, char *varName, ExpressionIndex expression, FunctionCallIndex functionCall);
+StatementIndex DeclarationSemanticAction(CompilerState * compilerState, char *varName, DeclarationType declarationType);
+StatementIndex IntegerDeclarationWithAssignmentSemanticAction(CompilerState * compilerState, char *varName, ExpressionIndex expression, FunctionCallIndex functionCall);
+StatementIndex BooleanDeclarationWithAssignmentSemanticAction(CompilerState * compilerState, char *varName, ExpressionIndex expression, FunctionCallIndex functionCall);
+FunctionCallIndex FunctionCallSemanticAction(CompilerState * compilerState, char *varName, ExpressionIndex expression, FunctionCallType type);
+StatementIndex IterateSemanticAction(CompilerState * compilerState, char *varName, IteratorType type);
+
+static VarType SymbolTableDeclareAux(CompilerState * compilerState, char *varname, DeclarationType type, bool hasValue);
+static VarType getExpressionType(CompilerState * compilerState, ExpressionIndex expression);
+static VarType _inferOperationType(CompilerState * compilerState, ExpressionIndex leftExpression, ExpressionIndex rightExpression, ExpressionType type);
+static int getFunctionCallType(CompilerState * compilerState, FunctionCallIndex functionCall);
+static void AddUsedSymbol(CompilerState * compilerState, char *varname, VarType expectedType);
+static void validateUsedSymbols(CompilerState * compilerState, int first);
 
 #endif
@@ -2,8 +2,34 @@
 
 #include "BisonActions.h"
 
+/**
+ * Deeply nested expressions and blocks need a deep parser stack, which lives
+ * in heap-memory, and only grows as needed. The statement lists are
+ * left-recursive, so their length never counts.
+ *
+ * @see https://www.gnu.org/software/bison/manual/html_node/Memory-Management.html
+ */
+#define YYMAXDEPTH 10000000
+
 %}
 
+%code requires {
+
+#include "../../shared/CompilerState.h"
+
+}
+
+/**
+ * Generate a pure (i.e., reentrant) parser, which receives the scanner and the
+ * state of the compilation, instead of relying on global variables.
+ *
+ * @see https://www.gnu.org/software/bison/manual/html_node/Pure-Decl.html
+ * @see https://www.gnu.org/software/bison/manual/html_node/Pure-Calling.html
+ */
+%define api.pure full
+%lex-param {void * scanner}
+%parse-param {void * scanner} {CompilerState * compilerState}
+
 %define api.value.union.name SemanticValue
 
 %union {
@@ -14,23 +40,13 @@
 	char * varname;
     bool boolean;
 
-	/** Non-terminals. */
+	/** Non-terminals (i.e., indices of the nodes of the AST). */
 
-	Constant * constant;
-	Expression * expression;
-	Factor * factor;
-	Program * program;
-	
+	ExpressionIndex expression;
+	FunctionCallIndex function_call;
+	StatementIndex statement;
 	StatementList statement_list;
-	Statement * statement;
-	ForStatement * for_statement;
-	IfStatement * if_statement;
-	RangeExpression * range_expression;
-	Declaration * declaration;
-	FunctionCall * function_call;
-	Assignment * assignment;
-	Block * block;
-	IterateStatement * iterator_statement;
+	RangeExpression range_expression;
 }
 
 /**
@@ -108,21 +124,20 @@
 %token <token> UNKNOWN
 
 /** Non-terminals. */
-%type <constant> constant
+%type <expression> constant
 %type <expression> expression
-%type <factor> factor
-%type <program> program
+%type <expression> factor
 
 %type <statement_list> statement_list
 %type <statement> statement
-%type <for_statement> for_statement
-%type <if_statement> if_statement
+%type <statement> for_statement
+%type <statement> if_statement
 %type <range_expression> range_expression
-%type <declaration> declaration
+%type <statement> declaration
 %type <function_call> function_call
-%type <assignment> assignment
-%type <block> block
-%type <iterator_statement> iterator_statement
+%type <statement> assignment
+%type <statement> block
+%type <statement> iterator_statement
 
 /**
  * Precedence and associativity.
@@ -142,89 +157,91 @@
 
 %%
 
-program: statement_list												{ $$ = ProgramSemanticAction(currentCompilerState(), $1); }
+program: statement_list												{ ProgramSemanticAction(compilerState, $1.first); }
 	;
 
-statement_list: statement statement_list							{ $$ = StatementListSemanticAction($1, $2); }
-	| statement														{ $$ = StatementListSemanticAction($1, NULL); }									
+statement_list: statement_list statement							{ $$ = AppendStatementSemanticAction(compilerState, $1, $2); }
+	| statement														{ $$ = StatementListSemanticAction(compilerState, $1); }									
 	;
 
-statement: if_statement												{ $$ = StatementSemanticAction($1, IF_STATEMENT); }
-	| for_statement													{ $$ = StatementSemanticAction($1, FOR_STATEMENT); }
-	| declaration													{ $$ = StatementSemanticAction($1, DECLARATION_STATEMENT); }
-	| assignment													{ $$ = StatementSemanticAction($1, ASSIGNMENT_STATEMENT); }
-	| function_call													{ $$ = StatementSemanticAction($1, FUNCTION_CALL_STATEMENT); }
-	| iterator_statement 											{ $$ = StatementSemanticAction($1, ITERATE_STATEMENT); }
+statement: if_statement												{ $$ = $1; }
+	| for_statement													{ $$ = $1; }
+	| declaration													{ $$ = $1; }
+	| assignment													{ $$ = $1; }
+	| function_call													{ $$ = FunctionCallStatementSemanticAction(compilerState, $1); }
+	| iterator_statement 											{ $$ = $1; }
 	;
 
-block: OPEN_BRACKET statement_list[stat] CLOSE_BRACKET 				{ $$ = BlockSemanticAction($stat); }
+block: OPEN_BRACKET														{ BeginScopeSemanticAction(compilerState); }
+		statement_list[stat] CLOSE_BRACKET 							{ $$ = BlockSemanticAction(compilerState, $stat); }
 	;
 
-if_statement: IF OPEN_PARENTHESIS expression[exp] CLOSE_PARENTHESIS block[if] ELSE block[else]		{ $$ = IfStatementSemanticAction($exp, $if, $else); }
-	| IF OPEN_PARENTHESIS expression[exp] CLOSE_PARENTHESIS block[bl]								{ $$ = IfStatementSemanticAction($exp, $bl, NULL); }
+if_statement: IF OPEN_PARENTHESIS expression[exp] CLOSE_PARENTHESIS block[if] ELSE block[else]		{ $$ = IfStatementSemanticAction(compilerState, $exp, $if, $else); }
+	| IF OPEN_PARENTHESIS expression[exp] CLOSE_PARENTHESIS block[bl]								{ $$ = IfStatementSemanticAction(compilerState, $exp, $bl, NO_NODE); }
 	;
 	
-for_statement: FOR DECLARATION[dec] IN range_expression[range] block[bl]							{ $$ = ForStatementSemanticAction($dec, $range, $bl); }
+for_statement: FOR DECLARATION[dec] IN range_expression[range]		{ ForHeaderSemanticAction(compilerState, $dec); }
+		block[bl]													{ $$ = ForStatementSemanticAction(compilerState, $dec, $range, $bl); }
 	;
 
-range_expression: OPEN_PARENTHESIS expression[left] TO expression[right] CLOSE_PARENTHESIS			{ $$ = RangeExpressionSemanticAction($left, $right); }
+range_expression: OPEN_PARENTHESIS expression[left] TO expression[right] CLOSE_PARENTHESIS			{ $$ = RangeExpressionSemanticAction(compilerState, $left, $right); }
 	;
 
-function_call: DECLARATION[dec] INSERT expression[exp]				{ $$ = FunctionCallSemanticAction($dec, $exp, INSERT_CALL); }
-	| DECLARATION[dec] REMOVE expression[exp]						{ $$ = FunctionCallSemanticAction($dec, $exp, REMOVE_CALL); }
-	| DECLARATION[dec] INCLUDES expression[exp]						{ $$ = FunctionCallSemanticAction($dec, $exp, INCLUDES_CALL); }
-	| DECLARATION[dec] HEIGHT 										{ $$ = FunctionCallSemanticAction($dec, NULL, HEIGHT_CALL); }
-	| DECLARATION[dec] DEPTH expression[exp]						{ $$ = FunctionCallSemanticAction($dec, $exp, DEPTH_CALL); }
-	| DECLARATION[dec] CALCULATE expression[exp]					{ $$ = FunctionCallSemanticAction($dec, $exp, CALCULATE_CALL); }	
-	| DECLARATION[dec] VISUALIZE									{ $$ = FunctionCallSemanticAction($dec, NULL, VISUALIZE_CALL); }
-	/* | DECLARATION[dec] ADD DECLARATION								{ $$ = FunctionCallSemanticAction($dec, NULL, ADD_CALL); }
-	| DECLARATION[dec] SUB DECLARATION								{ $$ = FunctionCallSemanticAction($dec, NULL, SUB_CALL); } */
+function_call: DECLARATION[dec] INSERT expression[exp]				{ $$ = FunctionCallSemanticAction(compilerState, $dec, $exp, INSERT_CALL); }
+	| DECLARATION[dec] REMOVE expression[exp]						{ $$ = FunctionCallSemanticAction(compilerState, $dec, $exp, REMOVE_CALL); }
+	| DECLARATION[dec] INCLUDES expression[exp]						{ $$ = FunctionCallSemanticAction(compilerState, $dec, $exp, INCLUDES_CALL); }
+	| DECLARATION[dec] HEIGHT 										{ $$ = FunctionCallSemanticAction(compilerState, $dec, NO_NODE, HEIGHT_CALL); }
+	| DECLARATION[dec] DEPTH expression[exp]						{ $$ = FunctionCallSemanticAction(compilerState, $dec, $exp, DEPTH_CALL); }
+	| DECLARATION[dec] CALCULATE expression[exp]					{ $$ = FunctionCallSemanticAction(compilerState, $dec, $exp, CALCULATE_CALL); }	
+	| DECLARATION[dec] VISUALIZE									{ $$ = FunctionCallSemanticAction(compilerState, $dec, NO_NODE, VISUALIZE_CALL); }
+	/* | DECLARATION[dec] ADD DECLARATION								{ $$ = FunctionCallSemanticAction(compilerState, $dec, NO_NODE, ADD_CALL); }
+	| DECLARATION[dec] SUB DECLARATION								{ $$ = FunctionCallSemanticAction(compilerState, $dec, NO_NODE, SUB_CALL); } */
 	;
 
-iterator_statement: DECLARATION[dec] ITERATE IN_ORDER[order]		{ $$ = IterateSemanticAction($dec, $order); }
-	| DECLARATION[dec] ITERATE POST_ORDER[order]					{ $$ = IterateSemanticAction($dec, $order); }
-	| DECLARATION[dec] ITERATE PRE_ORDER[order] 					{ $$ = IterateSemanticAction($dec, $order); }
+iterator_statement: DECLARATION[dec] ITERATE IN_ORDER[order]		{ $$ = IterateSemanticAction(compilerState, $dec, $order); }
+	| DECLARATION[dec] ITERATE POST_ORDER[order]					{ $$ = IterateSemanticAction(compilerState, $dec, $order); }
+	| DECLARATION[dec] ITERATE PRE_ORDER[order] 					{ $$ = IterateSemanticAction(compilerState, $dec, $order); }
 	;
 
-declaration: RED_BLACK_TREE DECLARATION[dec]						{ $$ = DeclarationSemanticAction($dec, RBT_DECLARATION); }
-	| BINARY_SEARCH_TREE DECLARATION[dec]							{ $$ = DeclarationSemanticAction($dec, BST_DECLARATION); }
-	| EXPRESSION_TREE DECLARATION[dec]								{ $$ = DeclarationSemanticAction($dec, EXP_DECLARATION); }
-	| AVL_TREE DECLARATION[dec]										{ $$ = DeclarationSemanticAction($dec, AVL_DECLARATION); }
-	| INT_TYPE DECLARATION[dec] 									{ $$ = DeclarationSemanticAction($dec, INT_DECLARATION); }		
-	| BOOLEAN_TYPE DECLARATION[dec]									{ $$ = DeclarationSemanticAction($dec, BOOL_DECLARATION); }
-	/* | CONSTANT_TYPE DECLARATION[dec] ASSIGN expression[exp]			{ $$ = DeclarationWithAssignmentSemanticAction($dec, CONST_DECLARATION, $exp, NULL); }	 */
-	| INT_TYPE DECLARATION[dec] ASSIGN expression[exp]				{ $$ = IntegerDeclarationWithAssignmentSemanticAction($dec, $exp, NULL); }
-	| INT_TYPE DECLARATION[dec] ASSIGN function_call[fun]			{ $$ = IntegerDeclarationWithAssignmentSemanticAction($dec, NULL, $fun); }
-	| BOOLEAN_TYPE DECLARATION[dec] ASSIGN expression[exp]			{ $$ = BooleanDeclarationWithAssignmentSemanticAction($dec, $exp, NULL); }
-	| BOOLEAN_TYPE DECLARATION[dec]	ASSIGN function_call[fun]		{ $$ = BooleanDeclarationWithAssignmentSemanticAction($dec, NULL, $fun); } 
+declaration: RED_BLACK_TREE DECLARATION[dec]						{ $$ = DeclarationSemanticAction(compilerState, $dec, RBT_DECLARATION); }
+	| BINARY_SEARCH_TREE DECLARATION[dec]							{ $$ = DeclarationSemanticAction(compilerState, $dec, BST_DECLARATION); }
+	| EXPRESSION_TREE DECLARATION[dec]								{ $$ = DeclarationSemanticAction(compilerState, $dec, EXP_DECLARATION); }
+	| AVL_TREE DECLARATION[dec]										{ $$ = DeclarationSemanticAction(compilerState, $dec, AVL_DECLARATION); }
+	| INT_TYPE DECLARATION[dec] 									{ $$ = DeclarationSemanticAction(compilerState, $dec, INT_DECLARATION); }		
+	| BOOLEAN_TYPE DECLARATION[dec]									{ $$ = DeclarationSemanticAction(compilerState, $dec, BOOL_DECLARATION); }
+	/* | CONSTANT_TYPE DECLARATION[dec] ASSIGN expression[exp]			{ $$ = DeclarationWithAssignmentSemanticAction($dec, CONST_DECLARATION, $exp, NO_NODE); }	 */
+	| INT_TYPE DECLARATION[dec] ASSIGN expression[exp]				{ $$ = IntegerDeclarationWithAssignmentSemanticAction(compilerState, $dec, $exp, NO_NODE); }
+	| INT_TYPE DECLARATION[dec] ASSIGN function_call[fun]			{ $$ = IntegerDeclarationWithAssignmentSemanticAction(compilerState, $dec, NO_NODE, $fun); }
+	| BOOLEAN_TYPE DECLARATION[dec] ASSIGN expression[exp]			{ $$ = BooleanDeclarationWithAssignmentSemanticAction(compilerState, $dec, $exp, NO_NODE); }
+	| BOOLEAN_TYPE DECLARATION[dec]	ASSIGN function_call[fun]		{ $$ = BooleanDeclarationWithAssignmentSemanticAction(compilerState, $dec, NO_NODE, $fun); } 
 	;
 	
-assignment: DECLARATION[dec] ASSIGN expression[exp]					{ $$ = AssignmentSemanticAction($dec, $exp, NULL); }
-	| DECLARATION[dec] ASSIGN function_call[fun]					{ $$ = AssignmentSemanticAction($dec, NULL, $fun); }
+assignment: DECLARATION[dec] ASSIGN expression[exp]					{ $$ = AssignmentSemanticAction(compilerState, $dec, $exp, NO_NODE); }
+	| DECLARATION[dec] ASSIGN function_call[fun]					{ $$ = AssignmentSemanticAction(compilerState, $dec, NO_NODE, $fun); }
 	;
 
-expression: expression[left] MOD expression[right]					{ $$ = ArithmeticExpressionSemanticAction($left, $right, MODULE_EXP); }
-	| expression[left] AND expression[right]						{ $$ = ArithmeticExpressionSemanticAction($left, $right, AND_EXP);}
-	| expression[left] OR expression[right]							{ $$ = ArithmeticExpressionSemanticAction($left, $right, OR_EXP);}
-	| NOT expression[exp]											{ $$ = ArithmeticExpressionSemanticAction($exp , NULL, NOT_EXP);}
-	| expression[left] EQUAL expression[right]						{ $$ = ArithmeticExpressionSemanticAction($left, $right, EQUAL_EXP);}
-	| expression[left] NOT_EQUAL expression[right]					{ $$ = ArithmeticExpressionSemanticAction($left, $right, NOT_EQUAL_EXP);}
-	| expression[left] LESS expression[right]						{ $$ = ArithmeticExpressionSemanticAction($left, $right, LESS_EXP);}
-	| expression[left] LESS_EQUAL expression[right]					{ $$ = ArithmeticExpressionSemanticAction($left, $right, LESS_EQUAL_EXP);}
-	| expression[left] GREATER expression[right]					{ $$ = ArithmeticExpressionSemanticAction($left, $right, GREATER_EXP);}
-	| expression[left] GREATER_EQUAL expression[right]				{ $$ = ArithmeticExpressionSemanticAction($left, $right, GREATER_EQUAL_EXP);}
-	| expression[left] ADD expression[right]						{ $$ = ArithmeticExpressionSemanticAction($left, $right, ADDITION_EXP); }
-	| expression[left] DIV expression[right]						{ $$ = ArithmeticExpressionSemanticAction($left, $right, DIVISION_EXP); }
-	| expression[left] MUL expression[right]						{ $$ = ArithmeticExpressionSemanticAction($left, $right, MULTIPLICATION_EXP); }
-	| expression[left] SUB expression[right]						{ $$ = ArithmeticExpressionSemanticAction($left, $right, SUBTRACTION_EXP); }
-	| factor														{ $$ = FactorExpressionSemanticAction($1); }
+expression: expression[left] MOD expression[right]					{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, MODULE_EXP); }
+	| expression[left] AND expression[right]						{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, AND_EXP);}
+	| expression[left] OR expression[right]							{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, OR_EXP);}
+	| NOT expression[exp]											{ $$ = ArithmeticExpressionSemanticAction(compilerState, $exp, NO_NODE, NOT_EXP);}
+	| expression[left] EQUAL expression[right]						{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, EQUAL_EXP);}
+	| expression[left] NOT_EQUAL expression[right]					{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, NOT_EQUAL_EXP);}
+	| expression[left] LESS expression[right]						{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, LESS_EXP);}
+	| expression[left] LESS_EQUAL expression[right]					{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, LESS_EQUAL_EXP);}
+	| expression[left] GREATER expression[right]					{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, GREATER_EXP);}
+	| expression[left] GREATER_EQUAL expression[right]				{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, GREATER_EQUAL_EXP);}
+	| expression[left] ADD expression[right]						{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, ADDITION_EXP); }
+	| expression[left] DIV expression[right]						{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, DIVISION_EXP); }
+	| expression[left] MUL expression[right]						{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, MULTIPLICATION_EXP); }
+	| expression[left] SUB expression[right]						{ $$ = ArithmeticExpressionSemanticAction(compilerState, $left, $right, SUBTRACTION_EXP); }
+	| factor														{ $$ = $1; }
 	;
 
-factor: OPEN_PARENTHESIS expression CLOSE_PARENTHESIS				{ $$ = ExpressionFactorSemanticAction($2); }
-	| constant														{ $$ = ConstantFactorSemanticAction($1); }
-	| DECLARATION													{ $$ = DeclarationFactorSemanticAction($1); } 
+factor: OPEN_PARENTHESIS expression CLOSE_PARENTHESIS				{ $$ = ExpressionFactorSemanticAction(compilerState, $2); }
+	| constant														{ $$ = $1; }
+	| DECLARATION													{ $$ = DeclarationFactorSemanticAction(compilerState, $1); } 
 	;
 
-constant: INTEGER													{ $$ = IntegerConstantSemanticAction($1); }
-	| BOOLEAN														{ $$ = BooleanConstantSemanticAction($1); }
+constant: INTEGER													{ $$ = IntegerConstantSemanticAction(compilerState, $1); }
+	| BOOLEAN														{ $$ = BooleanConstantSemanticAction(compilerState, $1); }
 	;
@@ -0,0 +1,1780 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+
+
+#include "BisonActions.h"
+
+/**
+ * Deeply nested expressions and blocks need a deep parser stack, which lives
+ * in heap-memory, and only grows as needed. The statement lists are
+ * left-recursive, so their length never counts.
+ *
+ * @see https://www.gnu.org/software/bison/manual/html_node/Memory-Management.html
+ */
+#define YYMAXDEPTH 10000000
+
+
+#line 86 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "BisonParser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_INTEGER = 3,                    /* INTEGER  */
+  YYSYMBOL_ADD = 4,                        /* ADD  */
+  YYSYMBOL_SUB = 5,                        /* SUB  */
+  YYSYMBOL_DIV = 6,                        /* DIV  */
+  YYSYMBOL_MUL = 7,                        /* MUL  */
+  YYSYMBOL_MOD = 8,                        /* MOD  */
+  YYSYMBOL_OPEN_PARENTHESIS = 9,           /* OPEN_PARENTHESIS  */
+  YYSYMBOL_CLOSE_PARENTHESIS = 10,         /* CLOSE_PARENTHESIS  */
+  YYSYMBOL_OPEN_BRACKET = 11,              /* OPEN_BRACKET  */
+  YYSYMBOL_CLOSE_BRACKET = 12,             /* CLOSE_BRACKET  */
+  YYSYMBOL_RED_BLACK_TREE = 13,            /* RED_BLACK_TREE  */
+  YYSYMBOL_BINARY_SEARCH_TREE = 14,        /* BINARY_SEARCH_TREE  */
+  YYSYMBOL_EXPRESSION_TREE = 15,           /* EXPRESSION_TREE  */
+  YYSYMBOL_AVL_TREE = 16,                  /* AVL_TREE  */
+  YYSYMBOL_NOT_EQUAL = 17,                 /* NOT_EQUAL  */
+  YYSYMBOL_EQUAL = 18,                     /* EQUAL  */
+  YYSYMBOL_LESS_EQUAL = 19,                /* LESS_EQUAL  */
+  YYSYMBOL_LESS = 20,                      /* LESS  */
+  YYSYMBOL_GREATER_EQUAL = 21,             /* GREATER_EQUAL  */
+  YYSYMBOL_GREATER = 22,                   /* GREATER  */
+  YYSYMBOL_AND = 23,                       /* AND  */
+  YYSYMBOL_OR = 24,                        /* OR  */
+  YYSYMBOL_ASSIGN = 25,                    /* ASSIGN  */
+  YYSYMBOL_NOT = 26,                       /* NOT  */
+  YYSYMBOL_FOR = 27,                       /* FOR  */
+  YYSYMBOL_IN = 28,                        /* IN  */
+  YYSYMBOL_TO = 29,                        /* TO  */
+  YYSYMBOL_IF = 30,                        /* IF  */
+  YYSYMBOL_ELSE = 31,                      /* ELSE  */
+  YYSYMBOL_IN_ORDER = 32,                  /* IN_ORDER  */
+  YYSYMBOL_POST_ORDER = 33,                /* POST_ORDER  */
+  YYSYMBOL_PRE_ORDER = 34,                 /* PRE_ORDER  */
+  YYSYMBOL_INT_TYPE = 35,                  /* INT_TYPE  */
+  YYSYMBOL_CONSTANT_TYPE = 36,             /* CONSTANT_TYPE  */
+  YYSYMBOL_BOOLEAN_TYPE = 37,              /* BOOLEAN_TYPE  */
+  YYSYMBOL_INSERT = 38,                    /* INSERT  */
+  YYSYMBOL_REMOVE = 39,                    /* REMOVE  */
+  YYSYMBOL_INCLUDES = 40,                  /* INCLUDES  */
+  YYSYMBOL_HEIGHT = 41,                    /* HEIGHT  */
+  YYSYMBOL_DEPTH = 42,                     /* DEPTH  */
+  YYSYMBOL_CALCULATE = 43,                 /* CALCULATE  */
+  YYSYMBOL_VISUALIZE = 44,                 /* VISUALIZE  */
+  YYSYMBOL_ITERATE = 45,                   /* ITERATE  */
+  YYSYMBOL_DECLARATION = 46,               /* DECLARATION  */
+  YYSYMBOL_BOOLEAN = 47,                   /* BOOLEAN  */
+  YYSYMBOL_UNKNOWN = 48,                   /* UNKNOWN  */
+  YYSYMBOL_YYACCEPT = 49,                  /* $accept  */
+  YYSYMBOL_program = 50,                   /* program  */
+  YYSYMBOL_statement_list = 51,            /* statement_list  */
+  YYSYMBOL_statement = 52,                 /* statement  */
+  YYSYMBOL_block = 53,                     /* block  */
+  YYSYMBOL_54_1 = 54,                      /* $@1  */
+  YYSYMBOL_if_statement = 55,              /* if_statement  */
+  YYSYMBOL_for_statement = 56,             /* for_statement  */
+  YYSYMBOL_57_2 = 57,                      /* $@2  */
+  YYSYMBOL_range_expression = 58,          /* range_expression  */
+  YYSYMBOL_function_call = 59,             /* function_call  */
+  YYSYMBOL_iterator_statement = 60,        /* iterator_statement  */
+  YYSYMBOL_declaration = 61,               /* declaration  */
+  YYSYMBOL_assignment = 62,                /* assignment  */
+  YYSYMBOL_expression = 63,                /* expression  */
+  YYSYMBOL_factor = 64,                    /* factor  */
+  YYSYMBOL_constant = 65                   /* constant  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  36
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   237
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  49
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  17
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  59
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  109
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   303
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_uint8 yyrline[] =
+{
+       0,   160,   160,   163,   164,   167,   168,   169,   170,   171,
+     172,   175,   175,   179,   180,   183,   183,   187,   190,   191,
+     192,   193,   194,   195,   196,   201,   202,   203,   206,   207,
+     208,   209,   210,   211,   213,   214,   215,   216,   219,   220,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   240,   241,   242,   245,   246
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "INTEGER", "ADD",
+  "SUB", "DIV", "MUL", "MOD", "OPEN_PARENTHESIS", "CLOSE_PARENTHESIS",
+  "OPEN_BRACKET", "CLOSE_BRACKET", "RED_BLACK_TREE", "BINARY_SEARCH_TREE",
+  "EXPRESSION_TREE", "AVL_TREE", "NOT_EQUAL", "EQUAL", "LESS_EQUAL",
+  "LESS", "GREATER_EQUAL", "GREATER", "AND", "OR", "ASSIGN", "NOT", "FOR",
+  "IN", "TO", "IF", "ELSE", "IN_ORDER", "POST_ORDER", "PRE_ORDER",
+  "INT_TYPE", "CONSTANT_TYPE", "BOOLEAN_TYPE", "INSERT", "REMOVE",
+  "INCLUDES", "HEIGHT", "DEPTH", "CALCULATE", "VISUALIZE", "ITERATE",
+  "DECLARATION", "BOOLEAN", "UNKNOWN", "$accept", "program",
+  "statement_list", "statement", "block", "$@1", "if_statement",
+  "for_statement", "$@2", "range_expression", "function_call",
+  "iterator_statement", "declaration", "assignment", "expression",
+  "factor", "constant", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-76)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+      49,   -37,   -35,   -33,   -29,   -27,    11,   -23,   -19,    63,
+      24,    49,   -76,   -76,   -76,   -76,   -76,   -76,   -76,   -76,
+     -76,   -76,   -76,     4,     7,    12,    18,     9,     7,     7,
+       7,   -76,     7,     7,   -76,    -3,   -76,   -76,    27,   -76,
+       7,     7,   -76,   -76,   118,   -76,   -76,     9,     9,   186,
+     -76,   168,   168,   168,   168,   168,   168,   -76,   -76,   -76,
+       7,   -76,   139,   -76,     7,     7,     7,     7,     7,    41,
+       7,     7,     7,     7,     7,     7,     7,     7,   -76,   168,
+     -76,   168,    92,    41,   -76,   111,   111,   -76,   -76,   -76,
+     -76,    40,   215,   215,    62,    62,    62,    62,   196,   189,
+       7,   -76,    49,    41,   160,    45,   -76,   -76,   -76
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     2,     4,     5,     6,     9,    10,     7,     8,    28,
+      29,    30,    31,     0,     0,    32,    33,     0,     0,     0,
+       0,    21,     0,     0,    24,     0,     1,     3,     0,    58,
+       0,     0,    57,    59,     0,    54,    56,     0,     0,    57,
+      39,    38,    18,    19,    20,    22,    23,    25,    26,    27,
+       0,    15,     0,    43,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    35,    34,
+      37,    36,     0,     0,    55,    50,    53,    51,    52,    40,
+      11,    14,    45,    44,    47,    46,    49,    48,    41,    42,
+       0,    16,     0,     0,     0,     0,    13,    17,    12
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+     -76,   -76,   -25,   -11,   -75,   -76,   -76,   -76,   -76,   -76,
+     -22,   -76,   -76,   -76,   -26,   -76,   -76
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,    10,    11,    12,    91,   102,    13,    14,    83,    61,
+      15,    16,    17,    18,    44,    45,    46
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
+{
+      37,    51,    52,    53,    54,    50,    55,    56,   101,    19,
+      39,    20,    39,    21,    62,    63,    40,    22,    40,    23,
+      24,    79,    81,    25,    36,    78,    80,    26,   106,    57,
+      58,    59,    38,    41,    82,    41,    60,    47,    85,    86,
+      87,    88,    89,    48,    92,    93,    94,    95,    96,    97,
+      98,    99,    90,    42,    43,    49,    43,   108,     1,     2,
+       3,     4,     1,     2,     3,     4,    64,    65,    66,    67,
+      68,   103,     5,     0,   104,     6,     5,   105,     0,     6,
+       7,     0,     8,     0,     7,     0,     8,     0,    27,     0,
+       0,     9,     0,     0,    37,     9,    64,    65,    66,    67,
+      68,    28,    29,    30,    31,    32,    33,    34,    35,    70,
+      71,    72,    73,    74,    75,    76,    77,    66,    67,    68,
+       0,   100,    64,    65,    66,    67,    68,     0,    69,     0,
+       0,     0,     0,     0,     0,    70,    71,    72,    73,    74,
+      75,    76,    77,    64,    65,    66,    67,    68,     0,    84,
+       0,     0,     0,     0,     0,     0,    70,    71,    72,    73,
+      74,    75,    76,    77,    64,    65,    66,    67,    68,     0,
+     107,     0,    64,    65,    66,    67,    68,    70,    71,    72,
+      73,    74,    75,    76,    77,    70,    71,    72,    73,    74,
+      75,    76,    77,    64,    65,    66,    67,    68,     0,     0,
+      64,    65,    66,    67,    68,     0,    70,    71,    72,    73,
+      74,    75,    76,    70,    71,    72,    73,    74,    75,    64,
+      65,    66,    67,    68,    28,    29,    30,    31,    32,    33,
+      34,     0,     0,     0,    72,    73,    74,    75
+};
+
+static const yytype_int8 yycheck[] =
+{
+      11,    27,    28,    29,    30,    27,    32,    33,    83,    46,
+       3,    46,     3,    46,    40,    41,     9,    46,     9,    46,
+       9,    47,    48,    46,     0,    47,    48,    46,   103,    32,
+      33,    34,    28,    26,    60,    26,     9,    25,    64,    65,
+      66,    67,    68,    25,    70,    71,    72,    73,    74,    75,
+      76,    77,    11,    46,    47,    46,    47,    12,    13,    14,
+      15,    16,    13,    14,    15,    16,     4,     5,     6,     7,
+       8,    31,    27,    -1,   100,    30,    27,   102,    -1,    30,
+      35,    -1,    37,    -1,    35,    -1,    37,    -1,    25,    -1,
+      -1,    46,    -1,    -1,   105,    46,     4,     5,     6,     7,
+       8,    38,    39,    40,    41,    42,    43,    44,    45,    17,
+      18,    19,    20,    21,    22,    23,    24,     6,     7,     8,
+      -1,    29,     4,     5,     6,     7,     8,    -1,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,    17,    18,    19,    20,    21,
+      22,    23,    24,     4,     5,     6,     7,     8,    -1,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,    17,    18,    19,    20,
+      21,    22,    23,    24,     4,     5,     6,     7,     8,    -1,
+      10,    -1,     4,     5,     6,     7,     8,    17,    18,    19,
+      20,    21,    22,    23,    24,    17,    18,    19,    20,    21,
+      22,    23,    24,     4,     5,     6,     7,     8,    -1,    -1,
+       4,     5,     6,     7,     8,    -1,    17,    18,    19,    20,
+      21,    22,    23,    17,    18,    19,    20,    21,    22,     4,
+       5,     6,     7,     8,    38,    39,    40,    41,    42,    43,
+      44,    -1,    -1,    -1,    19,    20,    21,    22
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,    13,    14,    15,    16,    27,    30,    35,    37,    46,
+      50,    51,    52,    55,    56,    59,    60,    61,    62,    46,
+      46,    46,    46,    46,     9,    46,    46,    25,    38,    39,
+      40,    41,    42,    43,    44,    45,     0,    52,    28,     3,
+       9,    26,    46,    47,    63,    64,    65,    25,    25,    46,
+      59,    63,    63,    63,    63,    63,    63,    32,    33,    34,
+       9,    58,    63,    63,     4,     5,     6,     7,     8,    10,
+      17,    18,    19,    20,    21,    22,    23,    24,    59,    63,
+      59,    63,    63,    57,    10,    63,    63,    63,    63,    63,
+      11,    53,    63,    63,    63,    63,    63,    63,    63,    63,
+      29,    53,    54,    31,    63,    51,    53,    10,    12
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    49,    50,    51,    51,    52,    52,    52,    52,    52,
+      52,    54,    53,    55,    55,    57,    56,    58,    59,    59,
+      59,    59,    59,    59,    59,    60,    60,    60,    61,    61,
+      61,    61,    61,    61,    61,    61,    61,    61,    62,    62,
+      63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
+      63,    63,    63,    63,    63,    64,    64,    64,    65,    65
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     1,     1,     1,     1,     1,
+       1,     0,     4,     7,     5,     0,     6,     5,     3,     3,
+       3,     2,     3,     3,     2,     3,     3,     3,     2,     2,
+       2,     2,     2,     2,     4,     4,     4,     4,     3,     3,
+       3,     3,     3,     2,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     1,     3,     1,     1,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (scanner, compilerState, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, scanner, compilerState); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void * scanner, CompilerState * compilerState)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (scanner);
+  YY_USE (compilerState);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void * scanner, CompilerState * compilerState)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner, compilerState);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, void * scanner, CompilerState * compilerState)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner, compilerState);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, scanner, compilerState); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, void * scanner, CompilerState * compilerState)
+{
+  YY_USE (yyvaluep);
+  YY_USE (scanner);
+  YY_USE (compilerState);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void * scanner, CompilerState * compilerState)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, scanner);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: statement_list  */
+#line 160 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                { ProgramSemanticAction(compilerState, (yyvsp[0].statement_list).first); }
+#line 1243 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 3: /* statement_list: statement_list statement  */
+#line 163 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.statement_list) = AppendStatementSemanticAction(compilerState, (yyvsp[-1].statement_list), (yyvsp[0].statement)); }
+#line 1249 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 4: /* statement_list: statement  */
+#line 164 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                                { (yyval.statement_list) = StatementListSemanticAction(compilerState, (yyvsp[0].statement)); }
+#line 1255 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 5: /* statement: if_statement  */
+#line 167 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 1261 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 6: /* statement: for_statement  */
+#line 168 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 1267 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 7: /* statement: declaration  */
+#line 169 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 1273 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 8: /* statement: assignment  */
+#line 170 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 1279 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 9: /* statement: function_call  */
+#line 171 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                        { (yyval.statement) = FunctionCallStatementSemanticAction(compilerState, (yyvsp[0].function_call)); }
+#line 1285 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 10: /* statement: iterator_statement  */
+#line 172 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 1291 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 11: /* $@1: %empty  */
+#line 175 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                                { BeginScopeSemanticAction(compilerState); }
+#line 1297 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 12: /* block: OPEN_BRACKET $@1 statement_list CLOSE_BRACKET  */
+#line 176 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                        { (yyval.statement) = BlockSemanticAction(compilerState, (yyvsp[-1].statement_list)); }
+#line 1303 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 13: /* if_statement: IF OPEN_PARENTHESIS expression CLOSE_PARENTHESIS block ELSE block  */
+#line 179 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                        { (yyval.statement) = IfStatementSemanticAction(compilerState, (yyvsp[-4].expression), (yyvsp[-2].statement), (yyvsp[0].statement)); }
+#line 1309 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 14: /* if_statement: IF OPEN_PARENTHESIS expression CLOSE_PARENTHESIS block  */
+#line 180 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                                        { (yyval.statement) = IfStatementSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].statement), NO_NODE); }
+#line 1315 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 15: /* $@2: %empty  */
+#line 183 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                        { ForHeaderSemanticAction(compilerState, (yyvsp[-2].varname)); }
+#line 1321 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 16: /* for_statement: FOR DECLARATION IN range_expression $@2 block  */
+#line 184 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                                { (yyval.statement) = ForStatementSemanticAction(compilerState, (yyvsp[-4].varname), (yyvsp[-2].range_expression), (yyvsp[0].statement)); }
+#line 1327 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 17: /* range_expression: OPEN_PARENTHESIS expression TO expression CLOSE_PARENTHESIS  */
+#line 187 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                { (yyval.range_expression) = RangeExpressionSemanticAction(compilerState, (yyvsp[-3].expression), (yyvsp[-1].expression)); }
+#line 1333 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 18: /* function_call: DECLARATION INSERT expression  */
+#line 190 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                { (yyval.function_call) = FunctionCallSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].expression), INSERT_CALL); }
+#line 1339 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 19: /* function_call: DECLARATION REMOVE expression  */
+#line 191 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.function_call) = FunctionCallSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].expression), REMOVE_CALL); }
+#line 1345 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 20: /* function_call: DECLARATION INCLUDES expression  */
+#line 192 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.function_call) = FunctionCallSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].expression), INCLUDES_CALL); }
+#line 1351 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 21: /* function_call: DECLARATION HEIGHT  */
+#line 193 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                { (yyval.function_call) = FunctionCallSemanticAction(compilerState, (yyvsp[-1].varname), NO_NODE, HEIGHT_CALL); }
+#line 1357 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 22: /* function_call: DECLARATION DEPTH expression  */
+#line 194 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.function_call) = FunctionCallSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].expression), DEPTH_CALL); }
+#line 1363 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 23: /* function_call: DECLARATION CALCULATE expression  */
+#line 195 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.function_call) = FunctionCallSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].expression), CALCULATE_CALL); }
+#line 1369 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 24: /* function_call: DECLARATION VISUALIZE  */
+#line 196 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                        { (yyval.function_call) = FunctionCallSemanticAction(compilerState, (yyvsp[-1].varname), NO_NODE, VISUALIZE_CALL); }
+#line 1375 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 25: /* iterator_statement: DECLARATION ITERATE IN_ORDER  */
+#line 201 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                        { (yyval.statement) = IterateSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].token)); }
+#line 1381 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 26: /* iterator_statement: DECLARATION ITERATE POST_ORDER  */
+#line 202 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.statement) = IterateSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].token)); }
+#line 1387 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 27: /* iterator_statement: DECLARATION ITERATE PRE_ORDER  */
+#line 203 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.statement) = IterateSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].token)); }
+#line 1393 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 28: /* declaration: RED_BLACK_TREE DECLARATION  */
+#line 206 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.statement) = DeclarationSemanticAction(compilerState, (yyvsp[0].varname), RBT_DECLARATION); }
+#line 1399 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 29: /* declaration: BINARY_SEARCH_TREE DECLARATION  */
+#line 207 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.statement) = DeclarationSemanticAction(compilerState, (yyvsp[0].varname), BST_DECLARATION); }
+#line 1405 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 30: /* declaration: EXPRESSION_TREE DECLARATION  */
+#line 208 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                        { (yyval.statement) = DeclarationSemanticAction(compilerState, (yyvsp[0].varname), EXP_DECLARATION); }
+#line 1411 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 31: /* declaration: AVL_TREE DECLARATION  */
+#line 209 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                { (yyval.statement) = DeclarationSemanticAction(compilerState, (yyvsp[0].varname), AVL_DECLARATION); }
+#line 1417 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 32: /* declaration: INT_TYPE DECLARATION  */
+#line 210 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                        { (yyval.statement) = DeclarationSemanticAction(compilerState, (yyvsp[0].varname), INT_DECLARATION); }
+#line 1423 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 33: /* declaration: BOOLEAN_TYPE DECLARATION  */
+#line 211 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                        { (yyval.statement) = DeclarationSemanticAction(compilerState, (yyvsp[0].varname), BOOL_DECLARATION); }
+#line 1429 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 34: /* declaration: INT_TYPE DECLARATION ASSIGN expression  */
+#line 213 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.statement) = IntegerDeclarationWithAssignmentSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].expression), NO_NODE); }
+#line 1435 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 35: /* declaration: INT_TYPE DECLARATION ASSIGN function_call  */
+#line 214 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                { (yyval.statement) = IntegerDeclarationWithAssignmentSemanticAction(compilerState, (yyvsp[-2].varname), NO_NODE, (yyvsp[0].function_call)); }
+#line 1441 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 36: /* declaration: BOOLEAN_TYPE DECLARATION ASSIGN expression  */
+#line 215 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                { (yyval.statement) = BooleanDeclarationWithAssignmentSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].expression), NO_NODE); }
+#line 1447 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 37: /* declaration: BOOLEAN_TYPE DECLARATION ASSIGN function_call  */
+#line 216 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                { (yyval.statement) = BooleanDeclarationWithAssignmentSemanticAction(compilerState, (yyvsp[-2].varname), NO_NODE, (yyvsp[0].function_call)); }
+#line 1453 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 38: /* assignment: DECLARATION ASSIGN expression  */
+#line 219 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.statement) = AssignmentSemanticAction(compilerState, (yyvsp[-2].varname), (yyvsp[0].expression), NO_NODE); }
+#line 1459 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 39: /* assignment: DECLARATION ASSIGN function_call  */
+#line 220 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.statement) = AssignmentSemanticAction(compilerState, (yyvsp[-2].varname), NO_NODE, (yyvsp[0].function_call)); }
+#line 1465 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 40: /* expression: expression MOD expression  */
+#line 223 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), MODULE_EXP); }
+#line 1471 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 41: /* expression: expression AND expression  */
+#line 224 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), AND_EXP);}
+#line 1477 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 42: /* expression: expression OR expression  */
+#line 225 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), OR_EXP);}
+#line 1483 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 43: /* expression: NOT expression  */
+#line 226 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[0].expression), NO_NODE, NOT_EXP);}
+#line 1489 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 44: /* expression: expression EQUAL expression  */
+#line 227 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), EQUAL_EXP);}
+#line 1495 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 45: /* expression: expression NOT_EQUAL expression  */
+#line 228 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), NOT_EQUAL_EXP);}
+#line 1501 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 46: /* expression: expression LESS expression  */
+#line 229 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), LESS_EXP);}
+#line 1507 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 47: /* expression: expression LESS_EQUAL expression  */
+#line 230 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), LESS_EQUAL_EXP);}
+#line 1513 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 48: /* expression: expression GREATER expression  */
+#line 231 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), GREATER_EXP);}
+#line 1519 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 49: /* expression: expression GREATER_EQUAL expression  */
+#line 232 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                        { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), GREATER_EQUAL_EXP);}
+#line 1525 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 50: /* expression: expression ADD expression  */
+#line 233 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), ADDITION_EXP); }
+#line 1531 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 51: /* expression: expression DIV expression  */
+#line 234 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), DIVISION_EXP); }
+#line 1537 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 52: /* expression: expression MUL expression  */
+#line 235 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), MULTIPLICATION_EXP); }
+#line 1543 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 53: /* expression: expression SUB expression  */
+#line 236 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                { (yyval.expression) = ArithmeticExpressionSemanticAction(compilerState, (yyvsp[-2].expression), (yyvsp[0].expression), SUBTRACTION_EXP); }
+#line 1549 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 54: /* expression: factor  */
+#line 237 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 1555 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 55: /* factor: OPEN_PARENTHESIS expression CLOSE_PARENTHESIS  */
+#line 240 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                { (yyval.expression) = ExpressionFactorSemanticAction(compilerState, (yyvsp[-1].expression)); }
+#line 1561 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 56: /* factor: constant  */
+#line 241 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                                { (yyval.expression) = (yyvsp[0].expression); }
+#line 1567 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 57: /* factor: DECLARATION  */
+#line 242 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                        { (yyval.expression) = DeclarationFactorSemanticAction(compilerState, (yyvsp[0].varname)); }
+#line 1573 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 58: /* constant: INTEGER  */
+#line 245 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                        { (yyval.expression) = IntegerConstantSemanticAction(compilerState, (yyvsp[0].integer)); }
+#line 1579 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+  case 59: /* constant: BOOLEAN  */
+#line 246 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+                                                                                                                                { (yyval.expression) = BooleanConstantSemanticAction(compilerState, (yyvsp[0].boolean)); }
+#line 1585 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+    break;
+
+
+#line 1589 "src/main/c/frontend/syntactic-analysis/BisonParser.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (scanner, compilerState, YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, scanner, compilerState);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner, compilerState);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (scanner, compilerState, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, scanner, compilerState);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner, compilerState);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
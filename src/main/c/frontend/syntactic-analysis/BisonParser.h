@@ -0,0 +1,152 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_SRC_MAIN_C_FRONTEND_SYNTACTIC_ANALYSIS_BISONPARSER_H_INCLUDED
+# define YY_YY_SRC_MAIN_C_FRONTEND_SYNTACTIC_ANALYSIS_BISONPARSER_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 16 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+
+
+#include "../../shared/CompilerState.h"
+
+
+#line 55 "src/main/c/frontend/syntactic-analysis/BisonParser.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    INTEGER = 258,                 /* INTEGER  */
+    ADD = 259,                     /* ADD  */
+    SUB = 260,                     /* SUB  */
+    DIV = 261,                     /* DIV  */
+    MUL = 262,                     /* MUL  */
+    MOD = 263,                     /* MOD  */
+    OPEN_PARENTHESIS = 264,        /* OPEN_PARENTHESIS  */
+    CLOSE_PARENTHESIS = 265,       /* CLOSE_PARENTHESIS  */
+    OPEN_BRACKET = 266,            /* OPEN_BRACKET  */
+    CLOSE_BRACKET = 267,           /* CLOSE_BRACKET  */
+    RED_BLACK_TREE = 268,          /* RED_BLACK_TREE  */
+    BINARY_SEARCH_TREE = 269,      /* BINARY_SEARCH_TREE  */
+    EXPRESSION_TREE = 270,         /* EXPRESSION_TREE  */
+    AVL_TREE = 271,                /* AVL_TREE  */
+    NOT_EQUAL = 272,               /* NOT_EQUAL  */
+    EQUAL = 273,                   /* EQUAL  */
+    LESS_EQUAL = 274,              /* LESS_EQUAL  */
+    LESS = 275,                    /* LESS  */
+    GREATER_EQUAL = 276,           /* GREATER_EQUAL  */
+    GREATER = 277,                 /* GREATER  */
+    AND = 278,                     /* AND  */
+    OR = 279,                      /* OR  */
+    ASSIGN = 280,                  /* ASSIGN  */
+    NOT = 281,                     /* NOT  */
+    FOR = 282,                     /* FOR  */
+    IN = 283,                      /* IN  */
+    TO = 284,                      /* TO  */
+    IF = 285,                      /* IF  */
+    ELSE = 286,                    /* ELSE  */
+    IN_ORDER = 287,                /* IN_ORDER  */
+    POST_ORDER = 288,              /* POST_ORDER  */
+    PRE_ORDER = 289,               /* PRE_ORDER  */
+    INT_TYPE = 290,                /* INT_TYPE  */
+    CONSTANT_TYPE = 291,           /* CONSTANT_TYPE  */
+    BOOLEAN_TYPE = 292,            /* BOOLEAN_TYPE  */
+    INSERT = 293,                  /* INSERT  */
+    REMOVE = 294,                  /* REMOVE  */
+    INCLUDES = 295,                /* INCLUDES  */
+    HEIGHT = 296,                  /* HEIGHT  */
+    DEPTH = 297,                   /* DEPTH  */
+    CALCULATE = 298,               /* CALCULATE  */
+    VISUALIZE = 299,               /* VISUALIZE  */
+    ITERATE = 300,                 /* ITERATE  */
+    DECLARATION = 301,             /* DECLARATION  */
+    BOOLEAN = 302,                 /* BOOLEAN  */
+    UNKNOWN = 303                  /* UNKNOWN  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+#line 33 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+union SemanticValue
+{
+#line 35 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+
+	/** Terminals. */
+
+	int integer;
+	Token token;
+	char * varname;
+    bool boolean;
+
+	/** Non-terminals (i.e., indices of the nodes of the AST). */
+
+	ExpressionIndex expression;
+	FunctionCallIndex function_call;
+	StatementIndex statement;
+	StatementList statement_list;
+	RangeExpression range_expression;
+
+#line 138 "src/main/c/frontend/syntactic-analysis/BisonParser.h"
+
+};
+#line 33 "src/main/c/frontend/syntactic-analysis/BisonGrammar.y"
+typedef union SemanticValue YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int yyparse (void * scanner, CompilerState * compilerState);
+
+
+#endif /* !YY_YY_SRC_MAIN_C_FRONTEND_SYNTACTIC_ANALYSIS_BISONPARSER_H_INCLUDED  */
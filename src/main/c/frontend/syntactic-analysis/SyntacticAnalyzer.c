@@ -1,9 +1,10 @@
 #include "SyntacticAnalyzer.h"
 #include "../lexical-analysis/LexicalAnalyzerContext.h"
+#include "../lexical-analysis/SourceCode.h"
+#include "BisonActions.h"
 
 /* MODULE INTERNAL STATE */
 
-static CompilerState * _currentCompilerState = NULL;
 static Logger * _logger = NULL;
 
 void initializeSyntacticAnalyzerModule() {
@@ -18,7 +19,8 @@ void shutdownSyntacticAnalyzerModule() {
 
 /** IMPORTED FUNCTIONS */
 
-extern LexicalAnalyzerContext * createLexicalAnalyzerContext();
+extern void * flexCreateScanner(LexicalAnalyzerState * lexicalAnalyzerState, char * buffer, const size_t size);
+extern void flexDestroyScanner(void * scanner);
 
 /**
  * Bison exported functions.
@@ -31,25 +33,44 @@ extern LexicalAnalyzerContext * createLexicalAnalyzerContext();
  *
  * @see https://www.gnu.org/software/bison/manual/html_node/Parser-Function.html
  */
-extern int yyparse(void);
+extern int yyparse(void * scanner, CompilerState * compilerState);
 
 // Bison error-reporting function.
-void yyerror(const char * string) {
-	LexicalAnalyzerContext * lexicalAnalyzerContext = createLexicalAnalyzerContext();
+void yyerror(void * scanner, CompilerState * compilerState, const char * string) {
+	LexicalAnalyzerContext * lexicalAnalyzerContext = createLexicalAnalyzerContext(scanner);
 	logError(_logger, "Syntax error (on line %d).", lexicalAnalyzerContext->line);
+	destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
 }
 
 /* PUBLIC FUNCTIONS */
 
-CompilerState * currentCompilerState() {
-	return _currentCompilerState;
-}
-
 SyntacticAnalysisStatus parse(CompilerState * compilerState) {
 	logDebugging(_logger, "Parsing...");
-	_currentCompilerState = compilerState;
-	const int code = yyparse();
-	_currentCompilerState = NULL;
+	compilerState->abstractSyntaxtTree = createAbstractSyntaxTree();
+	compilerState->internTable = createInternTable(compilerState->arena);
+	if (compilerState->abstractSyntaxtTree == NULL || compilerState->internTable == NULL) {
+		compilerState->succeed = false;
+		return OUT_OF_MEMORY;
+	}
+	LexicalAnalyzerState lexicalAnalyzerState = {
+		.compilerState = compilerState,
+		.lexemeOffset = 0,
+		.nextLexemeOffset = 0
+	};
+	SourceCode * sourceCode = compilerState->sourceCode;
+	compilerState->scanner = sourceCode == NULL
+		? flexCreateScanner(&lexicalAnalyzerState, NULL, 0)
+		: flexCreateScanner(&lexicalAnalyzerState, sourceCode->content, sourceCode->length + 2);
+	if (compilerState->scanner == NULL) {
+		logError(_logger, "Flex cannot create a scanner.");
+		compilerState->succeed = false;
+		return UNKNOWN_ERROR;
+	}
+	beginSemanticAnalysis(compilerState);
+	const int code = yyparse(compilerState->scanner, compilerState);
+	endSemanticAnalysis(compilerState);
+	flexDestroyScanner(compilerState->scanner);
+	compilerState->scanner = NULL;
 	SyntacticAnalysisStatus syntacticAnalysisStatus;
 	logDebugging(_logger, "Parsing is done.");
 	switch (code) {
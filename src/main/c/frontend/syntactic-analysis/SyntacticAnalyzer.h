@@ -6,8 +6,10 @@
 
 /** Bison imported functions. */
 
-int yylex(void);
-void yyerror(const char * string);
+union SemanticValue;
+
+int yylex(union SemanticValue * semanticValue, void * scanner);
+void yyerror(void * scanner, CompilerState * compilerState, const char * string);
 
 /** Initialize module's internal state. */
 void initializeSyntacticAnalyzerModule();
@@ -23,14 +25,11 @@ typedef enum {
 } SyntacticAnalysisStatus;
 
 /**
- * Retrieves the current compiler state. The state must be accessed during the
- * parsing phase (i.e., during a call to the "parse" function). Outside of the
- * parse, the state is set to NULL.
- */
-CompilerState * currentCompilerState();
-
-/**
- * Executes the parsing phase of the compiler.
+ * Executes the parsing phase of the compiler. Every compilation has its own
+ * scanner and parser, so different compilations can run concurrently.
+ *
+ * The AST is left in the compiler state (even if the program is rejected),
+ * and must be released with "destroyAbstractSyntaxTree".
  */
 SyntacticAnalysisStatus parse(CompilerState * compilerState);
 
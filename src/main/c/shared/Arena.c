@@ -0,0 +1,139 @@
+#include "Arena.h"
+
+/* MODULE INTERNAL STATE */
+
+// Enough for every primitive type (and pointers) of the supported platforms.
+#define ARENA_ALIGNMENT 16
+
+#define ARENA_FIRST_CHUNK_SIZE (64 * 1024)
+#define ARENA_MAXIMUM_CHUNK_SIZE (8 * 1024 * 1024)
+
+static boolean _arenaAllocation = true;
+static Logger * _logger = NULL;
+
+void initializeArenaModule() {
+	_arenaAllocation = getBooleanOrDefault("ARENA_ALLOCATION", _arenaAllocation);
+	_logger = createLogger("Arena");
+}
+
+void shutdownArenaModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * A chunk of memory, which holds the objects right after this header. The
+ * chunks of an arena are linked from the newest to the oldest.
+ */
+typedef struct ArenaChunk ArenaChunk;
+
+struct ArenaChunk {
+	ArenaChunk * previous;
+};
+
+struct Arena {
+	ArenaChunk * chunks;
+	char * next;
+	char * end;
+	size_t nextChunkSize;
+};
+
+// The size of the chunk header, padded so the objects stay aligned.
+#define ARENA_CHUNK_HEADER_SIZE ((sizeof(ArenaChunk) + ARENA_ALIGNMENT - 1) & ~((size_t) ARENA_ALIGNMENT - 1))
+
+/* PRIVATE FUNCTIONS */
+
+static void * _allocateChunk(Arena * arena, const size_t size);
+static void * _allocateInNewChunk(Arena * arena, const size_t size);
+static void _releaseChunks(Arena * arena);
+
+/**
+ * Allocates a new chunk with the specified capacity, and returns the first
+ * byte after its header.
+ */
+static void * _allocateChunk(Arena * arena, const size_t size) {
+	ArenaChunk * chunk = malloc(ARENA_CHUNK_HEADER_SIZE + size);
+	if (chunk == NULL) {
+		logCritical(_logger, "Cannot allocate a chunk of %zu bytes.", size);
+		return NULL;
+	}
+	chunk->previous = arena->chunks;
+	arena->chunks = chunk;
+	return (char *) chunk + ARENA_CHUNK_HEADER_SIZE;
+}
+
+/**
+ * The slow path of the allocation, when the current chunk is full. Objects
+ * bigger than a quarter of a chunk get a chunk of their own, so the current
+ * one is not wasted.
+ */
+static void * _allocateInNewChunk(Arena * arena, const size_t size) {
+	if (!_arenaAllocation || arena->nextChunkSize / 4 < size) {
+		return _allocateChunk(arena, size);
+	}
+	char * memory = _allocateChunk(arena, arena->nextChunkSize);
+	if (memory == NULL) {
+		return NULL;
+	}
+	arena->next = memory + size;
+	arena->end = memory + arena->nextChunkSize;
+	if (arena->nextChunkSize < ARENA_MAXIMUM_CHUNK_SIZE) {
+		arena->nextChunkSize *= 2;
+	}
+	return memory;
+}
+
+/**
+ * Releases every chunk of the arena.
+ */
+static void _releaseChunks(Arena * arena) {
+	ArenaChunk * chunk = arena->chunks;
+	while (chunk != NULL) {
+		ArenaChunk * previous = chunk->previous;
+		free(chunk);
+		chunk = previous;
+	}
+	arena->chunks = NULL;
+	arena->next = NULL;
+	arena->end = NULL;
+	arena->nextChunkSize = ARENA_FIRST_CHUNK_SIZE;
+}
+
+/* PUBLIC FUNCTIONS */
+
+Arena * createArena() {
+	Arena * arena = calloc(1, sizeof(Arena));
+	arena->nextChunkSize = ARENA_FIRST_CHUNK_SIZE;
+	return arena;
+}
+
+void * allocateInArena(Arena * arena, const size_t size) {
+	const size_t alignedSize = (size + ARENA_ALIGNMENT - 1) & ~((size_t) ARENA_ALIGNMENT - 1);
+	if (alignedSize <= (size_t) (arena->end - arena->next)) {
+		void * memory = arena->next;
+		arena->next += alignedSize;
+		return memory;
+	}
+	return _allocateInNewChunk(arena, alignedSize);
+}
+
+char * copyStringToArena(Arena * arena, const char * string, const size_t length) {
+	char * copy = allocateInArena(arena, length + 1);
+	if (copy != NULL) {
+		memcpy(copy, string, length);
+		copy[length] = '\0';
+	}
+	return copy;
+}
+
+void resetArena(Arena * arena) {
+	_releaseChunks(arena);
+}
+
+void destroyArena(Arena * arena) {
+	if (arena != NULL) {
+		_releaseChunks(arena);
+		free(arena);
+	}
+}
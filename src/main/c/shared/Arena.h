@@ -0,0 +1,53 @@
+#ifndef ARENA_HEADER
+#define ARENA_HEADER
+
+#include "Environment.h"
+#include "Logger.h"
+#include "Type.h"
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeArenaModule();
+
+/** Shutdown module's internal state. */
+void shutdownArenaModule();
+
+/**
+ * A region of memory that owns every object allocated in it, so they are all
+ * released at once (e.g., every identifier of a program). The objects are bump-allocated
+ * over big chunks, and cannot be released individually.
+ *
+ * If "ARENA_ALLOCATION" is disabled, every object gets its own allocation in
+ * heap-memory instead, but they are still released along with the arena.
+ */
+typedef struct Arena Arena;
+
+/**
+ * Creates an empty arena.
+ */
+Arena * createArena();
+
+/**
+ * Allocates an uninitialized (but properly aligned) object in the arena.
+ * Returns NULL if there is no memory left.
+ */
+void * allocateInArena(Arena * arena, const size_t size);
+
+/**
+ * Copies the first "length" characters of the string into the arena, and
+ * appends a null character.
+ */
+char * copyStringToArena(Arena * arena, const char * string, const size_t length);
+
+/**
+ * Releases every object of the arena, which can be reused afterwards.
+ */
+void resetArena(Arena * arena);
+
+/**
+ * Releases every object of the arena, and the arena itself.
+ */
+void destroyArena(Arena * arena);
+
+#endif
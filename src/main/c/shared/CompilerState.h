@@ -1,7 +1,11 @@
 #ifndef COMPILER_STATE_HEADER
 #define COMPILER_STATE_HEADER
 
+#include "Arena.h"
+#include "InternTable.h"
+#include "OutputBuffer.h"
 #include "Type.h"
+#include <stdio.h>
 
 /**
  * The general status of a compilation.
@@ -11,19 +15,62 @@ typedef enum {
 	FAILED = 1
 } CompilationStatus;
 
+/**
+ * The language of the generated code: a Java class (run on the JVM, with the
+ * Java runtime), either as source or as bytecode, or a C program (linked
+ * against the static library of the native runtime).
+ */
+typedef enum {
+	JAVA_TARGET = 0,
+	C_TARGET = 1,
+	JAVA_CLASS_TARGET = 2
+} CompilationTarget;
+
 /**
  * The global state of the compiler. Should transport every data structure
  * needed across the different phases of a compilation.
  */
 typedef struct {
-	// The root node of the AST.
+	// The AST (an "AbstractSyntaxTree").
 	void * abstractSyntaxtTree;
 
+	// The owner of every identifier.
+	Arena * arena;
+
+	// The identifiers of this compilation, interned in the arena.
+	InternTable * internTable;
+
+	// The IR lowered from the AST (an "IntermediateRepresentation").
+	void * intermediateRepresentation;
+
 	// A flag that indicates the current state of the compilation so far.
 	boolean succeed;
 
-	// TODO: Add an stack to handle nested scopes.
-	// TODO: Add a symbol table.
+	// The name of the generated class (e.g., "Main").
+	const char * className;
+
+	// The file where the generated code is written.
+	FILE * outputFile;
+
+	// The buffer of the generated code, while it's being generated.
+	OutputBuffer * outputBuffer;
+
+	// The reentrant scanner of this compilation (a Flex "yyscan_t").
+	void * scanner;
+
+	// The number of semantic errors found so far.
+	unsigned int semanticErrors;
+
+	// The program to compile (a "SourceCode"), or NULL to read it from the
+	// standard input.
+	void * sourceCode;
+
+	// The symbol table (a "symbolTableADT"), with a scope per block.
+	void * symbolTable;
+
+	// The symbols used in expressions, validated at the end of the program.
+	void * usedSymbols;
+
 	// TODO: Add configuration.
 	// TODO: ...
 
@@ -0,0 +1,154 @@
+#include "Configuration.h"
+
+/* MODULE INTERNAL STATE */
+
+static const char * _defaultClassOutputDirectory = "./src/main/c/backend/domain-specific/target/classes";
+static const char * _defaultCOutputDirectory = ".";
+static const char * _defaultOutputDirectory = "./src/main/c/backend/domain-specific/src/main/java";
+static Logger * _logger = NULL;
+
+void initializeConfigurationModule() {
+	_logger = createLogger("Configuration");
+}
+
+void shutdownConfigurationModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _parseJobs(const char * value, unsigned int * jobs);
+
+/**
+ * Parses the amount of workers, which must be a positive integer.
+ */
+static boolean _parseJobs(const char * value, unsigned int * jobs) {
+	char * end = NULL;
+	const long parsedJobs = strtol(value, &end, 10);
+	if (end == value || *end != '\0' || parsedJobs < 1 || 4096 < parsedJobs) {
+		return false;
+	}
+	*jobs = (unsigned int) parsedJobs;
+	return true;
+}
+
+/* PUBLIC FUNCTIONS */
+
+Configuration * createConfiguration(const int count, const char ** arguments) {
+	Configuration * configuration = calloc(1, sizeof(Configuration));
+	boolean hasJobs = false;
+	boolean emitsClass = false;
+	for (int k = 1; k < count; ++k) {
+		const char * argument = arguments[k];
+		const boolean hasValue = k + 1 < count;
+		if (strcmp(argument, "--batch") == 0 && hasValue) {
+			configuration->batch = arguments[++k];
+		}
+		else if (strcmp(argument, "-j") == 0 && hasValue) {
+			if (!_parseJobs(arguments[++k], &configuration->jobs)) {
+				logError(_logger, "The amount of workers must be a positive integer: \"%s\"", arguments[k]);
+				destroyConfiguration(configuration);
+				return NULL;
+			}
+			hasJobs = true;
+		}
+		else if (strncmp(argument, "-j", 2) == 0 && argument[2] != '\0') {
+			if (!_parseJobs(argument + 2, &configuration->jobs)) {
+				logError(_logger, "The amount of workers must be a positive integer: \"%s\"", argument + 2);
+				destroyConfiguration(configuration);
+				return NULL;
+			}
+			hasJobs = true;
+		}
+		else if (strcmp(argument, "--output") == 0 && hasValue) {
+			configuration->outputDirectory = arguments[++k];
+		}
+		else if (strcmp(argument, "--dump-ir") == 0) {
+			configuration->dumpIntermediateRepresentation = true;
+		}
+		else if (strcmp(argument, "--run") == 0) {
+			configuration->run = true;
+		}
+		else if (strcmp(argument, "--target=java") == 0) {
+			configuration->target = JAVA_TARGET;
+		}
+		else if (strcmp(argument, "--target=c") == 0) {
+			configuration->target = C_TARGET;
+		}
+		else if (strncmp(argument, "--target=", 9) == 0) {
+			logError(_logger, "Unknown target (only \"java\" and \"c\" are supported): \"%s\"", argument + 9);
+			destroyConfiguration(configuration);
+			return NULL;
+		}
+		else if (strcmp(argument, "--emit=source") == 0) {
+			emitsClass = false;
+		}
+		else if (strcmp(argument, "--emit=class") == 0) {
+			emitsClass = true;
+		}
+		else if (strncmp(argument, "--emit=", 7) == 0) {
+			logError(_logger, "Unknown emission (only \"source\" and \"class\" are supported): \"%s\"", argument + 7);
+			destroyConfiguration(configuration);
+			return NULL;
+		}
+		else if (argument[0] == '-') {
+			logError(_logger, "Unknown (or incomplete) option: \"%s\"", argument);
+			destroyConfiguration(configuration);
+			return NULL;
+		}
+		else if (configuration->input == NULL) {
+			configuration->input = argument;
+		}
+		else {
+			logError(_logger, "Only one program can be compiled (use \"--batch\" instead): \"%s\"", argument);
+			destroyConfiguration(configuration);
+			return NULL;
+		}
+	}
+	if (configuration->batch != NULL && configuration->input != NULL) {
+		logError(_logger, "A program cannot be compiled along with a batch: \"%s\"", configuration->input);
+		destroyConfiguration(configuration);
+		return NULL;
+	}
+	if (configuration->batch != NULL && configuration->run) {
+		logError(_logger, "A batch cannot be run (only a single program can).");
+		destroyConfiguration(configuration);
+		return NULL;
+	}
+	if (emitsClass && configuration->target == C_TARGET) {
+		logError(_logger, "Only the Java target can be emitted as a class.");
+		destroyConfiguration(configuration);
+		return NULL;
+	}
+	if (emitsClass) {
+		configuration->target = JAVA_CLASS_TARGET;
+	}
+	if (configuration->batch == NULL && hasJobs) {
+		logWarning(_logger, "The amount of workers only applies to the batch mode.");
+	}
+	if (configuration->run && configuration->target != JAVA_TARGET) {
+		logWarning(_logger, "The target only applies to the compilation (not to \"--run\").");
+	}
+	if (configuration->outputDirectory == NULL) {
+		switch (configuration->target) {
+			case C_TARGET:
+				configuration->outputDirectory = _defaultCOutputDirectory;
+				break;
+			case JAVA_CLASS_TARGET:
+				configuration->outputDirectory = _defaultClassOutputDirectory;
+				break;
+			default:
+				configuration->outputDirectory = _defaultOutputDirectory;
+				break;
+		}
+	}
+	return configuration;
+}
+
+void destroyConfiguration(Configuration * configuration) {
+	if (configuration != NULL) {
+		free(configuration);
+	}
+}
@@ -0,0 +1,64 @@
+#ifndef CONFIGURATION_HEADER
+#define CONFIGURATION_HEADER
+
+#include "CompilerState.h"
+#include "Logger.h"
+#include "Type.h"
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeConfigurationModule();
+
+/** Shutdown module's internal state. */
+void shutdownConfigurationModule();
+
+/**
+ * The options of the compiler, taken from the command-line arguments.
+ */
+typedef struct {
+	// The directory (with ".tla" programs), or the file (with one path per
+	// line), to compile in batch mode. NULL if a single program is compiled.
+	const char * batch;
+
+	// Whether the IR of each program is written next to its class, as a
+	// "<class>.ir" listing.
+	boolean dumpIntermediateRepresentation;
+
+	// The program to compile, or NULL to read it from the standard input.
+	const char * input;
+
+	// The amount of workers of the batch mode (0 means one per processor).
+	unsigned int jobs;
+
+	// The directory where the generated code is written (by default, the Java
+	// project, its classes for "--emit=class", or the working directory for
+	// C).
+	const char * outputDirectory;
+
+	// Whether the program is run with the interpreter, instead of generating
+	// its Java class.
+	boolean run;
+
+	// The language of the generated code (and whether Java is emitted as
+	// bytecode).
+	CompilationTarget target;
+} Configuration;
+
+/**
+ * Creates the configuration from the command-line arguments. The accepted
+ * usages are:
+ *
+ *	Compiler [<program>] [--output <directory>] [--target=<java|c>] [--emit=<source|class>] [--dump-ir] [--run]
+ *	Compiler --batch <directory|list> [-j <workers>] [--output <directory>] [--target=<java|c>] [--emit=<source|class>] [--dump-ir]
+ *
+ * Returns NULL if the arguments are invalid.
+ */
+Configuration * createConfiguration(const int count, const char ** arguments);
+
+/**
+ * Destroys the configuration.
+ */
+void destroyConfiguration(Configuration * configuration);
+
+#endif
@@ -0,0 +1,126 @@
+#include "Hash.h"
+
+/* MODULE INTERNAL STATE */
+
+// The default secret of wyhash: odd 64-bit numbers, with 32 bits set each.
+static const uint64_t _secret[4] = {
+	0x2d358dccaa6c78a5ull,
+	0x8bb84b93962eacc9ull,
+	0x4b33a62ed433d4a3ull,
+	0x4d5a2da51de1aa47ull
+};
+
+/* PRIVATE FUNCTIONS */
+
+static void _multiply(uint64_t * low, uint64_t * high);
+static uint64_t _mix(uint64_t left, uint64_t right);
+static uint64_t _read8(const uint8_t * bytes);
+static uint64_t _read4(const uint8_t * bytes);
+static uint64_t _read3(const uint8_t * bytes, const size_t length);
+
+/**
+ * Replaces both operands with the low and the high halves of their 128-bit
+ * product.
+ */
+static void _multiply(uint64_t * low, uint64_t * high) {
+#if defined(__SIZEOF_INT128__)
+	const __uint128_t product = (__uint128_t) *low * *high;
+	*low = (uint64_t) product;
+	*high = (uint64_t) (product >> 64);
+#else
+	const uint64_t leftHigh = *low >> 32;
+	const uint64_t leftLow = (uint32_t) *low;
+	const uint64_t rightHigh = *high >> 32;
+	const uint64_t rightLow = (uint32_t) *high;
+	const uint64_t highHigh = leftHigh * rightHigh;
+	const uint64_t highLow = leftHigh * rightLow;
+	const uint64_t lowHigh = leftLow * rightHigh;
+	const uint64_t lowLow = leftLow * rightLow;
+	const uint64_t middle = highLow + (lowLow >> 32) + (uint32_t) lowHigh;
+	*low = (middle << 32) | (uint32_t) lowLow;
+	*high = highHigh + (middle >> 32) + (lowHigh >> 32);
+#endif
+}
+
+/**
+ * Folds the 128-bit product of both words into 64 bits.
+ */
+static uint64_t _mix(uint64_t left, uint64_t right) {
+	_multiply(&left, &right);
+	return left ^ right;
+}
+
+/**
+ * Unaligned reads (the compiler turns them into a single load).
+ */
+static uint64_t _read8(const uint8_t * bytes) {
+	uint64_t word;
+	memcpy(&word, bytes, sizeof(word));
+	return word;
+}
+
+static uint64_t _read4(const uint8_t * bytes) {
+	uint32_t word;
+	memcpy(&word, bytes, sizeof(word));
+	return word;
+}
+
+/**
+ * Reads 1, 2 or 3 bytes into a word, without branching on the length.
+ */
+static uint64_t _read3(const uint8_t * bytes, const size_t length) {
+	return ((uint64_t) bytes[0] << 16) | ((uint64_t) bytes[length >> 1] << 8) | bytes[length - 1];
+}
+
+/* PUBLIC FUNCTIONS */
+
+uint64_t hashBytes(const void * bytes, const size_t length, const uint64_t seed) {
+	const uint8_t * pointer = bytes;
+	uint64_t state = seed ^ _mix(seed ^ _secret[0], _secret[1]);
+	uint64_t left;
+	uint64_t right;
+	if (length <= 16) {
+		if (4 <= length) {
+			// Two overlapping pairs of 4-byte words cover up to 16 bytes.
+			const size_t offset = (length >> 3) << 2;
+			left = (_read4(pointer) << 32) | _read4(pointer + offset);
+			right = (_read4(pointer + length - 4) << 32) | _read4(pointer + length - 4 - offset);
+		}
+		else if (0 < length) {
+			left = _read3(pointer, length);
+			right = 0;
+		}
+		else {
+			left = 0;
+			right = 0;
+		}
+	}
+	else {
+		size_t remaining = length;
+		if (48 < remaining) {
+			// Three independent lanes, so the multiplications overlap.
+			uint64_t second = state;
+			uint64_t third = state;
+			do {
+				state = _mix(_read8(pointer) ^ _secret[1], _read8(pointer + 8) ^ state);
+				second = _mix(_read8(pointer + 16) ^ _secret[2], _read8(pointer + 24) ^ second);
+				third = _mix(_read8(pointer + 32) ^ _secret[3], _read8(pointer + 40) ^ third);
+				pointer += 48;
+				remaining -= 48;
+			} while (48 < remaining);
+			state ^= second ^ third;
+		}
+		while (16 < remaining) {
+			state = _mix(_read8(pointer) ^ _secret[1], _read8(pointer + 8) ^ state);
+			pointer += 16;
+			remaining -= 16;
+		}
+		// The last 16 bytes (which may overlap with the ones already mixed).
+		left = _read8(pointer + remaining - 16);
+		right = _read8(pointer + remaining - 8);
+	}
+	left ^= _secret[1];
+	right ^= state;
+	_multiply(&left, &right);
+	return _mix(left ^ _secret[0] ^ length, right ^ _secret[1]);
+}
@@ -0,0 +1,18 @@
+#ifndef HASH_HEADER
+#define HASH_HEADER
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Hashes a sequence of bytes, reading them 8 at a time (or 4, for short
+ * sequences), and mixing each pair of words with a single 64x64-bit
+ * multiplication. It follows wyhash (final version 4), so it's good enough for
+ * hash tables, but not for cryptography.
+ *
+ * @see https://github.com/wangyi-fudan/wyhash
+ */
+uint64_t hashBytes(const void * bytes, const size_t length, const uint64_t seed);
+
+#endif
@@ -0,0 +1,151 @@
+#include "InternTable.h"
+
+/* MODULE INTERNAL STATE */
+
+// Must be a power of 2.
+#define INTERN_TABLE_INITIAL_CAPACITY 256
+
+#define INTERN_TABLE_SEED 0x13572468
+
+static Logger * _logger = NULL;
+
+void initializeInternTableModule() {
+	_logger = createLogger("InternTable");
+}
+
+void shutdownInternTableModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * An interned string, preceded by its metadata. Only the pointer to the
+ * characters leaves this module.
+ */
+typedef struct {
+	uint64_t hash;
+	size_t length;
+	char characters[];
+} InternedString;
+
+/**
+ * An open-addressing set with linear probing. The load factor is kept under
+ * 1/2, so probes are short, and the capacity is a power of 2, so the slot of a
+ * hash is computed with a mask.
+ */
+struct InternTable {
+	Arena * arena;
+	InternedString ** slots;
+	size_t capacity;
+	size_t count;
+};
+
+/* PRIVATE FUNCTIONS */
+
+static InternedString * _header(const char * internedString);
+static boolean _grow(InternTable * internTable);
+
+/**
+ * Returns the metadata that precedes the characters of an interned string.
+ */
+static InternedString * _header(const char * internedString) {
+	return (InternedString *) (internedString - offsetof(InternedString, characters));
+}
+
+/**
+ * Doubles the capacity of the table, and rehashes every string (with its
+ * stored hash).
+ */
+static boolean _grow(InternTable * internTable) {
+	const size_t capacity = 2 * internTable->capacity;
+	InternedString ** slots = calloc(capacity, sizeof(InternedString *));
+	if (slots == NULL) {
+		logCritical(_logger, "Cannot grow the intern table up to %zu slots.", capacity);
+		return false;
+	}
+	for (size_t k = 0; k < internTable->capacity; ++k) {
+		InternedString * interned = internTable->slots[k];
+		if (interned != NULL) {
+			size_t slot = interned->hash & (capacity - 1);
+			while (slots[slot] != NULL) {
+				slot = (slot + 1) & (capacity - 1);
+			}
+			slots[slot] = interned;
+		}
+	}
+	free(internTable->slots);
+	internTable->slots = slots;
+	internTable->capacity = capacity;
+	return true;
+}
+
+/* PUBLIC FUNCTIONS */
+
+InternTable * createInternTable(Arena * arena) {
+	InternTable * internTable = calloc(1, sizeof(InternTable));
+	if (internTable == NULL) {
+		logCritical(_logger, "Cannot allocate an intern table.");
+		return NULL;
+	}
+	internTable->slots = calloc(INTERN_TABLE_INITIAL_CAPACITY, sizeof(InternedString *));
+	if (internTable->slots == NULL) {
+		logCritical(_logger, "Cannot allocate an intern table.");
+		free(internTable);
+		return NULL;
+	}
+	internTable->arena = arena;
+	internTable->capacity = INTERN_TABLE_INITIAL_CAPACITY;
+	internTable->count = 0;
+	return internTable;
+}
+
+char * internString(InternTable * internTable, const char * string, const size_t length) {
+	const uint64_t hash = hashBytes(string, length, INTERN_TABLE_SEED);
+	size_t slot = hash & (internTable->capacity - 1);
+	for (InternedString * interned = internTable->slots[slot]; interned != NULL; interned = internTable->slots[slot]) {
+		if (interned->hash == hash && interned->length == length && memcmp(interned->characters, string, length) == 0) {
+			return interned->characters;
+		}
+		slot = (slot + 1) & (internTable->capacity - 1);
+	}
+	// It's a new string. At least one slot must remain free, or the probes of
+	// later lookups would never end.
+	if (internTable->capacity < 2 * (internTable->count + 1)) {
+		if (_grow(internTable)) {
+			slot = hash & (internTable->capacity - 1);
+			while (internTable->slots[slot] != NULL) {
+				slot = (slot + 1) & (internTable->capacity - 1);
+			}
+		}
+		else if (internTable->capacity <= internTable->count + 1) {
+			return NULL;
+		}
+	}
+	InternedString * interned = allocateInArena(internTable->arena, sizeof(InternedString) + length + 1);
+	if (interned == NULL) {
+		return NULL;
+	}
+	interned->hash = hash;
+	interned->length = length;
+	memcpy(interned->characters, string, length);
+	interned->characters[length] = '\0';
+	internTable->slots[slot] = interned;
+	++internTable->count;
+	return interned->characters;
+}
+
+uint64_t internedStringHash(const char * internedString) {
+	return _header(internedString)->hash;
+}
+
+size_t internedStringLength(const char * internedString) {
+	return _header(internedString)->length;
+}
+
+void destroyInternTable(InternTable * internTable) {
+	if (internTable != NULL) {
+		free(internTable->slots);
+		free(internTable);
+	}
+}
@@ -0,0 +1,54 @@
+#ifndef INTERN_TABLE_HEADER
+#define INTERN_TABLE_HEADER
+
+#include "Arena.h"
+#include "Hash.h"
+#include "Logger.h"
+#include "Type.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeInternTableModule();
+
+/** Shutdown module's internal state. */
+void shutdownInternTableModule();
+
+/**
+ * The set of distinct strings of a compilation (e.g., identifiers). Each one
+ * is stored once, in the arena of the compilation, along with its hash and
+ * length, so two interned strings are equal if (and only if) they are the
+ * same pointer.
+ */
+typedef struct InternTable InternTable;
+
+/**
+ * Creates an empty intern table, which stores its strings in the arena. The
+ * strings outlive the table, but not the arena.
+ */
+InternTable * createInternTable(Arena * arena);
+
+/**
+ * Returns the interned copy of the first "length" characters of the string,
+ * storing it if it's new. Returns NULL if there is no memory left.
+ */
+char * internString(InternTable * internTable, const char * string, const size_t length);
+
+/**
+ * The hash of an interned string, computed once when it was stored.
+ */
+uint64_t internedStringHash(const char * internedString);
+
+/**
+ * The length of an interned string, without traversing it.
+ */
+size_t internedStringLength(const char * internedString);
+
+/**
+ * Releases the intern table (but not the strings, owned by the arena).
+ */
+void destroyInternTable(InternTable * internTable);
+
+#endif
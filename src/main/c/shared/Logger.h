@@ -86,6 +86,12 @@ Logger * createLogger(char * name);
  */
 void destroyLogger(Logger * logger);
 
+/**
+ * Returns true if a message at the specified level would be visible, so that
+ * expensive messages can be skipped before building them.
+ */
+const boolean isLoggingLevelEnabled(const Logger * logger, const LoggingLevel loggingLevel);
+
 /** Logs at CRITICAL level. */
 void logCritical(const Logger * logger, const char * const format, ...);
 
@@ -0,0 +1,137 @@
+#include "OutputBuffer.h"
+
+/* MODULE INTERNAL STATE */
+
+// The size of each write into the file.
+#define OUTPUT_BUFFER_CAPACITY (1 << 20)
+
+static Logger * _logger = NULL;
+
+void initializeOutputBufferModule() {
+	_logger = createLogger("OutputBuffer");
+}
+
+void shutdownOutputBufferModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * The buffered characters, and the indentation of the deepest level (every
+ * other level is a prefix of it).
+ */
+struct OutputBuffer {
+	FILE * file;
+	char * characters;
+	size_t length;
+	char * indentation;
+	unsigned int indentationSize;
+	unsigned int maximumIndentationLevel;
+	boolean failed;
+};
+
+/* PRIVATE FUNCTIONS */
+
+static void _write(OutputBuffer * outputBuffer, const char * characters, const size_t length);
+
+/**
+ * Writes characters into the file, and remembers if the write has failed.
+ */
+static void _write(OutputBuffer * outputBuffer, const char * characters, const size_t length) {
+	if (0 < length && fwrite(characters, sizeof(char), length, outputBuffer->file) != length) {
+		if (!outputBuffer->failed) {
+			logError(_logger, "Cannot write %zu character(s) of the generated code.", length);
+		}
+		outputBuffer->failed = true;
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+OutputBuffer * createOutputBuffer(FILE * file, const char indentationCharacter, const unsigned int indentationSize, const unsigned int maximumIndentationLevel) {
+	OutputBuffer * outputBuffer = calloc(1, sizeof(OutputBuffer));
+	if (outputBuffer == NULL) {
+		logCritical(_logger, "Cannot allocate an output buffer.");
+		return NULL;
+	}
+	const size_t indentationLength = (size_t) indentationSize * maximumIndentationLevel;
+	outputBuffer->file = file;
+	outputBuffer->characters = malloc(OUTPUT_BUFFER_CAPACITY);
+	outputBuffer->indentation = malloc(indentationLength + 1);
+	outputBuffer->indentationSize = indentationSize;
+	outputBuffer->maximumIndentationLevel = maximumIndentationLevel;
+	if (outputBuffer->characters == NULL || outputBuffer->indentation == NULL) {
+		logCritical(_logger, "Cannot allocate an output buffer of %d byte(s).", OUTPUT_BUFFER_CAPACITY);
+		destroyOutputBuffer(outputBuffer);
+		return NULL;
+	}
+	memset(outputBuffer->indentation, indentationCharacter, indentationLength);
+	outputBuffer->indentation[indentationLength] = '\0';
+	return outputBuffer;
+}
+
+void appendCharacter(OutputBuffer * outputBuffer, const char character) {
+	if (outputBuffer->length == OUTPUT_BUFFER_CAPACITY) {
+		flushOutputBuffer(outputBuffer);
+	}
+	outputBuffer->characters[outputBuffer->length++] = character;
+}
+
+void appendCharacters(OutputBuffer * outputBuffer, const char * characters, const size_t length) {
+	if (OUTPUT_BUFFER_CAPACITY - outputBuffer->length < length) {
+		flushOutputBuffer(outputBuffer);
+		if (OUTPUT_BUFFER_CAPACITY < length) {
+			// Too long to be buffered, so it's written at once.
+			_write(outputBuffer, characters, length);
+			return;
+		}
+	}
+	memcpy(outputBuffer->characters + outputBuffer->length, characters, length);
+	outputBuffer->length += length;
+}
+
+void appendString(OutputBuffer * outputBuffer, const char * string) {
+	appendCharacters(outputBuffer, string, strlen(string));
+}
+
+void appendInteger(OutputBuffer * outputBuffer, const int integer) {
+	if (integer < 0) {
+		appendCharacter(outputBuffer, '-');
+		// The magnitude of INT_MIN does not fit in an "int".
+		appendUnsigned(outputBuffer, 0u - (unsigned int) integer);
+	}
+	else {
+		appendUnsigned(outputBuffer, (unsigned int) integer);
+	}
+}
+
+void appendUnsigned(OutputBuffer * outputBuffer, const unsigned int integer) {
+	char digits[16];
+	size_t start = sizeof(digits);
+	unsigned int remainder = integer;
+	do {
+		digits[--start] = (char) ('0' + remainder % 10);
+		remainder /= 10;
+	} while (0 < remainder);
+	appendCharacters(outputBuffer, digits + start, sizeof(digits) - start);
+}
+
+void appendIndentation(OutputBuffer * outputBuffer, const unsigned int level) {
+	const unsigned int effectiveLevel = level < outputBuffer->maximumIndentationLevel ? level : outputBuffer->maximumIndentationLevel;
+	appendCharacters(outputBuffer, outputBuffer->indentation, (size_t) effectiveLevel * outputBuffer->indentationSize);
+}
+
+boolean flushOutputBuffer(OutputBuffer * outputBuffer) {
+	_write(outputBuffer, outputBuffer->characters, outputBuffer->length);
+	outputBuffer->length = 0;
+	return !outputBuffer->failed;
+}
+
+void destroyOutputBuffer(OutputBuffer * outputBuffer) {
+	if (outputBuffer != NULL) {
+		free(outputBuffer->characters);
+		free(outputBuffer->indentation);
+		free(outputBuffer);
+	}
+}
@@ -0,0 +1,67 @@
+#ifndef OUTPUT_BUFFER_HEADER
+#define OUTPUT_BUFFER_HEADER
+
+#include "Logger.h"
+#include "Type.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeOutputBufferModule();
+
+/** Shutdown module's internal state. */
+void shutdownOutputBufferModule();
+
+/**
+ * A buffer of generated code, which is written into its file in big chunks
+ * (instead of a call to the standard library per fragment). The indentation
+ * of every level is computed once, when the buffer is created, and levels
+ * deeper than the maximum are not indented any further.
+ */
+typedef struct OutputBuffer OutputBuffer;
+
+/**
+ * Creates an empty buffer that writes into the file, indented with "size"
+ * characters per level. Returns NULL if there is no memory left.
+ */
+OutputBuffer * createOutputBuffer(FILE * file, const char indentationCharacter, const unsigned int indentationSize, const unsigned int maximumIndentationLevel);
+
+/**
+ * Appends a single character.
+ */
+void appendCharacter(OutputBuffer * outputBuffer, const char character);
+
+/**
+ * Appends the first "length" characters of the string.
+ */
+void appendCharacters(OutputBuffer * outputBuffer, const char * characters, const size_t length);
+
+/**
+ * Appends a null-terminated string (e.g., a literal, or an identifier).
+ */
+void appendString(OutputBuffer * outputBuffer, const char * string);
+
+/**
+ * Appends an integer (or an unsigned integer), in decimal.
+ */
+void appendInteger(OutputBuffer * outputBuffer, const int integer);
+void appendUnsigned(OutputBuffer * outputBuffer, const unsigned int integer);
+
+/**
+ * Appends the indentation of the specified level.
+ */
+void appendIndentation(OutputBuffer * outputBuffer, const unsigned int level);
+
+/**
+ * Writes every buffered character into the file. Returns false if any write
+ * of the buffer has failed so far.
+ */
+boolean flushOutputBuffer(OutputBuffer * outputBuffer);
+
+/**
+ * Releases the buffer, without flushing it (nor closing its file).
+ */
+void destroyOutputBuffer(OutputBuffer * outputBuffer);
+
+#endif